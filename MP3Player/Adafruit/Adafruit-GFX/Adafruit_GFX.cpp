@@ -34,10 +34,6 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "Adafruit_GFX.h"
 #include "glcdfont.c"
 
-void PrintToLcdWithBuf(char *buf, int size, char *format, ...);
-#define BUTTONBUFSIZE 16
-char buttonBuf[BUTTONBUFSIZE];
-
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
 
 #ifndef min
@@ -59,43 +55,22 @@ Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h):
   textcolor = textbgcolor = 0xFFFF;
   wrap      = true;
   _cp437    = false;
+  runFont   = NULL;
 }
 
 // Draw a circle outline
 void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r,
     uint16_t color) {
-  int16_t f = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x = 0;
-  int16_t y = r;
-
   drawPixel(x0  , y0+r, color);
   drawPixel(x0  , y0-r, color);
   drawPixel(x0+r, y0  , color);
   drawPixel(x0-r, y0  , color);
 
-  while (x<y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
-  
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 + x, y0 - y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + y, y0 + x, color);
-    drawPixel(x0 - y, y0 + x, color);
-    drawPixel(x0 + y, y0 - x, color);
-    drawPixel(x0 - y, y0 - x, color);
-  }
+  drawCircleHelper(x0, y0, r, 0xF, color);
 }
 
+// Quarter circle outlines. Consecutive points on the same row (and, in
+// the other octant, the same column) are drawn as one fast line.
 void Adafruit_GFX::drawCircleHelper( int16_t x0, int16_t y0,
                int16_t r, uint8_t cornername, uint16_t color) {
   int16_t f     = 1 - r;
@@ -103,9 +78,12 @@ void Adafruit_GFX::drawCircleHelper( int16_t x0, int16_t y0,
   int16_t ddF_y = -2 * r;
   int16_t x     = 0;
   int16_t y     = r;
+  int16_t xs    = 0; // first x of the run at this y, 0 if none yet
 
   while (x<y) {
     if (f >= 0) {
+      if (xs) drawCircleSpans(x0, y0, xs, x, y, cornername, color);
+      xs = 0;
       y--;
       ddF_y += 2;
       f     += ddF_y;
@@ -113,22 +91,32 @@ void Adafruit_GFX::drawCircleHelper( int16_t x0, int16_t y0,
     x++;
     ddF_x += 2;
     f     += ddF_x;
-    if (cornername & 0x4) {
-      drawPixel(x0 + x, y0 + y, color);
-      drawPixel(x0 + y, y0 + x, color);
-    } 
-    if (cornername & 0x2) {
-      drawPixel(x0 + x, y0 - y, color);
-      drawPixel(x0 + y, y0 - x, color);
-    }
-    if (cornername & 0x8) {
-      drawPixel(x0 - y, y0 + x, color);
-      drawPixel(x0 - x, y0 + y, color);
-    }
-    if (cornername & 0x1) {
-      drawPixel(x0 - y, y0 - x, color);
-      drawPixel(x0 - x, y0 - y, color);
-    }
+    if (!xs) xs = x;
+  }
+  if (xs) drawCircleSpans(x0, y0, xs, x, y, cornername, color);
+}
+
+// Draw the points xs..xe at height y of the octant walked by
+// drawCircleHelper(), and their mirror images, in the given corners
+void Adafruit_GFX::drawCircleSpans(int16_t x0, int16_t y0, int16_t xs,
+    int16_t xe, int16_t y, uint8_t cornername, uint16_t color) {
+  int16_t n = xe - xs + 1;
+
+  if (cornername & 0x4) {
+    drawFastHLine(x0 + xs, y0 + y, n, color);
+    drawFastVLine(x0 + y, y0 + xs, n, color);
+  }
+  if (cornername & 0x2) {
+    drawFastHLine(x0 + xs, y0 - y, n, color);
+    drawFastVLine(x0 + y, y0 - xe, n, color);
+  }
+  if (cornername & 0x8) {
+    drawFastVLine(x0 - y, y0 + xs, n, color);
+    drawFastHLine(x0 - xe, y0 + y, n, color);
+  }
+  if (cornername & 0x1) {
+    drawFastVLine(x0 - y, y0 - xe, n, color);
+    drawFastHLine(x0 - xe, y0 - y, n, color);
   }
 }
 
@@ -170,9 +158,21 @@ void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
 }
 
 // Bresenham's algorithm - thx wikpedia
+// Points on the same row (column when steep) are drawn as one fast line.
 void Adafruit_GFX::drawLine(int16_t x0, int16_t y0,
 			    int16_t x1, int16_t y1,
 			    uint16_t color) {
+  if (x0 == x1) {
+    if (y0 > y1) swap(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    return;
+  }
+  if (y0 == y1) {
+    if (x0 > x1) swap(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    return;
+  }
+
   int16_t steep = abs(y1 - y0) > abs(x1 - x0);
   if (steep) {
     swap(x0, y0);
@@ -197,16 +197,20 @@ void Adafruit_GFX::drawLine(int16_t x0, int16_t y0,
     ystep = -1;
   }
 
+  int16_t xs = x0; // first point of the current run
   for (; x0<=x1; x0++) {
-    if (steep) {
-      drawPixel(y0, x0, color);
-    } else {
-      drawPixel(x0, y0, color);
-    }
     err -= dy;
-    if (err < 0) {
-      y0 += ystep;
-      err += dx;
+    if ((err < 0) || (x0 == x1)) {
+      if (steep) {
+        drawFastVLine(y0, xs, x0 - xs + 1, color);
+      } else {
+        drawFastHLine(xs, y0, x0 - xs + 1, color);
+      }
+      xs = x0 + 1;
+      if (err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
     }
   }
 }
@@ -224,13 +228,18 @@ void Adafruit_GFX::drawRect(int16_t x, int16_t y,
 void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y,
 				 int16_t h, uint16_t color) {
   // Update in subclasses if desired!
-  drawLine(x, y, x, y+h-1, color);
+  // (not drawLine(), which draws its spans with this)
+  for (int16_t i=y; i<y+h; i++) {
+    drawPixel(x, i, color);
+  }
 }
 
 void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y,
 				 int16_t w, uint16_t color) {
   // Update in subclasses if desired!
-  drawLine(x, y, x+w-1, y, color);
+  for (int16_t i=x; i<x+w; i++) {
+    drawPixel(i, y, color);
+  }
 }
 
 void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
@@ -419,10 +428,20 @@ size_t Adafruit_GFX::write(uint8_t c) {
 void Adafruit_GFX::write(uint8_t c) {
 #endif
   if (c == '\n') {
-    cursor_y += textsize*8;
+    cursor_y += runFont ? runFont->yAdvance : textsize*8;
     cursor_x  = 0;
   } else if (c == '\r') {
     // skip em
+  } else if (runFont) {
+    const RunGlyph *g = runGlyph(c);
+    if (g) {
+      if (wrap && (cursor_x + g->xAdvance > _width)) {
+        cursor_y += runFont->yAdvance;
+        cursor_x = 0;
+      }
+      drawRunChar(cursor_x, cursor_y, c, textcolor, textbgcolor);
+      cursor_x += g->xAdvance;
+    }
   } else {
     drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
     cursor_x += textsize*6;
@@ -436,6 +455,88 @@ void Adafruit_GFX::write(uint8_t c) {
 #endif
 }
 
+// Column i (0-5) of the 5x7 font glyph for c, LSB at the top.
+// Column 5 is the blank spacing column.
+uint8_t Adafruit_GFX::glyphColumn(unsigned char c, uint8_t i) {
+  if (i >= 5) return 0x0;
+  return pgm_read_byte(font+(c*5)+i);
+}
+
+// Glyph for c in the current run font, NULL if the font has none
+const RunGlyph *Adafruit_GFX::runGlyph(unsigned char c) const {
+  if (!runFont || (c < runFont->first) || (c > runFont->last)) return NULL;
+  return &runFont->glyphs[c - runFont->first];
+}
+
+// Draw a character of the current run font in the cell with its top left
+// corner at x,y. Each run of set pixels is one horizontal line, split
+// where it continues onto the next row of the glyph.
+void Adafruit_GFX::drawRunChar(int16_t x, int16_t y, unsigned char c,
+  uint16_t color, uint16_t bg) {
+  const RunGlyph *g = runGlyph(c);
+  if (!g) return;
+
+  if (bg != color) fillRect(x, y, g->xAdvance, runFont->yAdvance, bg);
+
+  const uint8_t *p = runFont->runs + g->offset;
+  int16_t x0 = x + g->xOffset;
+  int16_t y0 = y + runFont->ascent + g->yOffset;
+  int16_t gx = 0, gy = 0;
+  while (gy < g->height) {
+    uint8_t fg = *p & 0xF;
+    gx += *p++ >> 4;
+    while (gx >= g->width) {
+      gx -= g->width;
+      gy++;
+    }
+    while (fg > 0) {
+      int16_t n = g->width - gx;
+      if (n > fg) n = fg;
+      drawFastHLine(x0 + gx, y0 + gy, n, color);
+      fg -= n;
+      gx += n;
+      if (gx == g->width) {
+        gx = 0;
+        gy++;
+      }
+    }
+  }
+}
+
+// Draw a run length encoded sprite with its top left corner at x,y.
+// Each run of one color is one horizontal line, split where it continues
+// onto the next row; the pixels of literal runs are drawn one by one.
+void Adafruit_GFX::drawSprite(int16_t x, int16_t y, const RunSprite *sprite) {
+  const uint8_t *p = sprite->runs;
+  int16_t sx = 0, sy = 0;
+  while (sy < sprite->height) {
+    uint8_t n = (*p & ~RUNSPRITE_LITERAL) + 1;
+    if (*p++ & RUNSPRITE_LITERAL) {
+      for ( ; n > 0; n--, p += 2) {
+        drawPixel(x + sx, y + sy, (p[0] << 8) | p[1]);
+        if (++sx == sprite->width) {
+          sx = 0;
+          sy++;
+        }
+      }
+    } else {
+      uint16_t color = (p[0] << 8) | p[1];
+      p += 2;
+      while (n > 0) {
+        int16_t w = sprite->width - sx;
+        if (w > n) w = n;
+        drawFastHLine(x + sx, y + sy, w, color);
+        n -= w;
+        sx += w;
+        if (sx == sprite->width) {
+          sx = 0;
+          sy++;
+        }
+      }
+    }
+  }
+}
+
 // Draw a character
 void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 			    uint16_t color, uint16_t bg, uint8_t size) {
@@ -448,27 +549,23 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
 
   if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
 
+  // Each font byte is one column, LSB at the top. Draw every vertical run
+  // of equal dots as one rectangle rather than a rectangle per dot.
   for (int8_t i=0; i<6; i++ ) {
-    uint8_t line;
-    if (i == 5) 
-      line = 0x0;
-    else 
-      line = pgm_read_byte(font+(c*5)+i);
-    for (int8_t j = 0; j<8; j++) {
-      if (line & 0x1) {
-        if (size == 1) // default size
-          drawPixel(x+i, y+j, color);
-        else {  // big size
-          fillRect(x+(i*size), y+(j*size), size, size, color);
-        } 
-      } else if (bg != color) {
-        if (size == 1) // default size
-          drawPixel(x+i, y+j, bg);
-        else {  // big size
-          fillRect(x+i*size, y+j*size, size, size, bg);
-        }
+    uint8_t line = glyphColumn(c, i);
+    int8_t j = 0;
+    while (j < 8) {
+      uint8_t on = line & 0x1;
+      int8_t run = 0;
+      while ((j + run < 8) && ((line & 0x1) == on)) {
+        line >>= 1;
+        run++;
       }
-      line >>= 1;
+      if (on)
+        fillRect(x+i*size, y+j*size, size, run*size, color);
+      else if (bg != color)
+        fillRect(x+i*size, y+j*size, size, run*size, bg);
+      j += run;
     }
   }
 }
@@ -505,6 +602,13 @@ void Adafruit_GFX::setTextWrap(boolean w) {
   wrap = w;
 }
 
+// Draw text in a run font from Tools/fontGen.cpp, or NULL for the built in
+// 5x7 font. Run fonts ignore the text size and the cursor is the top left
+// corner of the character cell for both.
+void Adafruit_GFX::setFont(const RunFont *f) {
+  runFont = f;
+}
+
 uint8_t Adafruit_GFX::getRotation(void) const {
   return rotation;
 }
@@ -598,9 +702,10 @@ void Adafruit_GFX_Button::initButton(Adafruit_GFX *gfx,
    _gfx->setCursor(_x - strlen(_label)*3*_textsize, _y-4*_textsize);
    _gfx->setTextColor(text);
    _gfx->setTextSize(_textsize);
-   //_gfx->print(_label);
-   PrintToLcdWithBuf(buttonBuf, BUTTONBUFSIZE, _label);
-   //while(1); // Need to implement print
+   // No Print class here, so write the label to the button's own display
+   for (const char *p = _label; *p; p++) {
+     _gfx->write(*p);
+   }
  }
 
 boolean Adafruit_GFX_Button::contains(int16_t x, int16_t y) {
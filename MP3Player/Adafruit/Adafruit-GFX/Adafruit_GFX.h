@@ -4,6 +4,8 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
+#include "runfont.h"
+#include "runsprite.h"
 
 #define boolean bool
 
@@ -27,7 +29,12 @@ class Adafruit_GFX {
     drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
     fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
     fillScreen(uint16_t color),
-    invertDisplay(boolean i);
+    invertDisplay(boolean i),
+    drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+      uint16_t bg, uint8_t size),
+    drawRunChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+      uint16_t bg),
+    drawSprite(int16_t x, int16_t y, const RunSprite *sprite);
 
   // These exist only with Adafruit_GFX (no subclass overrides)
   void
@@ -51,13 +58,12 @@ class Adafruit_GFX {
       int16_t w, int16_t h, uint16_t color, uint16_t bg),
     drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap, 
       int16_t w, int16_t h, uint16_t color),
-    drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
-      uint16_t bg, uint8_t size),
     setCursor(int16_t x, int16_t y),
     setTextColor(uint16_t c),
     setTextColor(uint16_t c, uint16_t bg),
     setTextSize(uint8_t s),
     setTextWrap(boolean w),
+    setFont(const RunFont *f),
     setRotation(uint8_t r),
     cp437(boolean x=true);
 
@@ -77,6 +83,11 @@ class Adafruit_GFX {
   int16_t getCursorY(void) const;
 
  protected:
+  static uint8_t glyphColumn(unsigned char c, uint8_t i);
+  void drawCircleSpans(int16_t x0, int16_t y0, int16_t xs, int16_t xe,
+    int16_t y, uint8_t cornername, uint16_t color);
+  const RunGlyph *runGlyph(unsigned char c) const;
+
   const int16_t
     WIDTH, HEIGHT;   // This is the 'raw' display w/h - never changes
   int16_t
@@ -90,6 +101,8 @@ class Adafruit_GFX {
   boolean
     wrap,   // If set, 'wrap' text at right edge of display
     _cp437; // If set, use correct CP437 charset (default is off)
+  const RunFont
+    *runFont; // If set, text is drawn in this font instead of the 5x7 one
 };
 
 class Adafruit_GFX_Button {
@@ -0,0 +1,195 @@
+/*
+    dejaVuSansBold16.c
+    DejaVu Sans Bold at 16 pixels, characters 0x20 to 0x7e.
+    Generated by Tools/fontGen.cpp, do not edit.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "dejaVuSansBold16.h"
+
+static const uint8_t dejaVuSansBold16Runs[1235] = {
+    0x0f, 0x01, 0x26, 0x02, 0x24, 0x24, 0x24, 0x22, 0x42, 0x22, 0x52, 0x21, 0x61, 0x22, 0x3a, 0x1a, 
+    0x32, 0x21, 0x61, 0x22, 0x3a, 0x1a, 0x32, 0x21, 0x61, 0x22, 0x61, 0x22, 0x40, 0x31, 0x61, 0x44, 
+    0x26, 0x12, 0x11, 0x11, 0x12, 0x11, 0x35, 0x45, 0x31, 0x13, 0x21, 0x19, 0x15, 0x41, 0x61, 0x30, 
+    0x14, 0x52, 0x32, 0x22, 0x33, 0x32, 0x22, 0x32, 0x42, 0x22, 0x22, 0x52, 0x22, 0x13, 0x64, 0x22, 
+    0xc2, 0x24, 0x63, 0x12, 0x22, 0x52, 0x22, 0x22, 0x42, 0x32, 0x22, 0x33, 0x32, 0x22, 0x32, 0x54, 
+    0x10, 0x35, 0x67, 0x52, 0x41, 0x52, 0xa3, 0x85, 0x32, 0x13, 0x14, 0x12, 0x12, 0x45, 0x12, 0x53, 
+    0x23, 0x34, 0x3a, 0x36, 0x13, 0x08, 0x22, 0x12, 0x22, 0x13, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 
+    0x23, 0x22, 0x22, 0x32, 0x02, 0x32, 0x22, 0x23, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x12, 
+    0x22, 0x12, 0x20, 0x31, 0x31, 0x21, 0x21, 0x15, 0x33, 0x35, 0x11, 0x21, 0x21, 0x31, 0x30, 0x42, 
+    0x82, 0x82, 0x82, 0x4f, 0x05, 0x42, 0x82, 0x82, 0x82, 0x40, 0x12, 0x12, 0x12, 0x14, 0x10, 0x0a, 
+    0x06, 0x42, 0x42, 0x32, 0x42, 0x42, 0x32, 0x42, 0x42, 0x32, 0x42, 0x42, 0x32, 0x42, 0x40, 0x25, 
+    0x37, 0x22, 0x32, 0x12, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x12, 0x32, 0x27, 0x35, 0x20, 0x14, 
+    0x35, 0x32, 0x12, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x3f, 0x01, 0x15, 0x27, 0x11, 0x43, 
+    0x62, 0x62, 0x53, 0x43, 0x43, 0x43, 0x43, 0x4f, 0x01, 0x16, 0x2a, 0x62, 0x72, 0x26, 0x36, 0x73, 
+    0x72, 0x73, 0x5b, 0x26, 0x20, 0x44, 0x64, 0x52, 0x12, 0x43, 0x12, 0x42, 0x22, 0x33, 0x22, 0x32, 
+    0x32, 0x22, 0x42, 0x2f, 0x05, 0x62, 0x82, 0x20, 0x08, 0x18, 0x12, 0x72, 0x77, 0x28, 0x11, 0x53, 
+    0x72, 0x73, 0x5b, 0x26, 0x20, 0x34, 0x37, 0x22, 0x41, 0x12, 0x77, 0x28, 0x13, 0x35, 0x54, 0x52, 
+    0x12, 0x33, 0x17, 0x35, 0x20, 0x0f, 0x03, 0x63, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 
+    0x63, 0x40, 0x17, 0x1b, 0x54, 0x52, 0x17, 0x27, 0x13, 0x35, 0x54, 0x55, 0x33, 0x17, 0x35, 0x20, 
+    0x25, 0x37, 0x13, 0x32, 0x12, 0x54, 0x55, 0x33, 0x18, 0x27, 0x72, 0x11, 0x42, 0x27, 0x34, 0x30, 
+    0x06, 0x66, 0x12, 0x12, 0x12, 0xa2, 0x12, 0x12, 0x14, 0x10, 0x91, 0x64, 0x35, 0x25, 0x52, 0x85, 
+    0x85, 0x84, 0x91, 0x0f, 0x05, 0xf0, 0x5f, 0x05, 0x01, 0x94, 0x85, 0x85, 0x82, 0x55, 0x25, 0x34, 
+    0x61, 0x90, 0x15, 0x18, 0x42, 0x52, 0x43, 0x33, 0x33, 0x42, 0xc2, 0x52, 0x52, 0x30, 0x46, 0x72, 
+    0x52, 0x41, 0x82, 0x21, 0x36, 0x11, 0x12, 0x22, 0x23, 0x22, 0x22, 0x42, 0x22, 0x22, 0x42, 0x22, 
+    0x22, 0x42, 0x22, 0x22, 0x42, 0x23, 0x22, 0x23, 0x11, 0x21, 0x37, 0x41, 0xe2, 0x52, 0x76, 0x30, 
+    0x44, 0x84, 0x84, 0x72, 0x22, 0x62, 0x22, 0x53, 0x23, 0x42, 0x42, 0x48, 0x3a, 0x22, 0x62, 0x22, 
+    0x62, 0x12, 0x82, 0x08, 0x2c, 0x55, 0x64, 0x5c, 0x19, 0x12, 0x64, 0x64, 0x6f, 0x05, 0x20, 0x36, 
+    0x38, 0x13, 0x54, 0x72, 0x82, 0x82, 0x82, 0x83, 0x83, 0x51, 0x28, 0x36, 0x10, 0x07, 0x49, 0x22, 
+    0x53, 0x12, 0x65, 0x74, 0x74, 0x74, 0x74, 0x65, 0x53, 0x19, 0x27, 0x40, 0x0f, 0x03, 0x62, 0x62, 
+    0x6f, 0x03, 0x62, 0x62, 0x6f, 0x01, 0x0f, 0x03, 0x62, 0x62, 0x6f, 0x03, 0x62, 0x62, 0x62, 0x62, 
+    0x60, 0x36, 0x48, 0x23, 0x51, 0x13, 0x82, 0x92, 0x92, 0x56, 0x57, 0x62, 0x13, 0x52, 0x29, 0x37, 
+    0x10, 0x02, 0x64, 0x64, 0x64, 0x64, 0x6f, 0x09, 0x64, 0x64, 0x64, 0x64, 0x62, 0x0f, 0x09, 0x22, 
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0x13, 0x10, 0x02, 0x52, 
+    0x12, 0x42, 0x22, 0x32, 0x32, 0x22, 0x42, 0x12, 0x54, 0x62, 0x12, 0x52, 0x22, 0x42, 0x32, 0x32, 
+    0x42, 0x22, 0x52, 0x12, 0x62, 0x02, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6f, 
+    0x01, 0x03, 0x76, 0x77, 0x58, 0x56, 0x12, 0x32, 0x14, 0x12, 0x32, 0x14, 0x22, 0x12, 0x24, 0x22, 
+    0x12, 0x24, 0x33, 0x34, 0x33, 0x34, 0x94, 0x92, 0x03, 0x56, 0x46, 0x47, 0x34, 0x12, 0x34, 0x22, 
+    0x24, 0x22, 0x24, 0x32, 0x14, 0x37, 0x46, 0x46, 0x53, 0x36, 0x58, 0x33, 0x43, 0x13, 0x65, 0x84, 
+    0x84, 0x84, 0x85, 0x63, 0x13, 0x43, 0x38, 0x56, 0x30, 0x08, 0x29, 0x12, 0x55, 0x64, 0x64, 0x5c, 
+    0x18, 0x22, 0x82, 0x82, 0x82, 0x80, 0x36, 0x58, 0x33, 0x43, 0x13, 0x65, 0x84, 0x84, 0x84, 0x85, 
+    0x63, 0x13, 0x43, 0x38, 0x56, 0xa3, 0xa3, 0x10, 0x08, 0x29, 0x12, 0x52, 0x12, 0x52, 0x12, 0x52, 
+    0x18, 0x28, 0x22, 0x43, 0x12, 0x52, 0x12, 0x52, 0x12, 0x55, 0x62, 0x26, 0x27, 0x12, 0x51, 0x12, 
+    0x74, 0x65, 0x65, 0x64, 0x73, 0x6a, 0x26, 0x20, 0x0f, 0x05, 0x42, 0x82, 0x82, 0x82, 0x82, 0x82, 
+    0x82, 0x82, 0x82, 0x82, 0x40, 0x02, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x43, 
+    0x18, 0x36, 0x20, 0x02, 0x82, 0x12, 0x62, 0x22, 0x62, 0x22, 0x62, 0x32, 0x42, 0x42, 0x42, 0x42, 
+    0x42, 0x52, 0x22, 0x62, 0x22, 0x62, 0x22, 0x74, 0x84, 0x40, 0x02, 0x53, 0x54, 0x53, 0x52, 0x12, 
+    0x35, 0x32, 0x22, 0x32, 0x12, 0x32, 0x22, 0x32, 0x12, 0x32, 0x22, 0x32, 0x12, 0x32, 0x32, 0x12, 
+    0x32, 0x12, 0x42, 0x12, 0x32, 0x12, 0x42, 0x12, 0x32, 0x12, 0x42, 0x12, 0x32, 0x12, 0x53, 0x53, 
+    0x63, 0x53, 0x30, 0x03, 0x63, 0x12, 0x62, 0x32, 0x42, 0x43, 0x23, 0x56, 0x74, 0x84, 0x72, 0x22, 
+    0x53, 0x23, 0x42, 0x42, 0x32, 0x62, 0x13, 0x63, 0x03, 0x43, 0x12, 0x42, 0x23, 0x23, 0x32, 0x22, 
+    0x54, 0x64, 0x72, 0x82, 0x82, 0x82, 0x82, 0x82, 0x40, 0x0f, 0x05, 0x72, 0x73, 0x63, 0x63, 0x63, 
+    0x63, 0x63, 0x72, 0x7f, 0x05, 0x0a, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 
+    0x02, 0x42, 0x52, 0x42, 0x42, 0x52, 0x42, 0x42, 0x52, 0x42, 0x42, 0x52, 0x42, 0x08, 0x22, 0x22, 
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2a, 0x32, 0x54, 0x32, 0x22, 0x12, 0x42, 0x08, 0x02, 
+    0x32, 0x32, 0x25, 0x27, 0x62, 0x1f, 0x02, 0x44, 0x3b, 0x14, 0x12, 0x02, 0x72, 0x72, 0x72, 0x14, 
+    0x28, 0x13, 0x35, 0x54, 0x54, 0x55, 0x3b, 0x12, 0x14, 0x20, 0x25, 0x2a, 0x43, 0x62, 0x62, 0x63, 
+    0x41, 0x17, 0x25, 0x10, 0x72, 0x72, 0x72, 0x24, 0x12, 0x1b, 0x35, 0x54, 0x54, 0x55, 0x33, 0x18, 
+    0x24, 0x12, 0x25, 0x37, 0x12, 0x5f, 0x07, 0x73, 0x51, 0x18, 0x26, 0x10, 0x24, 0x15, 0x12, 0x35, 
+    0x15, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x30, 0x24, 0x12, 0x1b, 0x35, 0x54, 0x54, 0x55, 
+    0x33, 0x18, 0x24, 0x12, 0x11, 0x43, 0x17, 0x35, 0x20, 0x02, 0x72, 0x72, 0x72, 0x15, 0x1c, 0x44, 
+    0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x04, 0x2f, 0x03, 0x22, 0x22, 0x62, 0x22, 0x22, 0x22, 0x22, 
+    0x22, 0x22, 0x22, 0x22, 0x29, 0x10, 0x02, 0x72, 0x72, 0x72, 0x45, 0x33, 0x12, 0x23, 0x22, 0x13, 
+    0x35, 0x42, 0x13, 0x32, 0x23, 0x22, 0x33, 0x12, 0x43, 0x0f, 0x09, 0x02, 0x14, 0x24, 0x1f, 0x02, 
+    0x33, 0x34, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x44, 0x42, 0x42, 0x02, 0x15, 
+    0x1c, 0x44, 0x54, 0x54, 0x54, 0x54, 0x54, 0x52, 0x25, 0x37, 0x13, 0x35, 0x54, 0x54, 0x55, 0x33, 
+    0x17, 0x35, 0x20, 0x02, 0x14, 0x28, 0x13, 0x35, 0x54, 0x54, 0x55, 0x3b, 0x12, 0x14, 0x22, 0x72, 
+    0x72, 0x70, 0x24, 0x12, 0x1b, 0x35, 0x54, 0x54, 0x55, 0x33, 0x18, 0x24, 0x12, 0x72, 0x72, 0x72, 
+    0x02, 0x2d, 0x42, 0x52, 0x52, 0x52, 0x52, 0x52, 0x50, 0x16, 0x1a, 0x56, 0x46, 0x64, 0x5a, 0x16, 
+    0x10, 0x12, 0x42, 0x3c, 0x12, 0x42, 0x42, 0x42, 0x42, 0x45, 0x24, 0x02, 0x54, 0x54, 0x54, 0x54, 
+    0x54, 0x54, 0x4c, 0x15, 0x12, 0x02, 0x62, 0x12, 0x42, 0x22, 0x42, 0x22, 0x42, 0x32, 0x22, 0x42, 
+    0x22, 0x54, 0x64, 0x64, 0x30, 0x02, 0x41, 0x44, 0x33, 0x32, 0x12, 0x23, 0x22, 0x22, 0x21, 0x11, 
+    0x22, 0x22, 0x12, 0x12, 0x12, 0x22, 0x12, 0x12, 0x12, 0x31, 0x11, 0x31, 0x11, 0x43, 0x33, 0x43, 
+    0x33, 0x20, 0x03, 0x43, 0x12, 0x42, 0x32, 0x22, 0x54, 0x64, 0x64, 0x52, 0x22, 0x32, 0x42, 0x13, 
+    0x43, 0x02, 0x62, 0x12, 0x42, 0x22, 0x42, 0x32, 0x32, 0x32, 0x22, 0x42, 0x22, 0x54, 0x64, 0x73, 
+    0x72, 0x55, 0x54, 0x50, 0x0f, 0x01, 0x52, 0x52, 0x52, 0x52, 0x52, 0x5f, 0x01, 0x33, 0x24, 0x22, 
+    0x42, 0x42, 0x42, 0x42, 0x24, 0x24, 0x42, 0x42, 0x42, 0x42, 0x44, 0x33, 0x0f, 0x0f, 0x02, 0x03, 
+    0x34, 0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x24, 0x22, 0x42, 0x42, 0x42, 0x24, 0x23, 0x30, 0x14, 
+    0x4c, 0x44, 0x10
+};
+
+static const RunGlyph dejaVuSansBold16Glyphs[95] = {
+    // offset, width, height, xAdvance, xOffset, yOffset
+    {     0,  0,  0,  6,  0,   0 }, // 0x20 ' '
+    {     0,  2, 12,  7,  2, -12 }, // 0x21 '!'
+    {     3,  6,  4,  8,  1, -12 }, // 0x22 '"'
+    {     8, 11, 12, 13,  1, -12 }, // 0x23 '#'
+    {    29,  7, 14, 11,  3, -12 }, // 0x24 '$'
+    {    48, 15, 12, 16,  1, -12 }, // 0x25 '%'
+    {    81, 12, 12, 14,  1, -12 }, // 0x26 '&'
+    {   101,  2,  4,  5,  1, -12 }, // 0x27 '''
+    {   102,  4, 14,  7,  1, -12 }, // 0x28 '('
+    {   116,  4, 14,  7,  1, -12 }, // 0x29 ')'
+    {   131,  7,  7,  8,  1, -12 }, // 0x2a '*'
+    {   143, 10, 10, 13,  2, -10 }, // 0x2b '+'
+    {   154,  3,  5,  6,  0,  -3 }, // 0x2c ','
+    {   159,  5,  2,  7,  1,  -6 }, // 0x2d '-'
+    {   160,  2,  3,  6,  1,  -3 }, // 0x2e '.'
+    {   161,  6, 13,  6,  0, -12 }, // 0x2f '/'
+    {   175,  9, 12, 11,  1, -12 }, // 0x30 '0'
+    {   191,  8, 12, 11,  2, -12 }, // 0x31 '1'
+    {   204,  8, 12, 11,  1, -12 }, // 0x32 '2'
+    {   217,  9, 12, 11,  1, -12 }, // 0x33 '3'
+    {   229, 10, 12, 11,  1, -12 }, // 0x34 '4'
+    {   248,  9, 12, 11,  1, -12 }, // 0x35 '5'
+    {   261,  9, 12, 11,  1, -12 }, // 0x36 '6'
+    {   277,  9, 12, 11,  1, -12 }, // 0x37 '7'
+    {   290,  9, 12, 11,  1, -12 }, // 0x38 '8'
+    {   304,  9, 12, 11,  1, -12 }, // 0x39 '9'
+    {   320,  2,  9,  6,  1,  -9 }, // 0x3a ':'
+    {   322,  3, 11,  6,  0,  -9 }, // 0x3b ';'
+    {   330, 10,  9, 13,  2, -10 }, // 0x3c '<'
+    {   339, 10,  6, 13,  2,  -8 }, // 0x3d '='
+    {   344, 10,  9, 13,  2, -10 }, // 0x3e '>'
+    {   354,  7, 12,  9,  1, -12 }, // 0x3f '?'
+    {   366, 14, 14, 16,  1, -12 }, // 0x40 '@'
+    {   400, 12, 12, 12,  0, -12 }, // 0x41 'A'
+    {   419, 10, 12, 12,  1, -12 }, // 0x42 'B'
+    {   431, 10, 12, 12,  1, -12 }, // 0x43 'C'
+    {   445, 11, 12, 13,  1, -12 }, // 0x44 'D'
+    {   460,  8, 12, 10,  1, -12 }, // 0x45 'E'
+    {   470,  8, 12, 10,  1, -12 }, // 0x46 'F'
+    {   481, 11, 12, 13,  1, -12 }, // 0x47 'G'
+    {   497, 10, 12, 12,  1, -12 }, // 0x48 'H'
+    {   509,  2, 12,  6,  2, -12 }, // 0x49 'I'
+    {   511,  4, 15,  6,  0, -12 }, // 0x4a 'J'
+    {   526, 10, 12, 11,  1, -12 }, // 0x4b 'K'
+    {   549,  8, 12, 10,  1, -12 }, // 0x4c 'L'
+    {   561, 13, 12, 16,  1, -12 }, // 0x4d 'M'
+    {   584, 10, 12, 13,  1, -12 }, // 0x4e 'N'
+    {   601, 12, 12, 14,  1, -12 }, // 0x4f 'O'
+    {   617, 10, 12, 12,  1, -12 }, // 0x50 'P'
+    {   630, 12, 14, 14,  1, -12 }, // 0x51 'Q'
+    {   648, 10, 12, 12,  1, -12 }, // 0x52 'R'
+    {   667,  9, 12, 11,  1, -12 }, // 0x53 'S'
+    {   680, 10, 12, 11,  0, -12 }, // 0x54 'T'
+    {   693, 10, 12, 12,  1, -12 }, // 0x55 'U'
+    {   707, 12, 12, 12,  0, -12 }, // 0x56 'V'
+    {   730, 17, 12, 18,  0, -12 }, // 0x57 'W'
+    {   771, 12, 12, 12,  0, -12 }, // 0x58 'X'
+    {   792, 10, 12, 12,  0, -12 }, // 0x59 'Y'
+    {   809, 10, 12, 12,  1, -12 }, // 0x5a 'Z'
+    {   821,  4, 14,  7,  1, -12 }, // 0x5b '['
+    {   832,  6, 13,  6,  0, -12 }, // 0x5c '\'
+    {   845,  4, 14,  7,  1, -12 }, // 0x5d ']'
+    {   856,  8,  4, 13,  3, -12 }, // 0x5e '^'
+    {   862,  8,  1,  8,  0,   3 }, // 0x5f '_'
+    {   863,  4,  3,  8,  1, -13 }, // 0x60 '`'
+    {   866,  8,  9, 10,  1,  -9 }, // 0x61 'a'
+    {   875,  9, 12, 11,  1, -12 }, // 0x62 'b'
+    {   890,  8,  9, 10,  1,  -9 }, // 0x63 'c'
+    {   900,  9, 12, 11,  1, -12 }, // 0x64 'd'
+    {   914,  9,  9, 11,  1,  -9 }, // 0x65 'e'
+    {   924,  6, 12,  7,  1, -12 }, // 0x66 'f'
+    {   937,  9, 12, 11,  1,  -9 }, // 0x67 'g'
+    {   953,  9, 12, 11,  1, -12 }, // 0x68 'h'
+    {   966,  2, 12,  4,  1, -12 }, // 0x69 'i'
+    {   969,  4, 15,  4, -1, -12 }, // 0x6a 'j'
+    {   982,  9, 12, 11,  1, -12 }, // 0x6b 'k'
+    {  1001,  2, 12,  4,  1, -12 }, // 0x6c 'l'
+    {  1003, 14,  9, 16,  1,  -9 }, // 0x6d 'm'
+    {  1022,  9,  9, 11,  1,  -9 }, // 0x6e 'n'
+    {  1032,  9,  9, 11,  1,  -9 }, // 0x6f 'o'
+    {  1043,  9, 12, 11,  1,  -9 }, // 0x70 'p'
+    {  1058,  9, 12, 11,  1,  -9 }, // 0x71 'q'
+    {  1072,  7,  9,  8,  1,  -9 }, // 0x72 'r'
+    {  1081,  8,  9, 10,  1,  -9 }, // 0x73 's'
+    {  1089,  6, 11,  8,  1, -11 }, // 0x74 't'
+    {  1099,  9,  9, 11,  1,  -9 }, // 0x75 'u'
+    {  1109, 10,  9, 10,  0,  -9 }, // 0x76 'v'
+    {  1125, 13,  9, 15,  1,  -9 }, // 0x77 'w'
+    {  1154, 10,  9, 10,  0,  -9 }, // 0x78 'x'
+    {  1169, 10, 12, 10,  0,  -9 }, // 0x79 'y'
+    {  1188,  8,  9,  9,  1,  -9 }, // 0x7a 'z'
+    {  1197,  6, 15, 11,  2, -12 }, // 0x7b '{'
+    {  1212,  2, 16,  6,  2, -12 }, // 0x7c '|'
+    {  1215,  6, 15, 11,  2, -12 }, // 0x7d '}'
+    {  1231, 10,  3, 13,  2,  -6 }  // 0x7e '~'
+};
+
+const RunFont dejaVuSansBold16 = {
+    dejaVuSansBold16Runs,
+    dejaVuSansBold16Glyphs,
+    0x20, 0x7e, 17, 13
+};
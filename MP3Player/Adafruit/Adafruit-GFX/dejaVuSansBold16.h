@@ -0,0 +1,15 @@
+/*
+    dejaVuSansBold16.h
+    16 pixel run length font generated by Tools/fontGen.cpp.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __DEJAVUSANSBOLD16_H__
+#define __DEJAVUSANSBOLD16_H__
+
+#include "runfont.h"
+
+extern const RunFont dejaVuSansBold16;
+
+#endif
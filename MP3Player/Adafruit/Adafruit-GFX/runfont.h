@@ -0,0 +1,33 @@
+/*
+    runfont.h
+    Proportional fonts stored as horizontal runs, for Adafruit_GFX::setFont().
+    Font sources are generated from TrueType or BDF fonts by Tools/fontGen.cpp,
+    which describes the run encoding.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef _RUNFONT_H_
+#define _RUNFONT_H_
+
+#include <stdint.h>
+
+typedef struct {
+  uint16_t offset;    // index of the glyph's first byte in RunFont.runs
+  uint8_t  width;     // bounding box of the set pixels
+  uint8_t  height;
+  uint8_t  xAdvance;  // cursor step to the next character
+  int8_t   xOffset;   // box position relative to the cursor
+  int8_t   yOffset;   //   and to the baseline, negative is up
+} RunGlyph;
+
+typedef struct {
+  const uint8_t  *runs;    // the glyph rows, see Tools/fontGen.cpp
+  const RunGlyph *glyphs;  // one per character, first to last
+  uint8_t first;
+  uint8_t last;
+  uint8_t yAdvance;        // line height, each character cell is xAdvance by yAdvance
+  uint8_t ascent;          // baseline position in the cell
+} RunFont;
+
+#endif // _RUNFONT_H_
@@ -0,0 +1,31 @@
+/*
+    runsprite.h
+    Run length encoded RGB565 images, for Adafruit_GFX::drawSprite().
+    Sprite sources are generated from PNG files by Tools/spriteGen.cpp,
+    which packs several into one atlas of runs.
+
+    The pixels are one stream, row after row, with runs continuing from
+    the end of one row onto the next. Each run starts with a byte n:
+        n < 0x80    n + 1 pixels of the one color that follows
+        n >= 0x80   (n & 0x7F) + 1 pixels, each color following in turn
+    Colors are two bytes, high byte first, the order the ILI9341 takes
+    them in. Sprites are opaque.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef _RUNSPRITE_H_
+#define _RUNSPRITE_H_
+
+#include <stdint.h>
+
+#define RUNSPRITE_LITERAL   0x80  // set in a run's first byte if its colors all follow
+#define RUNSPRITE_RUN_MAX   128   // pixels in one run
+
+typedef struct {
+  const uint8_t *runs;  // the sprite's first run, in its atlas
+  uint16_t width;
+  uint16_t height;
+} RunSprite;
+
+#endif // _RUNSPRITE_H_
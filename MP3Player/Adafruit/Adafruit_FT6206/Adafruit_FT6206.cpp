@@ -15,6 +15,7 @@
  ****************************************************/
 
 
+#include <string.h>
 #include <Adafruit_FT6206.h>
 #include "bspI2c.h"
 
@@ -56,6 +57,10 @@ boolean Adafruit_FT6206::begin(uint8_t threshhold) {
   
   if ((readRegister8(FT6206_REG_VENDID) != 17) || (readRegister8(FT6206_REG_CHIPID) != 6)) 
     return false;
+
+  // Hold INT low for as long as the panel is touched, so that a task
+  // woken by its falling edge can tell from the line when the touch ends
+  writeRegister8(FT6206_REG_GMODE, FT6206_GMODE_POLLING);
   /* 
   Serial.print("Vend ID: "); Serial.println(readRegister8(FT6206_REG_VENDID));
   Serial.print("Chip ID: "); Serial.println(readRegister8(FT6206_REG_CHIPID));
@@ -183,6 +188,53 @@ void Adafruit_FT6206::readData(uint16_t *x, uint16_t *y) {
     *x = touchX[0]; *y = touchY[0];
 }
 
+/**************************************************************************/
+/*! 
+    @brief  Reads the touch count and both touch points in one burst.
+            touched() followed by getPoint() costs two register pointer
+            writes and two reads; this is one of each, so call it alone
+            for each sample.
+    @param  sample receives the sample; points past touches are zeroed
+    @return true if the panel is touched
+*/
+/**************************************************************************/
+boolean Adafruit_FT6206::readSample(FT6206Sample *sample) {
+  
+  INT32U cpu_sr;
+  
+  uint8_t i2cdat[FT6206_SAMPLE_BYTES];
+  uint32_t numBytes;
+  
+  i2cdat[0] = FT6206_ADDR<<1;
+  i2cdat[1] = FT6206_REG_MODE;
+  numBytes = 1;
+  
+  OS_ENTER_CRITICAL();
+  Write(hI2c1, (void*)i2cdat, &numBytes);
+  
+  numBytes = FT6206_SAMPLE_BYTES;
+  Read(hI2c1, (void*)i2cdat, &numBytes);
+  OS_EXIT_CRITICAL();
+
+  memset(sample, 0, sizeof(*sample));
+  sample->gesture = i2cdat[FT6206_REG_GESTURE];
+  sample->touches = i2cdat[FT6206_REG_NUMTOUCHES];
+  if (sample->touches > FT6206_MAX_TOUCHES) sample->touches = 0;
+
+  for (uint8_t i=0; i<sample->touches; i++) {
+    const uint8_t *p = &i2cdat[FT6206_REG_P1 + i*FT6206_POINT_BYTES];
+    FT6206Point *point = &sample->point[i];
+    point->x = ((p[0] & 0x0F) << 8) | p[1];
+    point->y = ((p[2] & 0x0F) << 8) | p[3];
+    point->event = p[0] >> 6;
+    point->id = p[2] >> 4;
+    point->weight = p[4];
+    point->area = p[5] >> 4;
+  }
+  touches = sample->touches;
+  return touches > 0;
+}
+
 TS_Point Adafruit_FT6206::getPoint(void) {
   uint16_t x, y;
   readData(&x, &y);
@@ -41,10 +41,42 @@
 #define FT6206_REG_FIRMVERS 0xA6
 #define FT6206_REG_CHIPID 0xA3
 #define FT6206_REG_VENDID 0xA8
+#define FT6206_REG_GMODE 0xA4
+#define FT6206_GMODE_POLLING 0x00   // INT held low while touched
+#define FT6206_GMODE_TRIGGER 0x01   // INT pulsed for each report
+
+// Registers 0x00 to 0x0E: mode, gesture, touch count and two touch points
+// of six bytes, XH XL YH YL WEIGHT MISC, starting at 0x03
+#define FT6206_REG_GESTURE 0x01
+#define FT6206_REG_P1 0x03
+#define FT6206_POINT_BYTES 6
+#define FT6206_SAMPLE_BYTES 15
+#define FT6206_MAX_TOUCHES 2
+
+// Event flag of a touch point, bits 7:6 of XH
+#define FT6206_EVENT_DOWN 0
+#define FT6206_EVENT_UP 1
+#define FT6206_EVENT_CONTACT 2
+#define FT6206_EVENT_NONE 3
 
 // calibrated for Adafruit 2.8" ctp screen
 #define FT6206_DEFAULT_THRESSHOLD 128
 
+typedef struct {
+  uint16_t x, y;
+  uint8_t event;   // FT6206_EVENT_*
+  uint8_t id;      // touch ID, bits 7:4 of YH
+  uint8_t weight;  // touch pressure
+  uint8_t area;    // touch area, bits 7:4 of MISC
+} FT6206Point;
+
+// Everything the controller reports about one scan
+typedef struct {
+  uint8_t touches; // 0 to FT6206_MAX_TOUCHES
+  uint8_t gesture; // gesture ID
+  FT6206Point point[FT6206_MAX_TOUCHES];
+} FT6206Sample;
+
 class TS_Point {
  public:
   TS_Point(void);
@@ -71,6 +103,7 @@ class Adafruit_FT6206 {
 
   boolean touched(void);
   TS_Point getPoint(void);
+  boolean readSample(FT6206Sample *sample);
 
  private:
   HANDLE hI2c1;
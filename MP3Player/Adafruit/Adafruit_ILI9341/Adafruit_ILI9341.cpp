@@ -16,6 +16,7 @@
 #include "Adafruit_ILI9341.h"
 #include <limits.h>
 #include "pjdf.h"
+#include "pixelKernels.h"
 
 void delay(uint32_t time);
 
@@ -27,6 +28,8 @@ void delay(uint32_t time);
 Adafruit_ILI9341::Adafruit_ILI9341() : Adafruit_GFX(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT) {
     hLcd = 0;
     iSpiBuffer = 0;
+    dcState = ILI9341_DC_UNKNOWN;
+    resetBusStats();
 };
 
 
@@ -42,16 +45,33 @@ Adafruit_ILI9341::Adafruit_ILI9341(int8_t cs, int8_t dc, int8_t rst) : Adafruit_
 
 void Adafruit_ILI9341::setPjdfHandle(HANDLE hLcd) {
     this->hLcd = hLcd;
+    dcState = ILI9341_DC_UNKNOWN;
 }
 
 
 void Adafruit_ILI9341::spiFlush() {
     if (iSpiBuffer > 0) {
-        Write(hLcd, spiBuffer, (uint32_t*) &iSpiBuffer);
+        INT32U count = iSpiBuffer; // Write() takes a 32 bit count
+        busStats.bytes += count;
+        busStats.transfers++;
+        Write(hLcd, spiBuffer, &count);
         iSpiBuffer = 0;
     }
 }
 
+// Zero the counts of SPI traffic sent to the panel.
+void Adafruit_ILI9341::resetBusStats(void) {
+    busStats.bytes = 0;
+    busStats.transfers = 0;
+    busStats.dcChanges = 0;
+}
+
+// Copy the counts of SPI traffic sent since resetBusStats().
+void Adafruit_ILI9341::getBusStats(Ili9341BusStats *stats) {
+    spiFlush();
+    *stats = busStats;
+}
+
 // Write the given byte to the SPI buffer.
 void Adafruit_ILI9341::spiWriteByte(uint8_t c) {
     spiBuffer[iSpiBuffer++] = c;
@@ -64,53 +84,185 @@ void Adafruit_ILI9341::spiWriteByte(uint8_t c) {
 
 void Adafruit_ILI9341::writecommand(uint8_t c) {
     spiFlush();
-    Ioctl(hLcd, PJDF_CTRL_LCD_SELECT_COMMAND, 0, 0);
+    if (dcState != ILI9341_DC_COMMAND) {
+        Ioctl(hLcd, PJDF_CTRL_LCD_SELECT_COMMAND, 0, 0);
+        dcState = ILI9341_DC_COMMAND;
+        busStats.dcChanges++;
+    }
     spiWriteByte(c);
     spiFlush();
 }
 
+// Set DC high for data unless it already is. Anything still buffered
+// was written for the previous DC state so goes out first.
+void Adafruit_ILI9341::selectData(void) {
+    if (dcState != ILI9341_DC_DATA) {
+        spiFlush();
+        Ioctl(hLcd, PJDF_CTRL_LCD_SELECT_DATA, 0, 0);
+        dcState = ILI9341_DC_DATA;
+        busStats.dcChanges++;
+    }
+}
+
 // Set DC high means sending data, CS low
 // write the given byte
 // Set CS high to deselect TFT chip
 void Adafruit_ILI9341::writedata(uint8_t c) {
-    Ioctl(hLcd, PJDF_CTRL_LCD_SELECT_DATA, 0, 0);
+    selectData();
     spiWriteByte(c);
 } 
 
+// Send the same color count times to the current address window.
+// Long runs are handed to the LCD driver's fill, which clocks the color
+// out by DMA while this task sleeps; short ones go through the SPI buffer.
+void Adafruit_ILI9341::pushPixels(uint16_t color, uint32_t count) {
+    INT32U len;
+
+    selectData();
+    spiFlush();
+    if (count == 0) return;
+
+    if (count >= ILI9341_FILLMIN) {
+        LcdFillArgs fill = { color, count };
+        len = sizeof(fill);
+        busStats.bytes += count * 2;
+        busStats.transfers++;
+        Ioctl(hLcd, PJDF_CTRL_LCD_FILL, &fill, &len);
+        return;
+    }
+
+    while (count--) {
+        spiBuffer[iSpiBuffer++] = color >> 8;
+        spiBuffer[iSpiBuffer++] = color;
+    }
+    spiFlush();
+}
+
+// Start sending count RGB565 pixels in native byte order to the current
+// address window by DMA and return at once. colors must not change, and
+// nothing else may be sent to the LCD, until waitAsync(). The SPI bus stays
+// locked to the LCD until then.
+void Adafruit_ILI9341::pushBlockAsync(const uint16_t *colors, uint16_t count) {
+    LcdPixelsArgs pixels = { colors, count };
+    INT32U len = sizeof(pixels);
+
+    selectData();
+    spiFlush();
+    busStats.bytes += (uint32_t)count * 2;
+    busStats.transfers++;
+    Ioctl(hLcd, PJDF_CTRL_LCD_WRITE_PIXELS_START, &pixels, &len);
+}
+
+// Wait for the block started by pushBlockAsync(), if any, to finish.
+void Adafruit_ILI9341::waitAsync(void) {
+    Ioctl(hLcd, PJDF_CTRL_LCD_WRITE_PIXELS_WAIT, 0, 0);
+}
+
+// Send count RGB565 pixels to the current address window, swapping each
+// into the big endian order the ILI9341 expects.
+void Adafruit_ILI9341::pushBlock(const uint16_t *colors, uint32_t count) {
+    bufferBlock(colors, count);
+    spiFlush();
+}
+
+// As pushBlock() but the last partial buffer is left for the next write
+// or flush, so consecutive short blocks share Write() calls.
+void Adafruit_ILI9341::bufferBlock(const uint16_t *colors, uint32_t count) {
+    selectData();
+    while (count > 0) {
+        uint32_t n = (ILI9341_SPIBUFLEN - iSpiBuffer) / 2;
+        if (n > count) n = count;
+        PixelSwap565(colors, &spiBuffer[iSpiBuffer], n);
+        iSpiBuffer += 2 * n;
+        colors += n;
+        count -= n;
+        if (iSpiBuffer >= ILI9341_SPIBUFLEN - 1) spiFlush();
+    }
+}
+
 
 // Rather than a bazillion writecommand() and writedata() calls, screen
 // initialization commands and arguments are organized in these tables
-// stored in PROGMEM.  The table may look bulky, but that's mostly the
+// stored in flash.  The table may look bulky, but that's mostly the
 // formatting -- storage-wise this is hundreds of bytes more compact
 // than the equivalent code.  Companion function follows.
 #define DELAY 0x80
 
+// Power up sequence. The undocumented 0xEF/0xCF/0xED... power settings of
+// the original Adafruit sequence stay left out, as they were in begin().
+// Delays are the ILI9341 datasheet minimums: no SLPOUT for 120 ms after
+// SWRESET, and no command for 5 ms after SLPOUT.
+static const uint8_t ili9341InitCmds[] = {
+  15,                                   // 15 commands in list:
+  ILI9341_SWRESET, DELAY,               //  1: Software reset, no args, w/delay
+    120,                                //     120 ms
+  ILI9341_PWCTR1 , 1,                   //  2: Power control, 1 arg:
+    0x23,                               //     VRH[5:0]
+  ILI9341_PWCTR2 , 1,                   //  3: Power control, 1 arg:
+    0x10,                               //     SAP[2:0];BT[3:0]
+  ILI9341_VMCTR1 , 2,                   //  4: VCM control, 2 args:
+    0x3e, 0x28,
+  ILI9341_VMCTR2 , 1,                   //  5: VCM control2, 1 arg:
+    0x86,
+  ILI9341_MADCTL , 1,                   //  6: Memory Access Control, 1 arg:
+    0x48,
+  ILI9341_PIXFMT , 1,                   //  7: Pixel format, 1 arg:
+    0x55,                               //     16 bits/pixel
+  ILI9341_FRMCTR1, 2,                   //  8: Frame rate control, 2 args:
+    0x00, 0x18,
+  ILI9341_DFUNCTR, 3,                   //  9: Display Function Control, 3 args:
+    0x08, 0x82, 0x27,
+  0xF2           , 1,                   // 10: 3Gamma Function Disable, 1 arg:
+    0x00,
+  ILI9341_GAMMASET, 1,                  // 11: Gamma curve selected, 1 arg:
+    0x01,
+  ILI9341_GMCTRP1, 15,                  // 12: Set Gamma, 15 args:
+    0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1,
+    0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+  ILI9341_GMCTRN1, 15,                  // 13: Set Gamma, 15 args:
+    0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1,
+    0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+  ILI9341_SLPOUT , DELAY,               // 14: Exit Sleep, no args, w/delay
+    5,                                  //     5 ms
+  ILI9341_DISPON , 0                    // 15: Display on, no args
+};
 
+// Wait at least ms milliseconds. Sleeps once the OS is running so the
+// panel's power up delays leave the CPU to the other tasks.
+static void ili9341Delay(uint16_t ms) {
+  if (OSRunning) {
+    // +1 as the first tick may come at once
+    OSTimeDly((INT16U)(((INT32U)ms * OS_TICKS_PER_SEC + 999) / 1000 + 1));
+  } else {
+    delay((SystemCoreClock / 4000) * ms); // roughly 4 cycles per count
+  }
+}
 
 // Companion code to the above tables.  Reads and issues
-// a series of LCD commands stored in PROGMEM byte array.
-void Adafruit_ILI9341::commandList(uint8_t *addr) {
-
-  while(1);
-//  uint8_t  numCommands, numArgs;
-//  uint16_t ms;
-//
-//  numCommands = pgm_read_byte(addr++);   // Number of commands to follow
-//  while(numCommands--) {                 // For each command...
-//    writecommand(pgm_read_byte(addr++)); //   Read, issue command
-//    numArgs  = pgm_read_byte(addr++);    //   Number of args to follow
-//    ms       = numArgs & DELAY;          //   If hibit set, delay follows args
-//    numArgs &= ~DELAY;                   //   Mask out delay bit
-//    while(numArgs--) {                   //   For each argument...
-//      writedata(pgm_read_byte(addr++));  //     Read, issue argument
-//    }
-//
-//    if(ms) {
-//      ms = pgm_read_byte(addr++); // Read post-command delay time (ms)
-//      if(ms == 255) ms = 500;     // If 255, delay for 500 ms
-//      delay(ms);
-//    }
-//  }
+// a series of LCD commands stored in a flash byte array.
+// Each command byte goes out on its own with DC low and its arguments
+// follow as one transfer with DC high.
+void Adafruit_ILI9341::commandList(const uint8_t *addr) {
+  uint8_t  numCommands, numArgs;
+  uint16_t ms;
+
+  numCommands = *addr++;                 // Number of commands to follow
+  while(numCommands--) {                 // For each command...
+    writecommand(*addr++);               //   Read, issue command
+    numArgs  = *addr++;                  //   Number of args to follow
+    ms       = numArgs & DELAY;          //   If hibit set, delay follows args
+    numArgs &= ~DELAY;                   //   Mask out delay bit
+    while(numArgs--) {                   //   For each argument...
+      writedata(*addr++);                //     Read, buffer argument
+    }
+    spiFlush();
+
+    if(ms) {
+      ms = *addr++;               // Read post-command delay time (ms)
+      if(ms == 255) ms = 500;     // If 255, delay for 500 ms
+      ili9341Delay(ms);
+    }
+  }
 }
 
 
@@ -130,124 +282,9 @@ void Adafruit_ILI9341::begin(void) {
   x = readcommand8(ILI9341_RDSELFDIAG);
   Serial.print("\nSelf Diagnostic: 0x"); Serial.println(x, HEX);
 */
-  //if(cmdList) commandList(cmdList);
-
-  writecommand(0x01);
-  delay(10);
-
-#if 0
-  writecommand(0xEF);
-  writedata(0x03);
-  writedata(0x80);
-  writedata(0x02);
-
-  writecommand(0xCF);  
-  writedata(0x00); 
-  writedata(0XC1); 
-  writedata(0X30); 
-
-  writecommand(0xED);  
-  writedata(0x64); 
-  writedata(0x03); 
-  writedata(0X12); 
-  writedata(0X81); 
- 
-  writecommand(0xE8);  
-  writedata(0x85); 
-  writedata(0x00); 
-  writedata(0x78); 
-
-  writecommand(0xCB);  
-  writedata(0x39); 
-  writedata(0x2C); 
-  writedata(0x00); 
-  writedata(0x34); 
-  writedata(0x02); 
- 
-  writecommand(0xF7);  
-  writedata(0x20); 
-
-  writecommand(0xEA);  
-  writedata(0x00); 
-  writedata(0x00); 
- 
-#endif
-  
-  writecommand(ILI9341_PWCTR1);    //Power control 
-  writedata(0x23);   //VRH[5:0] 
- 
-  writecommand(ILI9341_PWCTR2);    //Power control 
-  writedata(0x10);   //SAP[2:0];BT[3:0] 
- 
-  writecommand(ILI9341_VMCTR1);    //VCM control 
-  writedata(0x3e); //¶Ô±È¶Èµ÷½Ú
-  writedata(0x28); 
-  
-  writecommand(ILI9341_VMCTR2);    //VCM control2 
-  writedata(0x86);  //--
- 
-  writecommand(ILI9341_MADCTL);    // Memory Access Control 
-  writedata(0x48);
-
-  writecommand(ILI9341_PIXFMT);    
-  writedata(0x55); 
-  
-  writecommand(ILI9341_FRMCTR1);    
-  writedata(0x00);  
-  writedata(0x18); 
- 
-  writecommand(ILI9341_DFUNCTR);    // Display Function Control 
-  writedata(0x08); 
-  writedata(0x82);
-  writedata(0x27);  
- 
-  writecommand(0xF2);    // 3Gamma Function Disable 
-  writedata(0x00); 
- 
-  writecommand(ILI9341_GAMMASET);    //Gamma curve selected 
-  writedata(0x01); 
- 
-  writecommand(ILI9341_GMCTRP1);    //Set Gamma 
-  writedata(0x0F); 
-  writedata(0x31); 
-  writedata(0x2B); 
-  writedata(0x0C); 
-  writedata(0x0E); 
-  writedata(0x08); 
-  writedata(0x4E); 
-  writedata(0xF1); 
-  writedata(0x37); 
-  writedata(0x07); 
-  writedata(0x10); 
-  writedata(0x03); 
-  writedata(0x0E); 
-  writedata(0x09); 
-  writedata(0x00); 
-  
-  writecommand(ILI9341_GMCTRN1);    //Set Gamma 
-  writedata(0x00); 
-  writedata(0x0E); 
-  writedata(0x14); 
-  writedata(0x03); 
-  writedata(0x11); 
-  writedata(0x07); 
-  writedata(0x31); 
-  writedata(0xC1); 
-  writedata(0x48); 
-  writedata(0x08); 
-  writedata(0x0F); 
-  writedata(0x0C); 
-  writedata(0x31); 
-  writedata(0x36); 
-  writedata(0x0F); 
-
-  writecommand(ILI9341_SLPOUT);    //Exit Sleep 
-  if (hwSPI) spi_end();
-  delay(120); 		
   if (hwSPI) spi_begin();
-  writecommand(ILI9341_DISPON);    //Display on 
+  commandList(ili9341InitCmds);
   if (hwSPI) spi_end();
-
 }
 
 
@@ -298,23 +335,16 @@ void Adafruit_ILI9341::drawFastVLine(int16_t x, int16_t y, int16_t h,
  uint16_t color) {
 
   // Rudimentary clipping
-  if((x >= _width) || (y >= _height)) return;
+  if((x < 0) || (x >= _width) || (y >= _height)) return;
+  if(y < 0) { h += y; y = 0; }
 
   if((y+h-1) >= _height) 
     h = _height-y;
+  if(h <= 0) return;
 
   if (hwSPI) spi_begin();
   setAddrWindow(x, y, x, y+h-1);
-
-  uint8_t hi = color >> 8, lo = color;
-
-
-
-  while (h--) {
-    writedata(hi);
-    writedata(lo);
-  }
-  spiFlush();
+  pushPixels(color, h);
   if (hwSPI) spi_end();
 }
 
@@ -323,20 +353,13 @@ void Adafruit_ILI9341::drawFastHLine(int16_t x, int16_t y, int16_t w,
   uint16_t color) {
 
   // Rudimentary clipping
-  if((x >= _width) || (y >= _height)) return;
+  if((y < 0) || (x >= _width) || (y >= _height)) return;
+  if(x < 0) { w += x; x = 0; }
   if((x+w-1) >= _width)  w = _width-x;
+  if(w <= 0) return;
   if (hwSPI) spi_begin();
   setAddrWindow(x, y, x+w-1, y);
-
-  uint8_t hi = color >> 8, lo = color;
-
-  //digitalWrite(_dc, HIGH);
-  //digitalWrite(_cs, LOW);
-  while (w--) {
-    writedata(hi);
-    writedata(lo);
-  }
-  spiFlush();
+  pushPixels(color, w);
   if (hwSPI) spi_end();
 }
 
@@ -352,18 +375,135 @@ void Adafruit_ILI9341::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
   if((x >= _width) || (y >= _height)) return;
   if((x + w - 1) >= _width)  w = _width  - x;
   if((y + h - 1) >= _height) h = _height - y;
+  if((w <= 0) || (h <= 0)) return;
 
   if (hwSPI) spi_begin();
   setAddrWindow(x, y, x+w-1, y+h-1);
+  pushPixels(color, (uint32_t)w * h);
+  if (hwSPI) spi_end();
+}
+
+
+// Draw a character with a background as a single address window, the
+// glyph expanded a line at a time. Transparent text (bg == color), glyphs
+// larger than ILI9341_GLYPH_MAX_SIZE and glyphs not wholly on screen are
+// drawn by Adafruit_GFX, which merges the dots into vertical runs.
+void Adafruit_ILI9341::drawChar(int16_t x, int16_t y, unsigned char c,
+  uint16_t color, uint16_t bg, uint8_t size) {
+  int16_t w = 6 * size, h = 8 * size;
+  uint16_t line[6 * ILI9341_GLYPH_MAX_SIZE];
+  uint8_t cols[6];
+
+  if ((bg == color) || (size == 0) || (size > ILI9341_GLYPH_MAX_SIZE) ||
+      (x < 0) || (y < 0) || (x + w > _width) || (y + h > _height)) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size);
+    return;
+  }
+
+  if(!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
+  for (uint8_t i = 0; i < 6; i++) cols[i] = glyphColumn(c, i);
+
+  if (hwSPI) spi_begin();
+  setAddrWindow(x, y, x + w - 1, y + h - 1);
+  for (uint8_t j = 0; j < 8; j++) {
+    uint16_t *p = line;
+    for (uint8_t i = 0; i < 6; i++) {
+      uint16_t px = (cols[i] >> j) & 0x1 ? color : bg;
+      for (uint8_t k = 0; k < size; k++) *p++ = px;
+    }
+    for (uint8_t k = 0; k < size; k++) bufferBlock(line, w);
+  }
+  spiFlush();
+  if (hwSPI) spi_end();
+}
 
-  uint8_t hi = color >> 8, lo = color;
 
+// Draw a run font character with a background as a single address window,
+// decoding the glyph's runs into one cell line at a time. Transparent text
+// and cells that are too wide, not wholly on screen or that the glyph
+// overhangs are drawn by Adafruit_GFX, one line per run.
+void Adafruit_ILI9341::drawRunChar(int16_t x, int16_t y, unsigned char c,
+  uint16_t color, uint16_t bg) {
+  const RunGlyph *g = runGlyph(c);
+  uint16_t line[ILI9341_GLYPH_MAX_WIDTH];
+
+  if (!g) return;
+  int16_t w = g->xAdvance, h = runFont->yAdvance;
+  int16_t top = runFont->ascent + g->yOffset; // first cell row of the glyph
+  if ((bg == color) || (w == 0) || (w > ILI9341_GLYPH_MAX_WIDTH) ||
+      (g->xOffset < 0) || (g->xOffset + g->width > w) ||
+      (top < 0) || (top + g->height > h) ||
+      (x < 0) || (y < 0) || (x + w > _width) || (y + h > _height)) {
+    Adafruit_GFX::drawRunChar(x, y, c, color, bg);
+    return;
+  }
+
+  const uint8_t *p = runFont->runs + g->offset;
+  uint8_t bgRun = 0, fgRun = 0;
 
-  for(y=h; y>0; y--) {
-    for(x=w; x>0; x--) {
-      writedata(hi);
-      writedata(lo);
+  if (hwSPI) spi_begin();
+  setAddrWindow(x, y, x + w - 1, y + h - 1);
+  for (int16_t row = 0; row < h; row++) {
+    for (int16_t i = 0; i < w; i++) line[i] = bg;
+    if ((row >= top) && (row < top + g->height)) {
+      // the next width pixels of the run stream
+      uint16_t *q = line + g->xOffset;
+      int16_t n = g->width;
+      while (n > 0) {
+        if ((bgRun == 0) && (fgRun == 0)) {
+          bgRun = *p >> 4;
+          fgRun = *p++ & 0xF;
+        }
+        for ( ; (bgRun > 0) && (n > 0); bgRun--, n--) q++;
+        for ( ; (bgRun == 0) && (fgRun > 0) && (n > 0); fgRun--, n--) *q++ = color;
+      }
     }
+    bufferBlock(line, w);
+  }
+  spiFlush();
+  if (hwSPI) spi_end();
+}
+
+
+// Draw a sprite as a single address window. Sprite colors are stored in
+// the panel's byte order, so the runs are copied straight into the SPI
+// buffer. Sprites not wholly on screen are drawn by Adafruit_GFX.
+void Adafruit_ILI9341::drawSprite(int16_t x, int16_t y, const RunSprite *sprite) {
+  int16_t w = sprite->width, h = sprite->height;
+
+  if ((w == 0) || (h == 0) ||
+      (x < 0) || (y < 0) || (x + w > _width) || (y + h > _height)) {
+    Adafruit_GFX::drawSprite(x, y, sprite);
+    return;
+  }
+
+  const uint8_t *p = sprite->runs;
+  uint32_t count = (uint32_t)w * h;
+
+  if (hwSPI) spi_begin();
+  setAddrWindow(x, y, x + w - 1, y + h - 1);
+  selectData();
+  while (count > 0) {
+    uint8_t n = (*p & ~RUNSPRITE_LITERAL) + 1;
+    boolean literal = (*p++ & RUNSPRITE_LITERAL) != 0;
+    count -= n;
+    while (n > 0) {
+      uint16_t m = (ILI9341_SPIBUFLEN - iSpiBuffer) / 2;
+      if (m > n) m = n;
+      if (literal) {
+        memcpy(&spiBuffer[iSpiBuffer], p, m * 2);
+        p += m * 2;
+        iSpiBuffer += m * 2;
+      } else {
+        for (uint16_t i = 0; i < m; i++) {
+          spiBuffer[iSpiBuffer++] = p[0];
+          spiBuffer[iSpiBuffer++] = p[1];
+        }
+      }
+      n -= m;
+      if (iSpiBuffer >= ILI9341_SPIBUFLEN - 1) spiFlush();
+    }
+    if (!literal) p += 2;
   }
   spiFlush();
   if (hwSPI) spi_end();
@@ -421,4 +561,35 @@ void Adafruit_ILI9341::invertDisplay(boolean i) {
   if (hwSPI) spi_end();
 }
 
+// Define the band of panel rows that scrollTo() moves: everything between
+// topFixed rows at the top and bottomFixed rows at the bottom, counted
+// along the 320 pixel side in the unrotated (rotation 0) orientation.
+// The band always spans the full 240 pixel width.
+void Adafruit_ILI9341::setScrollArea(uint16_t topFixed, uint16_t bottomFixed) {
+  uint16_t scrollRows = ILI9341_TFTHEIGHT - topFixed - bottomFixed;
+
+  if (hwSPI) spi_begin();
+  writecommand(ILI9341_VSCRDEF);
+  writedata(topFixed >> 8);
+  writedata(topFixed);
+  writedata(scrollRows >> 8);
+  writedata(scrollRows);
+  writedata(bottomFixed >> 8);
+  writedata(bottomFixed);
+  spiFlush();
+  if (hwSPI) spi_end();
+}
+
+// Show frame memory row line at the top of the scroll area, the rows
+// after it following on and wrapping round within the area. Pass the
+// area's first row to undo scrolling.
+void Adafruit_ILI9341::scrollTo(uint16_t line) {
+  if (hwSPI) spi_begin();
+  writecommand(ILI9341_VSCRSADD);
+  writedata(line >> 8);
+  writedata(line);
+  spiFlush();
+  if (hwSPI) spi_end();
+}
+
 
@@ -51,7 +51,9 @@
 #define ILI9341_RAMRD   0x2E
 
 #define ILI9341_PTLAR   0x30
+#define ILI9341_VSCRDEF 0x33
 #define ILI9341_MADCTL  0x36
+#define ILI9341_VSCRSADD 0x37
 #define ILI9341_PIXFMT  0x3A
 
 #define ILI9341_FRMCTR1 0xB1
@@ -101,7 +103,22 @@
 #define ILI9341_GREENYELLOW 0xAFE5      /* 173, 255,  47 */
 #define ILI9341_PINK        0xF81F
 
-#define ILI9341_SPIBUFLEN   128
+#define ILI9341_SPIBUFLEN   256   // bytes; even so a pixel never straddles a flush
+#define ILI9341_FILLMIN     64    // pixels; runs of one color this long go to PJDF_CTRL_LCD_FILL, <= SPIBUFLEN/2
+#define ILI9341_GLYPH_MAX_SIZE 8  // largest text size drawn as one window by drawChar()
+#define ILI9341_GLYPH_MAX_WIDTH 48 // widest run font cell drawn as one window by drawRunChar()
+
+// Data/command line state as last set through the LCD driver
+#define ILI9341_DC_UNKNOWN  0
+#define ILI9341_DC_COMMAND  1
+#define ILI9341_DC_DATA     2
+
+// SPI traffic sent to the panel, for benchmarks
+typedef struct {
+  uint32_t bytes;      // command, parameter and pixel bytes
+  uint32_t transfers;  // driver Write() calls and DMA transfers
+  uint32_t dcChanges;  // data/command switches, an Ioctl each
+} Ili9341BusStats;
 
 class Adafruit_ILI9341 : public Adafruit_GFX {
 
@@ -122,7 +139,12 @@ class Adafruit_ILI9341 : public Adafruit_GFX {
            fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
              uint16_t color),
            setRotation(uint8_t r),
-           invertDisplay(boolean i);
+           invertDisplay(boolean i),
+           drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+             uint16_t bg, uint8_t size),
+           drawRunChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+             uint16_t bg),
+           drawSprite(int16_t x, int16_t y, const RunSprite *sprite);
   uint16_t color565(uint8_t r, uint8_t g, uint8_t b);
 
   /* These are not for current use, 8-bit protocol only! */
@@ -139,15 +161,27 @@ class Adafruit_ILI9341 : public Adafruit_GFX {
   void spiFlush();
   void writecommand(uint8_t c);
   void writedata(uint8_t d);
-  void commandList(uint8_t *addr);
+  void pushPixels(uint16_t color, uint32_t count);
+  void pushBlock(const uint16_t *colors, uint32_t count);
+  void pushBlockAsync(const uint16_t *colors, uint16_t count);
+  void waitAsync(void);
+  void commandList(const uint8_t *addr);
   uint8_t  spiread(void);
+  void setScrollArea(uint16_t topFixed, uint16_t bottomFixed);
+  void scrollTo(uint16_t line);
+  void resetBusStats(void);
+  void getBusStats(Ili9341BusStats *stats);
 
  private:
   HANDLE hLcd;
   uint8_t spiBuffer[ILI9341_SPIBUFLEN];
-  uint8_t iSpiBuffer; /* current SPI buffer empty ascending point */
+  uint16_t iSpiBuffer; /* current SPI buffer empty ascending point */
+  uint8_t dcState;     /* ILI9341_DC_xxx, saves an Ioctl when unchanged */
+  Ili9341BusStats busStats;
   uint8_t  tabcolor;
 
+  void selectData(void);
+  void bufferBlock(const uint16_t *colors, uint32_t count);
  
 
   boolean  hwSPI;
@@ -0,0 +1,113 @@
+/*
+    Adafruit_ILI9341_Scroll.cpp
+    Hardware vertical scrolling of a band of the ILI9341 screen, see
+    Adafruit_ILI9341_Scroll.h.
+
+    Content line L always lives in frame memory row top + (L mod height),
+    and the panel is told to start the band at the row of the first
+    visible line, so scrolling never moves pixels over the bus.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "Adafruit_ILI9341_Scroll.h"
+
+Adafruit_ILI9341_Scroll::Adafruit_ILI9341_Scroll(Adafruit_ILI9341 *lcd,
+  Adafruit_ILI9341_Strip *strip) {
+  this->lcd = lcd;
+  this->strip = strip;
+  top = height = 0;
+  pos = 0;
+  bgColor = 0;
+}
+
+// Make rows top to top+height-1 the scrolling band, at content line 0.
+// The band is not redrawn; call redraw() or draw the first screenful of
+// content at rows top to top+height-1 before scrolling.
+void Adafruit_ILI9341_Scroll::begin(int16_t top, int16_t height, uint16_t bg) {
+  if (top < 0) top = 0;
+  if (top + height > ILI9341_TFTHEIGHT) height = ILI9341_TFTHEIGHT - top;
+  if (height < 0) height = 0;
+
+  this->top = top;
+  this->height = height;
+  bgColor = bg;
+  pos = 0;
+  lcd->setScrollArea(top, ILI9341_TFTHEIGHT - top - height);
+  lcd->scrollTo(top);
+}
+
+// Give the whole screen back to normal drawing. The band keeps whatever
+// was last shown in it only if the position is a multiple of its height.
+void Adafruit_ILI9341_Scroll::end(void) {
+  lcd->setScrollArea(0, 0);
+  lcd->scrollTo(0);
+  top = height = 0;
+  pos = 0;
+}
+
+// Go back to content line 0 without drawing, so frame memory and screen
+// rows match again and the band may be drawn directly.
+void Adafruit_ILI9341_Scroll::reset(void) {
+  pos = 0;
+  if (height > 0) lcd->scrollTo(top);
+}
+
+// Content line at the top of the band
+int32_t Adafruit_ILI9341_Scroll::position(void) const {
+  return pos;
+}
+
+// Move the window lines down the content (up the content if negative),
+// drawing only the lines that come into view.
+void Adafruit_ILI9341_Scroll::scroll(int32_t lines, ScrollDrawFn draw, void *arg) {
+  if (height == 0 || lines == 0) return;
+
+  if (lines >= height || lines <= -height) {
+    pos += lines;
+    redraw(draw, arg);
+    return;
+  }
+
+  // Draw the new lines first, in the rows of the ones leaving, then show them
+  if (lines > 0) {
+    drawLines(pos + height, lines, draw, arg);
+  } else {
+    drawLines(pos + lines, -lines, draw, arg);
+  }
+  pos += lines;
+  lcd->scrollTo(rowOf(pos));
+}
+
+// Draw every visible line of the band
+void Adafruit_ILI9341_Scroll::redraw(ScrollDrawFn draw, void *arg) {
+  if (height == 0) return;
+  drawLines(pos, height, draw, arg);
+  lcd->scrollTo(rowOf(pos));
+}
+
+// Frame memory row of content line
+int16_t Adafruit_ILI9341_Scroll::rowOf(int32_t line) const {
+  int32_t r = line % height;
+  if (r < 0) r += height;
+  return top + (int16_t)r;
+}
+
+// Draw count content lines from first into their frame memory rows,
+// in two pieces where they wrap round the end of the band
+void Adafruit_ILI9341_Scroll::drawLines(int32_t first, int16_t count,
+  ScrollDrawFn draw, void *arg) {
+  while (count > 0) {
+    int16_t y = rowOf(first);
+    int16_t n = top + height - y;
+    if (n > count) n = count;
+
+    strip->begin(0, y, ILI9341_TFTWIDTH, n, bgColor);
+    do {
+      draw(strip, y, first, n, arg);
+    } while (strip->nextStrip());
+
+    first += n;
+    count -= n;
+  }
+}
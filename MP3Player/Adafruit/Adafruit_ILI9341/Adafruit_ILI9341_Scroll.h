@@ -0,0 +1,60 @@
+/*
+    Adafruit_ILI9341_Scroll.h
+    Hardware vertical scrolling of a band of the ILI9341 screen.
+
+    The band shows a window onto a tall strip of content, numbered in lines
+    from 0. Moving the window only changes the panel's scroll start address
+    and draws the lines that come into view, through a strip renderer:
+
+        static void DrawList(Adafruit_GFX *gfx, int16_t y, int32_t firstLine,
+                             int16_t count, void *arg)
+        {
+            // draw content line firstLine at row y, firstLine+1 at y+1...
+        }
+
+        scroll.begin(100, 160, ILI9341_BLACK);   // rows 100-259 scroll
+        scroll.scroll(1, DrawList, NULL);        // one new line, 480 bytes
+
+    Lines that come into view are drawn into the frame memory rows of the
+    lines that just left it, so everything in the band must be drawn
+    through scroll(). The band spans the full width of the screen. Only
+    rotation 0 is supported, the scroll direction is fixed by the panel.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef _ADAFRUIT_ILI9341_SCROLLH_
+#define _ADAFRUIT_ILI9341_SCROLLH_
+
+#include <Adafruit_ILI9341_Strip.h>
+
+// Draws content lines firstLine to firstLine+count-1 with firstLine at
+// screen row y, the rest below it. Drawing outside those rows is clipped.
+typedef void (*ScrollDrawFn)(Adafruit_GFX *gfx, int16_t y, int32_t firstLine,
+  int16_t count, void *arg);
+
+class Adafruit_ILI9341_Scroll {
+
+ public:
+
+  Adafruit_ILI9341_Scroll(Adafruit_ILI9341 *lcd, Adafruit_ILI9341_Strip *strip);
+
+  void     begin(int16_t top, int16_t height, uint16_t bg),
+           end(void),
+           reset(void),
+           scroll(int32_t lines, ScrollDrawFn draw, void *arg),
+           redraw(ScrollDrawFn draw, void *arg);
+  int32_t  position(void) const;
+
+ private:
+  void     drawLines(int32_t first, int16_t count, ScrollDrawFn draw, void *arg);
+  int16_t  rowOf(int32_t line) const;
+
+  Adafruit_ILI9341 *lcd;
+  Adafruit_ILI9341_Strip *strip;
+  int16_t  top, height;  // band of frame memory rows that scrolls
+  int32_t  pos;          // content line at the top of the band
+  uint16_t bgColor;
+};
+
+#endif
@@ -0,0 +1,154 @@
+/*
+    Adafruit_ILI9341_Strip.cpp
+    Off-screen strip renderer for the ILI9341, see Adafruit_ILI9341_Strip.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "Adafruit_ILI9341_Strip.h"
+
+// Shared by all renderers; only the display task draws
+static uint16_t stripBuffers[2][ILI9341_STRIP_PIXELS];
+
+Adafruit_ILI9341_Strip::Adafruit_ILI9341_Strip(Adafruit_ILI9341 *lcd)
+  : Adafruit_GFX(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT) {
+  this->lcd = lcd;
+  strip = stripBuffers[0];
+  iStrip = 0;
+  rx = ry = rw = rh = 0;
+  sy = sh = 0;
+  rowsPerStrip = 0;
+  bgColor = 0;
+}
+
+// Start redrawing the given region of the LCD, clipped to the screen.
+// Every strip starts out filled with bg.
+void Adafruit_ILI9341_Strip::begin(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg) {
+  // Follow the LCD's rotation so coordinates match drawing on it directly
+  _width = lcd->width();
+  _height = lcd->height();
+  rotation = lcd->getRotation();
+
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width)  w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w > ILI9341_STRIP_PIXELS) w = ILI9341_STRIP_PIXELS;
+
+  rx = x; ry = y;
+  rw = w > 0 ? w : 0;
+  rh = h > 0 ? h : 0;
+  bgColor = bg;
+  rowsPerStrip = rw > 0 ? ILI9341_STRIP_PIXELS / rw : 0;
+
+  lcd->waitAsync();
+  if (rw > 0 && rh > 0) lcd->setAddrWindow(rx, ry, rx + rw - 1, ry + rh - 1);
+
+  sy = ry;
+  startStrip();
+}
+
+// Clear the buffer not in flight for the strip at sy
+void Adafruit_ILI9341_Strip::startStrip(void) {
+  sh = ry + rh - sy;
+  if (sh > rowsPerStrip) sh = rowsPerStrip;
+  if (sh < 0) sh = 0;
+
+  strip = stripBuffers[iStrip];
+  for (int32_t i = (int32_t)rw * sh - 1; i >= 0; i--) strip[i] = bgColor;
+}
+
+// Send the strip just drawn and move on to the next one.
+// Returns true if there is another strip to draw, false once the region is
+// complete and the LCD is free again.
+boolean Adafruit_ILI9341_Strip::nextStrip(void) {
+  if (rw == 0 || sh == 0) return false;
+
+  // The previous strip must be out before its buffer is reused below,
+  // and this one queued behind it in the same address window
+  lcd->waitAsync();
+  lcd->pushBlockAsync(strip, (uint16_t)(rw * sh));
+  iStrip ^= 1;
+
+  sy += sh;
+  if (sy >= ry + rh) {
+    lcd->waitAsync();
+    sh = 0;
+    return false;
+  }
+  startStrip();
+  return true;
+}
+
+void Adafruit_ILI9341_Strip::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < rx) || (x >= rx + rw) || (y < sy) || (y >= sy + sh)) return;
+  strip[(y - sy) * rw + (x - rx)] = color;
+}
+
+void Adafruit_ILI9341_Strip::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  // Clip to the current strip
+  if (x < rx) { w -= rx - x; x = rx; }
+  if (y < sy) { h -= sy - y; y = sy; }
+  if (x + w > rx + rw) w = rx + rw - x;
+  if (y + h > sy + sh) h = sy + sh - y;
+  if ((w <= 0) || (h <= 0)) return;
+
+  uint16_t *row = &strip[(y - sy) * rw + (x - rx)];
+  while (h--) {
+    for (int16_t i = 0; i < w; i++) row[i] = color;
+    row += rw;
+  }
+}
+
+void Adafruit_ILI9341_Strip::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+void Adafruit_ILI9341_Strip::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void Adafruit_ILI9341_Strip::fillScreen(uint16_t color) {
+  fillRect(rx, ry, rw, rh, color);
+}
+
+// Decode a sprite's runs straight into the strip, skipping the rows
+// above it and stopping at its last row
+void Adafruit_ILI9341_Strip::drawSprite(int16_t x, int16_t y, const RunSprite *sprite) {
+  const uint8_t *p = sprite->runs;
+  int16_t end = (y + sprite->height < sy + sh) ? y + sprite->height : sy + sh;
+  int16_t sx = 0, row = y;
+
+  while (row < end) {
+    uint8_t n = (*p & ~RUNSPRITE_LITERAL) + 1;
+    boolean literal = (*p++ & RUNSPRITE_LITERAL) != 0;
+    while ((n > 0) && (row < end)) {
+      int16_t w = sprite->width - sx;
+      if (w > n) w = n;
+
+      // The part of this row's piece of the run inside the strip
+      int16_t x0 = x + sx, x1 = x0 + w;
+      if (x0 < rx) x0 = rx;
+      if (x1 > rx + rw) x1 = rx + rw;
+      if ((row >= sy) && (x0 < x1)) {
+        uint16_t *q = &strip[(row - sy) * rw + (x0 - rx)];
+        if (literal) {
+          const uint8_t *c = p + 2 * (x0 - x - sx);
+          for (int16_t i = x0; i < x1; i++, c += 2) *q++ = (c[0] << 8) | c[1];
+        } else {
+          uint16_t color = (p[0] << 8) | p[1];
+          for (int16_t i = x0; i < x1; i++) *q++ = color;
+        }
+      }
+
+      if (literal) p += 2 * w;
+      n -= w;
+      sx += w;
+      if (sx == sprite->width) {
+        sx = 0;
+        row++;
+      }
+    }
+    if (!literal) p += 2;
+  }
+}
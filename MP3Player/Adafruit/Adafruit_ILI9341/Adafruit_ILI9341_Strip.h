@@ -0,0 +1,60 @@
+/*
+    Adafruit_ILI9341_Strip.h
+    Off-screen strip renderer for the ILI9341.
+
+    An Adafruit_GFX that draws into a RAM strip of a few rows and sends
+    each finished strip to the LCD by DMA while the next one is drawn.
+    The region is drawn in passes, one per strip, and every drawing call
+    made during a pass is clipped to that strip:
+
+        strip.begin(x, y, w, h, ILI9341_BLACK);
+        do {
+            strip.fillRect(...);
+            button.drawButton();   // a button created with &strip
+        } while (strip.nextStrip());
+
+    The panel is written once per pixel with no intermediate states, so
+    redraws do not flicker, and each strip is one address window and one
+    DMA transfer. The drawing code runs once per strip so it must draw
+    the same thing on every pass. Do not draw to the LCD itself between
+    begin() and the final nextStrip(): the SPI bus is held by the DMA.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef _ADAFRUIT_ILI9341_STRIPH_
+#define _ADAFRUIT_ILI9341_STRIPH_
+
+#include <Adafruit_ILI9341.h>
+
+#define ILI9341_STRIP_PIXELS  (ILI9341_TFTWIDTH * 16)  // per strip buffer; two are allocated
+
+class Adafruit_ILI9341_Strip : public Adafruit_GFX {
+
+ public:
+
+  Adafruit_ILI9341_Strip(Adafruit_ILI9341 *lcd);
+
+  void     begin(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg);
+  boolean  nextStrip(void);
+
+  void     drawPixel(int16_t x, int16_t y, uint16_t color),
+           drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color),
+           drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color),
+           fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color),
+           fillScreen(uint16_t color),
+           drawSprite(int16_t x, int16_t y, const RunSprite *sprite);
+
+ private:
+  void     startStrip(void);
+
+  Adafruit_ILI9341 *lcd;
+  uint16_t *strip;         // buffer being drawn, the other may be in flight
+  uint8_t  iStrip;         // index of strip in the buffer pair
+  int16_t  rx, ry, rw, rh; // region being redrawn, in LCD coordinates
+  int16_t  sy, sh;         // first row and number of rows of the current strip
+  int16_t  rowsPerStrip;
+  uint16_t bgColor;
+};
+
+#endif
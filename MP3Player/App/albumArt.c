@@ -0,0 +1,179 @@
+/*
+    albumArt.c
+    Shows the album art of a song as a thumbnail, see albumArt.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "print.h"
+#include "id3.h"
+#include "jpegDecode.h"
+#include "pixelKernels.h"
+#include "albumArt.h"
+
+// One MCU row is at most 16 pixel rows, of 2x2 sampled images at full size
+#define ALBUM_ART_ROW_PIXELS    ((INT32U)ALBUM_ART_SIZE * 16)
+
+// Kept off the display task's stack
+static JpegDecoder albumArtJpeg;
+static INT16U albumArtRows[ALBUM_ART_ROW_PIXELS];
+static INT16U albumArtPair[2][ALBUM_ART_SIZE * 2];  // rows at 1/8 to be halved
+static INT16U albumArtHalf[ALBUM_ART_SIZE];
+
+// An MP3 in flash
+typedef struct
+{
+    const INT8U *pData;
+    INT32U left;
+} AlbumArtFlash;
+
+// The picture's image data, so the decoder can't read on into the MP3
+typedef struct
+{
+    Id3ReadFn read;
+    void *ctx;
+    INT32U left;
+} AlbumArtPicture;
+
+// Where the decoded rows go on the LCD
+typedef struct
+{
+    Adafruit_ILI9341 *lcd;
+    INT16U x, y;
+} AlbumArtWindow;
+
+static INT32U ReadFlash(void *ctx, INT8U *buf, INT32U len)
+{
+    AlbumArtFlash *flash = (AlbumArtFlash*)ctx;
+    if (len > flash->left) len = flash->left;
+    memcpy(buf, flash->pData, len);
+    flash->pData += len;
+    flash->left -= len;
+    return len;
+}
+
+static INT32U ReadPicture(void *ctx, INT8U *buf, INT32U len)
+{
+    AlbumArtPicture *picture = (AlbumArtPicture*)ctx;
+    if (len > picture->left) len = picture->left;
+    len = picture->read(picture->ctx, buf, len);
+    picture->left -= len;
+    return len;
+}
+
+static void DrawRows(void *ctx, INT16U x, INT16U y, INT16U w, INT16U h, const INT16U *pixels)
+{
+    AlbumArtWindow *window = (AlbumArtWindow*)ctx;
+    x += window->x;
+    y += window->y;
+    window->lcd->setAddrWindow(x, y, x + w - 1, y + h - 1);
+    window->lcd->pushBlock(pixels, (uint32_t)w * h);
+}
+
+// Halves rows decoded at 1/8 before drawing them, a pair of rows at a
+// time. The crop starts on an even row, so pairs start on even rows too.
+static void DrawHalvedRows(void *ctx, INT16U x, INT16U y, INT16U w, INT16U h, const INT16U *pixels)
+{
+    for (INT16U row = y; row < y + h; row++, pixels += w)
+    {
+        memcpy(albumArtPair[row & 1], pixels, w * sizeof(INT16U));
+        if (row & 1)
+        {
+            PixelDownscale565(albumArtPair[0], ALBUM_ART_SIZE * 2, albumArtHalf, w / 2, 1);
+            DrawRows(ctx, x / 2, row / 2, w / 2, 1, albumArtHalf);
+        }
+    }
+}
+
+// Left edge of the thumbnail area
+static INT16U AreaLeft(Adafruit_ILI9341 &lcd)
+{
+    return (lcd.width() - ALBUM_ART_SIZE) / 2;
+}
+
+// AlbumArtClear
+// Blanks the thumbnail area.
+void AlbumArtClear(Adafruit_ILI9341 &lcd)
+{
+    lcd.fillRect(AreaLeft(lcd), ALBUM_ART_TOP, ALBUM_ART_SIZE, ALBUM_ART_SIZE, ILI9341_BLACK);
+}
+
+// Finds, decodes and draws the picture, or clears the area if there is none
+static BOOLEAN AlbumArtDraw(Adafruit_ILI9341 &lcd, Id3ReadFn read, void *ctx)
+{
+    char buf[PRINTBUFMAX];
+    INT32U startTicks = OSTimeGet();
+    Id3Picture picture;
+    AlbumArtPicture source;
+    AlbumArtWindow window;
+    JpegDecoder *jpeg = &albumArtJpeg;
+    INT16S err;
+
+    err = Id3FindPicture(read, ctx, &picture);
+    if (ID3_IS_ERROR(err))
+    {
+        PrintWithBuf(buf, PRINTBUFMAX, "AlbumArt: no picture (%d)\n", err);
+        AlbumArtClear(lcd);
+        return 0;
+    }
+
+    source.read = read;
+    source.ctx = ctx;
+    source.left = picture.size;
+    err = JpegOpen(jpeg, ReadPicture, &source);
+    if (JPEG_IS_ERROR(err))
+    {
+        PrintWithBuf(buf, PRINTBUFMAX, "AlbumArt: can't decode the %lu byte picture (%d)\n", picture.size, err);
+        AlbumArtClear(lcd);
+        return 0;
+    }
+
+    // Pictures still larger at 1/8 are halved again, and cropped around
+    // their centre if they are larger still
+    INT8U scale = JpegFitScale(jpeg, ALBUM_ART_SIZE, ALBUM_ART_SIZE);
+    INT16U w = JpegScaledWidth(jpeg, scale);
+    INT16U h = JpegScaledHeight(jpeg, scale);
+    INT8U halve = (w > ALBUM_ART_SIZE || h > ALBUM_ART_SIZE) ? 1 : 0;
+    w >>= halve;
+    h >>= halve;
+    INT16U cropX = w > ALBUM_ART_SIZE ? (w - ALBUM_ART_SIZE) / 2 : 0;
+    INT16U cropY = h > ALBUM_ART_SIZE ? (h - ALBUM_ART_SIZE) / 2 : 0;
+    w -= 2 * cropX;
+    h -= 2 * cropY;
+    if (w > ALBUM_ART_SIZE) w = ALBUM_ART_SIZE;
+    if (h > ALBUM_ART_SIZE) h = ALBUM_ART_SIZE;
+    if (JpegRowBufferPixels(jpeg, scale, ALBUM_ART_SIZE << halve) > ALBUM_ART_ROW_PIXELS) while(1);
+
+    // Blank only the margins of a smaller picture, so the old one doesn't flash
+    INT16U left = AreaLeft(lcd);
+    window.lcd = &lcd;
+    window.x = left + (ALBUM_ART_SIZE - w) / 2;
+    window.y = ALBUM_ART_TOP + (ALBUM_ART_SIZE - h) / 2;
+    lcd.fillRect(left, ALBUM_ART_TOP, ALBUM_ART_SIZE, window.y - ALBUM_ART_TOP, ILI9341_BLACK);
+    lcd.fillRect(left, window.y + h, ALBUM_ART_SIZE, ALBUM_ART_TOP + ALBUM_ART_SIZE - window.y - h, ILI9341_BLACK);
+    lcd.fillRect(left, window.y, window.x - left, h, ILI9341_BLACK);
+    lcd.fillRect(window.x + w, window.y, left + ALBUM_ART_SIZE - window.x - w, h, ILI9341_BLACK);
+
+    err = JpegDecode(jpeg, scale, albumArtRows, cropX << halve, cropY << halve, w << halve, h << halve,
+        halve ? DrawHalvedRows : DrawRows, &window);
+
+    PrintWithBuf(buf, PRINTBUFMAX, "AlbumArt: %ux%u at 1/%u of %ux%u, %lu bytes, %lu ms (%d)\n",
+        w, h, 1 << (scale + halve), jpeg->width, jpeg->height, picture.size,
+        (OSTimeGet() - startTicks) * 1000 / OS_TICKS_PER_SEC, err);
+    return !JPEG_IS_ERROR(err);
+}
+
+// AlbumArtShow
+// Draws the album art of an MP3 held in memory, or clears the area if it
+// has none.
+// pMp3: the MP3, starting with its ID3v2 tag
+// size: bytes of MP3
+// Returns: true if a picture was drawn
+BOOLEAN AlbumArtShow(Adafruit_ILI9341 &lcd, const INT8U *pMp3, INT32U size)
+{
+    AlbumArtFlash flash;
+    flash.pData = pMp3;
+    flash.left = size;
+    return AlbumArtDraw(lcd, ReadFlash, &flash);
+}
@@ -0,0 +1,31 @@
+/*
+    albumArt.h
+    Shows the album art of a song, the JPEG picture in its ID3v2 tag, as a
+    thumbnail above the song title.
+
+    The picture is read from the MP3 in flash a few dozen bytes at a time,
+    reduced by 1, 2, 4 or 8 while it is decoded to fit ALBUM_ART_SIZE
+    pixels square, or by 16 by halving the rows decoded at 1/8, cropped
+    around its centre if it is still larger, and sent to the LCD an MCU
+    row at a time (see jpegDecode.h). RAM used is the decoder, one MCU row
+    of pixels and two rows to halve, about 5.2 KB, all static.
+
+    Call from the task that owns the LCD.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __ALBUMART_H__
+#define __ALBUMART_H__
+
+#include "bsp.h"
+#include <Adafruit_ILI9341.h>
+
+// Thumbnail area, centered across the screen in the rows above the title band
+#define ALBUM_ART_TOP       2
+#define ALBUM_ART_SIZE      56
+
+BOOLEAN AlbumArtShow(Adafruit_ILI9341 &lcd, const INT8U *pMp3, INT32U size);
+void AlbumArtClear(Adafruit_ILI9341 &lcd);
+
+#endif /* __ALBUMART_H__ */
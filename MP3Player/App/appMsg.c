@@ -0,0 +1,126 @@
+/*
+    appMsg.c
+    Fixed-size message pool for messages passed between application tasks,
+    see appMsg.h. The pool is a uCOS-II memory partition.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "print.h"
+#include "appMsg.h"
+
+static AppMsg appMsgMem[APP_MSG_POOL_SIZE];
+static OS_MEM *appMsgPool = 0;
+
+static AppMsgStats appMsgStats = { 0 };
+static INT16U appMsgInUse = 0;
+
+
+// AppMsgInit
+// Creates the message pool. Call once before any task allocates a message.
+void AppMsgInit(void)
+{
+    INT8U err;
+
+    appMsgPool = OSMemCreate(appMsgMem, APP_MSG_POOL_SIZE, sizeof(AppMsg), &err);
+    if (err != OS_ERR_NONE) while(1);
+}
+
+// AppMsgAlloc
+// Takes a message from the pool and fills it in.
+// type: one of APP_MSG_xxx
+// arg, data: type specific payload
+// Returns: the message, or NULL if the pool is empty. The caller owns the
+//     message until it is posted or freed.
+AppMsg *AppMsgAlloc(INT16U type, INT16U arg, INT32U data)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    INT8U err;
+    AppMsg *pMsg;
+
+    pMsg = (AppMsg *)OSMemGet(appMsgPool, &err);
+
+    OS_ENTER_CRITICAL();
+    if (pMsg == NULL)
+    {
+        appMsgStats.exhausted++;
+        OS_EXIT_CRITICAL();
+        return NULL;
+    }
+    appMsgStats.allocs++;
+    if (++appMsgInUse > appMsgStats.inUseHigh) appMsgStats.inUseHigh = appMsgInUse;
+    OS_EXIT_CRITICAL();
+
+    pMsg->timestamp = OSTimeGet();
+    pMsg->type = type;
+    pMsg->arg = arg;
+    pMsg->data = data;
+    return pMsg;
+}
+
+// AppMsgFree
+// Returns a message to the pool. Called by the receiver once it has
+// finished with a message.
+void AppMsgFree(AppMsg *pMsg)
+{
+    OS_CPU_SR cpu_sr = 0u;
+
+    if (OSMemPut(appMsgPool, pMsg) != OS_ERR_NONE) while(1); // not from the pool
+
+    OS_ENTER_CRITICAL();
+    appMsgInUse--;
+    OS_EXIT_CRITICAL();
+}
+
+// AppMsgPost
+// Hands a message to the receiver of the given queue. If the queue is full
+// the message is freed and counted as dropped, so ownership always passes.
+// pQueue: a queue created by OSQCreate()
+// pMsg: a message from AppMsgAlloc()
+// Returns: the OSQPost() error code
+INT8U AppMsgPost(OS_EVENT *pQueue, AppMsg *pMsg)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    INT8U err;
+    INT16U depth;
+
+    err = OSQPost(pQueue, pMsg);
+    if (err != OS_ERR_NONE)
+    {
+        AppMsgFree(pMsg);
+        OS_ENTER_CRITICAL();
+        appMsgStats.dropped++;
+        OS_EXIT_CRITICAL();
+        return err;
+    }
+
+    // Entries left in the queue; zero if a waiting receiver took the message directly
+    OS_ENTER_CRITICAL();
+    depth = ((OS_Q *)pQueue->OSEventPtr)->OSQEntries;
+    if (depth > appMsgStats.queueHigh) appMsgStats.queueHigh = depth;
+    OS_EXIT_CRITICAL();
+    return err;
+}
+
+// AppMsgGetStats
+// Copies the pool and queue counters.
+void AppMsgGetStats(AppMsgStats *pStats)
+{
+    OS_CPU_SR cpu_sr = 0u;
+
+    OS_ENTER_CRITICAL();
+    *pStats = appMsgStats;
+    OS_EXIT_CRITICAL();
+}
+
+// AppMsgPrintStats
+// Prints the pool and queue counters on one line.
+void AppMsgPrintStats(char *buf, int size)
+{
+    AppMsgStats stats;
+
+    AppMsgGetStats(&stats);
+    PrintWithBuf(buf, size, "AppMsg: allocs %lu, in use high %u/%u, queue high %u, exhausted %lu, dropped %lu\n",
+        stats.allocs, stats.inUseHigh, APP_MSG_POOL_SIZE, stats.queueHigh, stats.exhausted, stats.dropped);
+}
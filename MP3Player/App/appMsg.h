@@ -0,0 +1,45 @@
+/*
+    appMsg.h
+    Fixed-size message pool for messages passed between application tasks.
+
+    A sender allocates a message, fills it in and posts it to a queue; from
+    then on the message belongs to the receiver, which frees it when done.
+    Nothing is shared between tasks so a fast sender cannot overwrite a
+    message that has not been read yet.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __APPMSG_H
+#define __APPMSG_H
+
+#define APP_MSG_POOL_SIZE   8   // messages in the pool, shared by all queues
+
+// Message types
+#define APP_MSG_DISPLAY     1   // arg: displayState, data: song index or percent played
+
+typedef struct _AppMsg
+{
+    INT32U timestamp;   // OSTimeGet() when the message was allocated
+    INT16U type;        // one of APP_MSG_xxx
+    INT16U arg;         // type specific
+    INT32U data;        // type specific
+} AppMsg;
+
+typedef struct _AppMsgStats
+{
+    INT32U allocs;      // successful AppMsgAlloc() calls
+    INT32U exhausted;   // AppMsgAlloc() calls that found the pool empty
+    INT32U dropped;     // messages freed because the queue was full
+    INT16U inUseHigh;   // most messages allocated at once
+    INT16U queueHigh;   // deepest any queue has been right after a post
+} AppMsgStats;
+
+void AppMsgInit(void);
+AppMsg *AppMsgAlloc(INT16U type, INT16U arg, INT32U data);
+void AppMsgFree(AppMsg *pMsg);
+INT8U AppMsgPost(OS_EVENT *pQueue, AppMsg *pMsg);
+void AppMsgGetStats(AppMsgStats *pStats);
+void AppMsgPrintStats(char *buf, int size);
+
+#endif
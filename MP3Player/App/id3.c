@@ -0,0 +1,237 @@
+/*
+    id3.c
+    Finds the attached picture in an ID3v2 tag, see id3.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "id3.h"
+
+#define ID3_HEADER_SIZE         10
+#define ID3_FLAG_UNSYNC         0x80
+#define ID3_FLAG_EXTENDED       0x40    // ID3v2.2: compression
+
+// Frame flags that make the frame unreadable here
+#define ID3_V3_FRAME_PACKED     0x00C0  // compression, encryption
+#define ID3_V4_FRAME_PACKED     0x000E  // compression, encryption, unsynchronisation
+#define ID3_V4_FRAME_LENGTH     0x0001  // data length indicator before the data
+
+#define ID3_MIME_MAX            12      // characters of a MIME type compared
+
+// Text encodings; 1 and 2 are UTF-16, ended by two zero bytes
+#define ID3_ENCODING_UTF16      1
+#define ID3_ENCODING_UTF16BE    2
+
+typedef struct
+{
+    Id3ReadFn read;
+    void *ctx;
+    INT32U left;            // bytes of the tag not read yet
+} Id3Reader;
+
+// Read len bytes of the tag, counting them off both the tag and, unless
+// it is NULL, the frame being read
+static Id3Err ReadBytes(Id3Reader *r, INT32U *pFrameLeft, INT8U *buf, INT32U len)
+{
+    if (len > r->left) return ID3_ERR_READ;
+    if (pFrameLeft != NULL)
+    {
+        if (len > *pFrameLeft) return ID3_ERR_READ;
+        *pFrameLeft -= len;
+    }
+    r->left -= len;
+
+    while (len > 0)
+    {
+        INT32U n = r->read(r->ctx, buf, len);
+        if (n == 0) return ID3_ERR_READ;
+        buf += n;
+        len -= n;
+    }
+    return ID3_ERR_NONE;
+}
+
+static Id3Err Skip(Id3Reader *r, INT32U len)
+{
+    INT8U buf[16];
+
+    while (len > 0)
+    {
+        INT32U n = len < sizeof(buf) ? len : sizeof(buf);
+        Id3Err err = ReadBytes(r, NULL, buf, n);
+        if (ID3_IS_ERROR(err)) return err;
+        len -= n;
+    }
+    return ID3_ERR_NONE;
+}
+
+// 28 bit integer stored 7 bits to a byte, as in the ID3v2 header
+static INT32U Syncsafe(const INT8U *b)
+{
+    return ((INT32U)(b[0] & 0x7F) << 21) | ((INT32U)(b[1] & 0x7F) << 14) |
+        ((INT32U)(b[2] & 0x7F) << 7) | (b[3] & 0x7F);
+}
+
+static INT32U BigEndian(const INT8U *b, INT8U len)
+{
+    INT32U v = 0;
+    while (len--) v = (v << 8) | *b++;
+    return v;
+}
+
+static char Lower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
+// Read the fields of a PIC or APIC frame that come before the image data.
+// Returns with *pIsJpeg set if the image is a JPEG.
+static Id3Err ReadPictureHeader(Id3Reader *r, INT8U version, INT32U *pFrameLeft,
+    INT8U *pType, BOOLEAN *pIsJpeg)
+{
+    char mime[ID3_MIME_MAX + 1];
+    INT8U encoding, c[2];
+    INT8U n = 0;
+    Id3Err err;
+
+    err = ReadBytes(r, pFrameLeft, &encoding, 1);
+    if (ID3_IS_ERROR(err)) return err;
+
+    if (version == 2)
+    {
+        // Three character image format
+        err = ReadBytes(r, pFrameLeft, (INT8U*)mime, 3);
+        if (ID3_IS_ERROR(err)) return err;
+        for (n = 0; n < 3; n++) mime[n] = Lower(mime[n]);
+        mime[3] = 0;
+        *pIsJpeg = strcmp(mime, "jpg") == 0;
+    }
+    else
+    {
+        // MIME type, Latin-1 ended by a zero
+        do {
+            err = ReadBytes(r, pFrameLeft, c, 1);
+            if (ID3_IS_ERROR(err)) return err;
+            if (n < ID3_MIME_MAX) mime[n++] = Lower((char)c[0]);
+        } while (c[0] != 0);
+        mime[n] = 0;
+        *pIsJpeg = strcmp(mime, "image/jpeg") == 0 || strcmp(mime, "image/jpg") == 0 ||
+            strcmp(mime, "jpg") == 0;
+    }
+
+    err = ReadBytes(r, pFrameLeft, pType, 1);
+    if (ID3_IS_ERROR(err)) return err;
+
+    // Description, ended by a zero character of its encoding
+    if (encoding == ID3_ENCODING_UTF16 || encoding == ID3_ENCODING_UTF16BE)
+    {
+        do {
+            err = ReadBytes(r, pFrameLeft, c, 2);
+            if (ID3_IS_ERROR(err)) return err;
+        } while (c[0] != 0 || c[1] != 0);
+    }
+    else
+    {
+        do {
+            err = ReadBytes(r, pFrameLeft, c, 1);
+            if (ID3_IS_ERROR(err)) return err;
+        } while (c[0] != 0);
+    }
+    return ID3_ERR_NONE;
+}
+
+// Id3FindPicture
+// Finds the first JPEG attached picture in the ID3v2 tag at the start of
+// a stream.
+// read: reads the stream from its first byte
+// ctx: passed to read
+// pPicture: gets the size and type of the picture
+// Returns: ID3_ERR_NONE with the stream at the first byte of the image
+//   data, or why there is no picture to read
+Id3Err Id3FindPicture(Id3ReadFn read, void *ctx, Id3Picture *pPicture)
+{
+    INT8U header[ID3_HEADER_SIZE];
+    Id3Reader r;
+    Id3Err err;
+
+    r.read = read;
+    r.ctx = ctx;
+    r.left = ID3_HEADER_SIZE;
+    err = ReadBytes(&r, NULL, header, ID3_HEADER_SIZE);
+    if (ID3_IS_ERROR(err)) return err;
+    if (header[0] != 'I' || header[1] != 'D' || header[2] != '3') return ID3_ERR_NO_TAG;
+
+    INT8U version = header[3];
+    INT8U flags = header[5];
+    if (version < 2 || version > 4) return ID3_ERR_UNSUPPORTED;
+    if (flags & ID3_FLAG_UNSYNC) return ID3_ERR_UNSUPPORTED;
+    r.left = Syncsafe(&header[6]);
+
+    if (flags & ID3_FLAG_EXTENDED)
+    {
+        if (version == 2) return ID3_ERR_UNSUPPORTED;
+
+        // ID3v2.3 gives the size of the rest, ID3v2.4 the size of it all
+        err = ReadBytes(&r, NULL, header, 4);
+        if (ID3_IS_ERROR(err)) return err;
+        INT32U size = version == 3 ? BigEndian(header, 4) : Syncsafe(header);
+        if (version == 4)
+        {
+            if (size < 4) return ID3_ERR_UNSUPPORTED;
+            size -= 4;
+        }
+        err = Skip(&r, size);
+        if (ID3_IS_ERROR(err)) return err;
+    }
+
+    // Frames: an ID of 3 (ID3v2.2) or 4 characters, a size, and from
+    // ID3v2.3 on two bytes of flags
+    INT8U idLen = version == 2 ? 3 : 4;
+    INT8U headerLen = version == 2 ? 6 : 10;
+    while (r.left >= headerLen)
+    {
+        err = ReadBytes(&r, NULL, header, headerLen);
+        if (ID3_IS_ERROR(err)) return err;
+        if (header[0] == 0) break;      // padding
+
+        INT32U size;
+        INT16U frameFlags = 0;
+        if (version == 2)
+        {
+            size = BigEndian(&header[3], 3);
+        }
+        else
+        {
+            size = version == 3 ? BigEndian(&header[4], 4) : Syncsafe(&header[4]);
+            frameFlags = (INT16U)BigEndian(&header[8], 2);
+        }
+
+        BOOLEAN picture = memcmp(header, version == 2 ? "PIC" : "APIC", idLen) == 0;
+        if (version == 3 && (frameFlags & ID3_V3_FRAME_PACKED)) picture = 0;
+        if (version == 4 && (frameFlags & ID3_V4_FRAME_PACKED)) picture = 0;
+
+        if (picture)
+        {
+            INT8U type;
+            BOOLEAN jpeg;
+
+            if (version == 4 && (frameFlags & ID3_V4_FRAME_LENGTH))
+            {
+                err = ReadBytes(&r, &size, header, 4);
+                if (ID3_IS_ERROR(err)) return err;
+            }
+            err = ReadPictureHeader(&r, version, &size, &type, &jpeg);
+            if (ID3_IS_ERROR(err)) return err;
+            if (jpeg && size > 0)
+            {
+                pPicture->size = size;
+                pPicture->type = type;
+                return ID3_ERR_NONE;
+            }
+        }
+
+        err = Skip(&r, size);
+        if (ID3_IS_ERROR(err)) return err;
+    }
+    return ID3_ERR_NO_PICTURE;
+}
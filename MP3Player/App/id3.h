@@ -0,0 +1,47 @@
+/*
+    id3.h
+    Finds the attached picture (album art) in the ID3v2 tag at the start
+    of an MP3 stream.
+
+    The tag is read through a read function, so the MP3 can be in flash or
+    on the SD card, and nothing of it is kept: frames before the picture
+    are skipped, and the stream is left at the first byte of the picture's
+    image data for a decoder to read on.
+
+    ID3v2.2 PIC and ID3v2.3/2.4 APIC frames holding a JPEG are found.
+    Tags using unsynchronisation are not read; compressed or encrypted
+    frames are skipped.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __ID3_H__
+#define __ID3_H__
+
+#include "bsp.h"
+
+// Error codes, negative as in PJDF
+#define ID3_IS_ERROR(x)         (x < 0)
+typedef INT8S Id3Err;
+#define ID3_ERR_NONE            0
+#define ID3_ERR_READ            -1  // the stream, or a frame of the tag, ended early
+#define ID3_ERR_NO_TAG          -2  // the stream does not start with an ID3v2 tag
+#define ID3_ERR_NO_PICTURE      -3  // the tag has no JPEG picture
+#define ID3_ERR_UNSUPPORTED     -4  // a tag version or layout this code does not read
+
+// Picture types of interest (ID3v2.3 section 4.15)
+#define ID3_PICTURE_OTHER       0x00
+#define ID3_PICTURE_FRONT_COVER 0x03
+
+// Reads up to len bytes into buf. Returns the number read, 0 at the end.
+typedef INT32U (*Id3ReadFn)(void *ctx, INT8U *buf, INT32U len);
+
+typedef struct
+{
+    INT32U size;            // bytes of image data
+    INT8U type;             // ID3_PICTURE_xxx
+} Id3Picture;
+
+Id3Err Id3FindPicture(Id3ReadFn read, void *ctx, Id3Picture *pPicture);
+
+#endif /* __ID3_H__ */
@@ -0,0 +1,227 @@
+/*
+    lcdBench.c
+    Startup benchmark of fills, text and shapes on the ILI9341 LCD.
+
+    Times three ways of filling the 240x320 screen:
+      per byte Ioctl - the original writedata(): select DC=data with an
+                       Ioctl before every byte
+      writedata      - writedata() with the DC state cached by the driver
+      fillScreen     - fillRect() -> pushPixels() -> PJDF_CTRL_LCD_FILL, a DMA
+                       fill with the CPU free
+
+    then the time to draw a short string at text sizes 1 to 3:
+      runs      - Adafruit_GFX::drawChar(), one fillRect() per vertical run
+                  of equal dots
+      window    - Adafruit_ILI9341::drawChar(), the glyph and its background
+                  expanded into one address window
+      clear     - transparent text, as drawn by the application
+
+    and a song title in the 5x7 font at size 2 against the 16 pixel run font,
+    opaque and transparent.
+
+    Last, the SPI traffic of lines, a circle, a button outline and a
+    triangle, which draw their points as runs of fast lines, against the
+    same points sent one drawPixel() window at a time.
+
+    Enable with APP_CFG_LCD_BENCH_EN in app_cfg.h. Call from the display task
+    after lcd.begin(); the screen is left black.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "print.h"
+#include "lcdBench.h"
+#include <dejaVuSansBold16.h>
+
+#if APP_CFG_LCD_BENCH_EN > 0u
+
+#define LCD_BENCH_PIXELS ((INT32U)ILI9341_TFTWIDTH * ILI9341_TFTHEIGHT)
+#define LCD_BENCH_TEXT   "playing..."
+#define LCD_BENCH_TITLE  "Dramatic Gopher"
+#define LCD_BENCH_REPEAT 20      // times the string is drawn per measurement
+
+enum lcdBenchTextMode { textRuns, textWindow, textClear };
+
+enum lcdBenchShape { shapeLine, shapeSteepLine, shapeCircle, shapeButton, shapeTriangle, NUM_SHAPES };
+
+// Counts the points a shape is made of, to price it at one window per point
+class LcdBenchPixelCounter : public Adafruit_GFX
+{
+public:
+    LcdBenchPixelCounter() : Adafruit_GFX(ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT), pixels(0) {}
+    void drawPixel(int16_t x, int16_t y, uint16_t color) { pixels++; }
+    INT32U pixels;
+};
+
+// Prints the time taken since start. The cycle count wraps after
+// 2^32 / SystemCoreClock seconds; the ms figure is always valid.
+static void LcdBenchReport(char *buf, char *name, INT32U startTicks, INT32U startCycles)
+{
+    INT32U cycles = DWT->CYCCNT - startCycles;
+    INT32U ticks = OSTimeGet() - startTicks;
+
+    PrintWithBuf(buf, PRINTBUFMAX, "LcdBench: %-15s %5lu ms (%lu cycles)\n",
+        name, ticks * 1000 / OS_TICKS_PER_SEC, cycles);
+}
+
+// Draws LCD_BENCH_TEXT LCD_BENCH_REPEAT times and prints the time per string
+static void LcdBenchText(Adafruit_ILI9341 &lcd, char *buf, INT8U size, enum lcdBenchTextMode mode)
+{
+    static char *modeNames[] = { "runs", "window", "clear" };
+    uint16_t bg = (mode == textClear) ? ILI9341_WHITE : ILI9341_BLACK;
+    INT32U startCycles;
+    INT32U cycles;
+
+    startCycles = DWT->CYCCNT;
+    for (int n = 0; n < LCD_BENCH_REPEAT; n++)
+    {
+        int16_t x = 0;
+        for (char *p = LCD_BENCH_TEXT; *p != 0; p++, x += 6 * size)
+        {
+            if (mode == textRuns)
+                lcd.Adafruit_GFX::drawChar(x, 0, *p, ILI9341_WHITE, bg, size);
+            else
+                lcd.drawChar(x, 0, *p, ILI9341_WHITE, bg, size);
+        }
+    }
+    cycles = (DWT->CYCCNT - startCycles) / LCD_BENCH_REPEAT;
+
+    PrintWithBuf(buf, PRINTBUFMAX, "LcdBench: text size %d %-6s %7lu cycles/string (%lu us)\n",
+        size, modeNames[mode], cycles, cycles / (SystemCoreClock / 1000000));
+}
+
+// Draws LCD_BENCH_TITLE LCD_BENCH_REPEAT times in font, NULL for the 5x7
+// font at size 2, and prints the time per string
+static void LcdBenchTitle(Adafruit_ILI9341 &lcd, char *buf, const RunFont *font, uint16_t bg)
+{
+    INT32U startCycles;
+    INT32U cycles;
+
+    lcd.setFont(font);
+    lcd.setTextSize(2);
+    lcd.setTextColor(ILI9341_WHITE, bg);
+    startCycles = DWT->CYCCNT;
+    for (int n = 0; n < LCD_BENCH_REPEAT; n++)
+    {
+        lcd.setCursor(0, 0);
+        for (char *p = LCD_BENCH_TITLE; *p != 0; p++) lcd.write(*p);
+    }
+    cycles = (DWT->CYCCNT - startCycles) / LCD_BENCH_REPEAT;
+    lcd.setFont(NULL);
+
+    PrintWithBuf(buf, PRINTBUFMAX, "LcdBench: title %-6s %-6s %7lu cycles/string (%lu us)\n",
+        font ? "run16" : "5x7x2", bg == ILI9341_WHITE ? "clear" : "window",
+        cycles, cycles / (SystemCoreClock / 1000000));
+}
+
+// Draws one of the benchmark shapes
+static void LcdBenchDrawShape(Adafruit_GFX &gfx, enum lcdBenchShape shape)
+{
+    switch (shape)
+    {
+    case shapeLine:      gfx.drawLine(10, 20, 230, 140, ILI9341_WHITE); break;
+    case shapeSteepLine: gfx.drawLine(20, 10, 100, 310, ILI9341_WHITE); break;
+    case shapeCircle:    gfx.drawCircle(120, 160, 100, ILI9341_WHITE); break;
+    case shapeButton:    gfx.drawRoundRect(33, 113, 75, 75, 8, ILI9341_WHITE); break;
+    case shapeTriangle:  gfx.drawTriangle(120, 20, 20, 300, 220, 260, ILI9341_WHITE); break;
+    default:             break;
+    }
+}
+
+// Prints the SPI bytes, transfers and DC switches of each shape, and what
+// they would be at one drawPixel() per point
+static void LcdBenchShapes(Adafruit_ILI9341 &lcd, char *buf)
+{
+    static char *shapeNames[NUM_SHAPES] = { "line", "steep line", "circle", "button", "triangle" };
+    Ili9341BusStats pixel;
+    Ili9341BusStats stats;
+    INT32U startCycles;
+    INT32U cycles;
+
+    lcd.resetBusStats();
+    lcd.drawPixel(0, 0, ILI9341_WHITE);
+    lcd.getBusStats(&pixel);
+
+    for (int i = 0; i < NUM_SHAPES; i++)
+    {
+        LcdBenchPixelCounter counter;
+        LcdBenchDrawShape(counter, (enum lcdBenchShape)i);
+
+        lcd.resetBusStats();
+        startCycles = DWT->CYCCNT;
+        LcdBenchDrawShape(lcd, (enum lcdBenchShape)i);
+        lcd.getBusStats(&stats);
+        cycles = DWT->CYCCNT - startCycles;
+
+        PrintWithBuf(buf, PRINTBUFMAX, "LcdBench: %-10s %5lu bytes %4lu transfers %4lu dc %7lu cycles;"
+            " per point %5lu bytes %4lu transfers %4lu dc\n",
+            shapeNames[i], stats.bytes, stats.transfers, stats.dcChanges, cycles,
+            counter.pixels * pixel.bytes, counter.pixels * pixel.transfers, counter.pixels * pixel.dcChanges);
+    }
+}
+
+// LcdBench
+// Prints the full screen fill time of the old per byte path and the new
+// streaming path, the per string cost of each text drawing path and the
+// bus traffic of the outline shapes.
+// lcd: an initialized LCD controller
+// hLcd: the LCD driver handle the controller uses
+void LcdBench(Adafruit_ILI9341 &lcd, HANDLE hLcd)
+{
+    char buf[PRINTBUFMAX];
+    INT32U startTicks;
+    INT32U startCycles;
+    INT32U i;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    lcd.setRotation(0); // window below covers the whole panel in portrait
+
+    startTicks = OSTimeGet();
+    startCycles = DWT->CYCCNT;
+    lcd.setAddrWindow(0, 0, ILI9341_TFTWIDTH - 1, ILI9341_TFTHEIGHT - 1);
+    for (i = 0; i < LCD_BENCH_PIXELS; i++)
+    {
+        Ioctl(hLcd, PJDF_CTRL_LCD_SELECT_DATA, 0, 0);
+        lcd.spiWriteByte(ILI9341_RED >> 8);
+        Ioctl(hLcd, PJDF_CTRL_LCD_SELECT_DATA, 0, 0);
+        lcd.spiWriteByte(ILI9341_RED & 0xFF);
+    }
+    lcd.spiFlush();
+    LcdBenchReport(buf, "per byte Ioctl", startTicks, startCycles);
+
+    startTicks = OSTimeGet();
+    startCycles = DWT->CYCCNT;
+    lcd.setAddrWindow(0, 0, ILI9341_TFTWIDTH - 1, ILI9341_TFTHEIGHT - 1);
+    for (i = 0; i < LCD_BENCH_PIXELS; i++)
+    {
+        lcd.writedata(ILI9341_GREEN >> 8);
+        lcd.writedata(ILI9341_GREEN & 0xFF);
+    }
+    lcd.spiFlush();
+    LcdBenchReport(buf, "writedata", startTicks, startCycles);
+
+    startTicks = OSTimeGet();
+    startCycles = DWT->CYCCNT;
+    lcd.fillScreen(ILI9341_BLACK);
+    LcdBenchReport(buf, "fillScreen", startTicks, startCycles);
+
+    for (INT8U size = 1; size <= 3; size++)
+    {
+        LcdBenchText(lcd, buf, size, textRuns);
+        LcdBenchText(lcd, buf, size, textWindow);
+        LcdBenchText(lcd, buf, size, textClear);
+    }
+    LcdBenchTitle(lcd, buf, NULL, ILI9341_BLACK);
+    LcdBenchTitle(lcd, buf, &dejaVuSansBold16, ILI9341_BLACK);
+    LcdBenchTitle(lcd, buf, NULL, ILI9341_WHITE);
+    LcdBenchTitle(lcd, buf, &dejaVuSansBold16, ILI9341_WHITE);
+    lcd.fillScreen(ILI9341_BLACK);
+
+    LcdBenchShapes(lcd, buf);
+    lcd.fillScreen(ILI9341_BLACK);
+}
+
+#endif // APP_CFG_LCD_BENCH_EN
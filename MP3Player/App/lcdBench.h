@@ -0,0 +1,20 @@
+/*
+    lcdBench.h
+    Startup benchmark of fills, text and shapes on the ILI9341 LCD.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __LCDBENCH_H__
+#define __LCDBENCH_H__
+
+#include <app_cfg.h>
+
+#if APP_CFG_LCD_BENCH_EN > 0u
+#include <Adafruit_ILI9341.h>
+void LcdBench(Adafruit_ILI9341 &lcd, HANDLE hLcd);
+#else
+#define LcdBench(lcd, hLcd)
+#endif
+
+#endif /* __LCDBENCH_H__ */
@@ -18,6 +18,7 @@ Revision History:
 
 #include "bsp.h"
 #include "print.h"
+#include "trace.h"
  
 // Prototype for startup task
 void StartupTask(void* pdata);
@@ -57,6 +58,9 @@ INT8U err;
         __TIME__));  
 
 
+    // Start the trace recorder before the kernel so the first context switch is captured
+    TraceInit();
+
     // Initialize the OS
     DEBUGMSG(1, ("main: Running OSInit()...\n"));
     OSInit();
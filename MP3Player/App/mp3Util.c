@@ -169,6 +169,66 @@ PjdfErrCode Mp3GetRegister(HANDLE hMp3, INT8U *cmdInDataOut, INT32U bufLen)
 }
 
 
+// Mp3GetDecodeTime
+// Gets SCI_DECODE_TIME, the seconds of audio decoded since the last reset.
+// Meant to be called between data writes while streaming: the read waits
+// for DREQ, so call it when the decoder has room, and the driver is left
+// in data mode.
+// hMp3: an open handle to the MP3 decoder
+// Returns: the decode time in seconds
+INT16U Mp3GetDecodeTime(HANDLE hMp3)
+{
+    INT8U cmd[4];
+
+    memcpy(cmd, BspMp3ReadDecodeTime, BspMp3ReadDecodeTimeLen);
+    Mp3GetRegister(hMp3, cmd, BspMp3ReadDecodeTimeLen);
+    Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_DATA, 0, 0);
+    return (cmd[2] << 8) | cmd[3];
+}
+
+
+// Mp3SetDecodeTime
+// Sets SCI_DECODE_TIME, after a jump in the stream say. The decoder may
+// count up between two writes, so the register is written twice. The
+// driver is left in data mode.
+// hMp3: an open handle to the MP3 decoder
+// seconds: the decode time to count on from
+void Mp3SetDecodeTime(HANDLE hMp3, INT16U seconds)
+{
+    INT8U cmd[4];
+    INT32U length;
+
+    memcpy(cmd, BspMp3WriteDecodeTime, BspMp3WriteDecodeTimeLen);
+    cmd[2] = (INT8U)(seconds >> 8);
+    cmd[3] = (INT8U)seconds;
+    Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_COMMAND, 0, 0);
+    for (int i = 0; i < 2; i++)
+    {
+        length = BspMp3WriteDecodeTimeLen;
+        Write(hMp3, cmd, &length);
+    }
+    Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_DATA, 0, 0);
+}
+
+
+// Mp3SetVolume
+// Sets SCI_VOL, the same for both channels. A reset puts back the default,
+// so call after each soft reset. The driver is left in data mode.
+// hMp3: an open handle to the MP3 decoder
+// attenuation: 0 for full volume, down in 0.5 dB steps to 0xFE, silence
+void Mp3SetVolume(HANDLE hMp3, INT8U attenuation)
+{
+    INT8U cmd[4];
+    INT32U length = BspMp3SetVol1010Len;
+
+    memcpy(cmd, BspMp3SetVol1010, BspMp3SetVol1010Len);
+    cmd[2] = cmd[3] = attenuation;
+    Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_COMMAND, 0, 0);
+    Write(hMp3, cmd, &length);
+    Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_DATA, 0, 0);
+}
+
+
 // Mp3Test
 // Runs sine wave sound test on the MP3 decoder.
 // For VS1053, the sine wave test only works if run immediately after a hard 
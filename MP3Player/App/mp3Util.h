@@ -12,6 +12,9 @@
 
 
 PjdfErrCode Mp3GetRegister(HANDLE hMp3, INT8U *cmdInDataOut, INT32U bufLen);
+INT16U Mp3GetDecodeTime(HANDLE hMp3);
+void Mp3SetDecodeTime(HANDLE hMp3, INT16U seconds);
+void Mp3SetVolume(HANDLE hMp3, INT8U attenuation);
 void Mp3Init(HANDLE hMp3);
 void Mp3Test(HANDLE hMp3);
 void Mp3Stream(HANDLE hMp3, INT8U *pBuf, INT32U bufLen);
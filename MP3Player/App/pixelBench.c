@@ -0,0 +1,108 @@
+/*
+    pixelBench.c
+    Startup benchmark of the pixel kernels, reference against fast.
+
+    Runs each kernel of pixelKernels.h over a 240 pixel line, a row of the
+    panel, with the reference and the fast version, and prints the cycles
+    per pixel of each and whether their results match. Tools/pixelTest.cpp
+    checks the kernels more thoroughly on a PC.
+
+    Enable with APP_CFG_PIXEL_BENCH_EN in app_cfg.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "print.h"
+#include "pixelKernels.h"
+#include "pixelBench.h"
+
+#if APP_CFG_PIXEL_BENCH_EN > 0u
+
+#define PIXEL_BENCH_LINE    240     // pixels
+#define PIXEL_BENCH_REPEAT  20      // times each kernel is run per measurement
+
+enum pixelBenchKernel { kernelRgb888, kernelSwap, kernelBlend, kernelBlendColor, kernelDownscale, NUM_KERNELS };
+
+static INT8U benchRgb[PIXEL_BENCH_LINE * 3];
+static INT8U benchAlpha[PIXEL_BENCH_LINE];
+static INT16U benchFg[PIXEL_BENCH_LINE];
+static INT16U benchBox[PIXEL_BENCH_LINE * 2];
+static INT16U benchOut[2][PIXEL_BENCH_LINE];
+static INT8U benchBytes[2][PIXEL_BENCH_LINE * 2 + 1];
+
+// Runs one kernel into output set out, returns the pixels it made
+static INT32U PixelBenchRun(enum pixelBenchKernel kernel, BOOLEAN fast, INT8U out)
+{
+    switch (kernel)
+    {
+    case kernelRgb888:
+        if (fast) PixelRgb888To565(benchRgb, benchOut[out], PIXEL_BENCH_LINE);
+        else PixelRgb888To565Ref(benchRgb, benchOut[out], PIXEL_BENCH_LINE);
+        return PIXEL_BENCH_LINE;
+    case kernelSwap:
+        // Odd destination, as in the LCD driver's SPI buffer
+        if (fast) PixelSwap565(benchFg, &benchBytes[out][1], PIXEL_BENCH_LINE);
+        else PixelSwap565Ref(benchFg, &benchBytes[out][1], PIXEL_BENCH_LINE);
+        return PIXEL_BENCH_LINE;
+    case kernelBlend:
+        if (fast) PixelBlend565(benchFg, benchBox, benchAlpha, benchOut[out], PIXEL_BENCH_LINE);
+        else PixelBlend565Ref(benchFg, benchBox, benchAlpha, benchOut[out], PIXEL_BENCH_LINE);
+        return PIXEL_BENCH_LINE;
+    case kernelBlendColor:
+        if (fast) PixelBlendColor565(0xFFE0, benchBox, benchAlpha, benchOut[out], PIXEL_BENCH_LINE);
+        else PixelBlendColor565Ref(0xFFE0, benchBox, benchAlpha, benchOut[out], PIXEL_BENCH_LINE);
+        return PIXEL_BENCH_LINE;
+    case kernelDownscale:
+        if (fast) PixelDownscale565(benchBox, PIXEL_BENCH_LINE, benchOut[out], PIXEL_BENCH_LINE / 2, 1);
+        else PixelDownscale565Ref(benchBox, PIXEL_BENCH_LINE, benchOut[out], PIXEL_BENCH_LINE / 2, 1);
+        return PIXEL_BENCH_LINE / 2;
+    }
+    return 0;
+}
+
+// Cycles per pixel, in hundredths, of PIXEL_BENCH_REPEAT runs
+static INT32U PixelBenchTime(enum pixelBenchKernel kernel, BOOLEAN fast)
+{
+    INT32U pixels = 0;
+    INT32U start = DWT->CYCCNT;
+    for (int n = 0; n < PIXEL_BENCH_REPEAT; n++) pixels += PixelBenchRun(kernel, fast, fast);
+    return (DWT->CYCCNT - start) * 100 / pixels;
+}
+
+// PixelBench
+// Prints the cost of each pixel kernel. Call from the startup task.
+void PixelBench(void)
+{
+    static const char *names[NUM_KERNELS] = { "rgb888To565", "swap565", "blend565", "blendColor565", "downscale565" };
+    char buf[PRINTBUFMAX];
+    INT32U seed = 1;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    // Random pixels; text-like alpha, mostly clear or solid
+    for (int i = 0; i < PIXEL_BENCH_LINE * 3; i++)
+    {
+        seed = seed * 1664525 + 1013904223;
+        benchRgb[i] = seed >> 24;
+        if (i < PIXEL_BENCH_LINE * 2) benchBox[i] = seed >> 8;
+        if (i < PIXEL_BENCH_LINE) benchFg[i] = seed >> 16;
+        if (i < PIXEL_BENCH_LINE) benchAlpha[i] = (seed >> 28) < 6 ? 0 : ((seed >> 28) < 12 ? 255 : seed >> 20);
+    }
+
+    PrintWithBuf(buf, PRINTBUFMAX, "PixelBench: PIXEL_SIMD_EN = %d, cycles per pixel\n", PIXEL_SIMD_EN);
+    for (int k = 0; k < NUM_KERNELS; k++)
+    {
+        INT32U ref = PixelBenchTime((enum pixelBenchKernel)k, 0);
+        INT32U fast = PixelBenchTime((enum pixelBenchKernel)k, 1);
+        BOOLEAN same = (k == kernelSwap) ?
+            memcmp(benchBytes[0], benchBytes[1], sizeof(benchBytes[0])) == 0 :
+            memcmp(benchOut[0], benchOut[1], sizeof(benchOut[0])) == 0;
+
+        PrintWithBuf(buf, PRINTBUFMAX, "PixelBench: %-14s ref %3lu.%02lu fast %3lu.%02lu %s\n",
+            names[k], ref / 100, ref % 100, fast / 100, fast % 100, same ? "" : "MISMATCH");
+    }
+}
+
+#endif // APP_CFG_PIXEL_BENCH_EN
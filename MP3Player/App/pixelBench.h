@@ -0,0 +1,19 @@
+/*
+    pixelBench.h
+    Startup benchmark of the pixel kernels, reference against fast.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __PIXELBENCH_H__
+#define __PIXELBENCH_H__
+
+#include <app_cfg.h>
+
+#if APP_CFG_PIXEL_BENCH_EN > 0u
+void PixelBench(void);
+#else
+#define PixelBench()
+#endif
+
+#endif /* __PIXELBENCH_H__ */
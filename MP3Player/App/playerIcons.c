@@ -0,0 +1,619 @@
+/*
+    playerIcons.c
+    8 sprites over background 0x0000.
+    Generated by Tools/spriteGen.cpp, do not edit.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "playerIcons.h"
+
+static const uint8_t playerIconsRuns[9560] = {
+    0x0b, 0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 
+    0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x15, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 
+    0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 0x0c, 0x11, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 
+    0x01, 0xff, 0xff, 0x83, 0xf7, 0xde, 0xa6, 0xf4, 0x66, 0x2c, 0x45, 0xc8, 0x2a, 0x05, 0x00, 0x83, 
+    0x45, 0xc8, 0x66, 0x2c, 0xa6, 0xf4, 0xf7, 0xde, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 
+    0x0d, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x81, 0xe7, 0xbc, 0x66, 0x2c, 
+    0x32, 0x05, 0x00, 0x81, 0x66, 0x2c, 0xe7, 0xbc, 0x01, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 
+    0x0a, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xf7, 0xde, 0x76, 0x6e, 0x36, 0x05, 
+    0x00, 0x84, 0x76, 0x6e, 0xf7, 0xde, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x84, 
+    0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xd7, 0x7a, 0x35, 0xa6, 0x38, 0x05, 0x00, 0x84, 0x35, 0xa6, 
+    0xd7, 0x7a, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 
+    0xff, 0xff, 0xd7, 0x7a, 0x15, 0x42, 0x3a, 0x05, 0x00, 0x84, 0x15, 0x42, 0xd7, 0x7a, 0xff, 0xff, 
+    0xd6, 0x9a, 0x10, 0x82, 0x05, 0x00, 0x00, 0x83, 0xa5, 0x14, 0xff, 0xff, 0xd7, 0x7a, 0x15, 0x42, 
+    0x3c, 0x05, 0x00, 0x83, 0x15, 0x42, 0xd7, 0x7a, 0xff, 0xff, 0xa5, 0x14, 0x04, 0x00, 0x00, 0x83, 
+    0x42, 0x08, 0xff, 0xff, 0xf7, 0xde, 0x35, 0xa6, 0x3e, 0x05, 0x00, 0x83, 0x35, 0xa6, 0xf7, 0xde, 
+    0xff, 0xff, 0x42, 0x08, 0x03, 0x00, 0x00, 0x82, 0xe7, 0x1c, 0xff, 0xff, 0x76, 0x6e, 0x40, 0x05, 
+    0x00, 0x82, 0x76, 0x6e, 0xff, 0xff, 0xe7, 0x1c, 0x02, 0x00, 0x00, 0x82, 0x63, 0x0c, 0xff, 0xff, 
+    0xe7, 0xbc, 0x42, 0x05, 0x00, 0x82, 0xe7, 0xbc, 0xff, 0xff, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x82, 
+    0xd6, 0x9a, 0xff, 0xff, 0x66, 0x2c, 0x42, 0x05, 0x00, 0x86, 0x66, 0x2c, 0xff, 0xff, 0xd6, 0x9a, 
+    0x00, 0x00, 0x21, 0x04, 0xff, 0xff, 0xf7, 0xde, 0x44, 0x05, 0x00, 0x85, 0xf7, 0xde, 0xff, 0xff, 
+    0x21, 0x04, 0x73, 0x8e, 0xff, 0xff, 0xa6, 0xf4, 0x44, 0x05, 0x00, 0x85, 0xa6, 0xf4, 0xff, 0xff, 
+    0x73, 0x8e, 0xb5, 0x96, 0xff, 0xff, 0x66, 0x2c, 0x44, 0x05, 0x00, 0x85, 0x66, 0x2c, 0xff, 0xff, 
+    0xb5, 0x96, 0xc6, 0x18, 0xff, 0xff, 0x45, 0xc8, 0x44, 0x05, 0x00, 0x82, 0x45, 0xc8, 0xff, 0xff, 
+    0xc6, 0x18, 0x01, 0xff, 0xff, 0x46, 0x05, 0x00, 0x03, 0xff, 0xff, 0x46, 0x05, 0x00, 0x03, 0xff, 
+    0xff, 0x46, 0x05, 0x00, 0x03, 0xff, 0xff, 0x46, 0x05, 0x00, 0x03, 0xff, 0xff, 0x46, 0x05, 0x00, 
+    0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x81, 0xb7, 0x16, 0x25, 0x64, 0x2a, 0x05, 0x00, 0x03, 0xff, 
+    0xff, 0x19, 0x05, 0x00, 0x82, 0xff, 0xff, 0xf7, 0xde, 0x86, 0x90, 0x29, 0x05, 0x00, 0x03, 0xff, 
+    0xff, 0x19, 0x05, 0x00, 0x02, 0xff, 0xff, 0x81, 0xe7, 0xbc, 0x45, 0xc8, 0x27, 0x05, 0x00, 0x03, 
+    0xff, 0xff, 0x19, 0x05, 0x00, 0x04, 0xff, 0xff, 0x81, 0xa6, 0xf4, 0x15, 0x42, 0x25, 0x05, 0x00, 
+    0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x05, 0xff, 0xff, 0x81, 0xf7, 0xde, 0x76, 0x6e, 0x24, 0x05, 
+    0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x07, 0xff, 0xff, 0x81, 0xd7, 0x7a, 0x35, 0xa6, 0x22, 
+    0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x09, 0xff, 0xff, 0x81, 0x96, 0xb2, 0x15, 0x42, 
+    0x20, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x0a, 0xff, 0xff, 0x81, 0xf7, 0xde, 0x66, 
+    0x2c, 0x1f, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x0c, 0xff, 0xff, 0x81, 0xc7, 0x58, 
+    0x25, 0x64, 0x1d, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x0e, 0xff, 0xff, 0x81, 0x86, 
+    0x90, 0x15, 0x42, 0x1b, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x0f, 0xff, 0xff, 0x81, 
+    0xe7, 0xbc, 0x56, 0x0a, 0x1a, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x11, 0xff, 0xff, 
+    0x81, 0xb7, 0x16, 0x25, 0x64, 0x18, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x12, 0xff, 
+    0xff, 0x81, 0xf7, 0xde, 0x86, 0x90, 0x17, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x14, 
+    0xff, 0xff, 0x81, 0xe7, 0xbc, 0x45, 0xc8, 0x15, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 
+    0x16, 0xff, 0xff, 0x81, 0xa6, 0xf4, 0x15, 0x42, 0x13, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 
+    0x00, 0x17, 0xff, 0xff, 0x81, 0xf7, 0xde, 0x76, 0x6e, 0x12, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 
+    0x05, 0x00, 0x19, 0xff, 0xff, 0x80, 0xa6, 0xf4, 0x11, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 
+    0x00, 0x17, 0xff, 0xff, 0x81, 0xf7, 0xde, 0x76, 0x6e, 0x12, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 
+    0x05, 0x00, 0x16, 0xff, 0xff, 0x81, 0xa6, 0xf4, 0x15, 0x42, 0x13, 0x05, 0x00, 0x03, 0xff, 0xff, 
+    0x19, 0x05, 0x00, 0x14, 0xff, 0xff, 0x81, 0xe7, 0xbc, 0x45, 0xc8, 0x15, 0x05, 0x00, 0x03, 0xff, 
+    0xff, 0x19, 0x05, 0x00, 0x12, 0xff, 0xff, 0x81, 0xf7, 0xde, 0x86, 0x90, 0x17, 0x05, 0x00, 0x03, 
+    0xff, 0xff, 0x19, 0x05, 0x00, 0x11, 0xff, 0xff, 0x81, 0xb7, 0x16, 0x25, 0x64, 0x18, 0x05, 0x00, 
+    0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x0f, 0xff, 0xff, 0x81, 0xe7, 0xbc, 0x56, 0x0a, 0x1a, 0x05, 
+    0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x0e, 0xff, 0xff, 0x81, 0x86, 0x90, 0x15, 0x42, 0x1b, 
+    0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x0c, 0xff, 0xff, 0x81, 0xc7, 0x58, 0x25, 0x64, 
+    0x1d, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x0a, 0xff, 0xff, 0x81, 0xf7, 0xde, 0x66, 
+    0x2c, 0x1f, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x09, 0xff, 0xff, 0x81, 0x96, 0xb2, 
+    0x15, 0x42, 0x20, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x07, 0xff, 0xff, 0x81, 0xd7, 
+    0x7a, 0x35, 0xa6, 0x22, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x05, 0xff, 0xff, 0x81, 
+    0xf7, 0xde, 0x76, 0x6e, 0x24, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x04, 0xff, 0xff, 
+    0x81, 0xa6, 0xf4, 0x15, 0x42, 0x25, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x02, 0xff, 
+    0xff, 0x81, 0xe7, 0xbc, 0x45, 0xc8, 0x27, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x82, 
+    0xff, 0xff, 0xf7, 0xde, 0x86, 0x90, 0x29, 0x05, 0x00, 0x03, 0xff, 0xff, 0x19, 0x05, 0x00, 0x81, 
+    0xb7, 0x16, 0x25, 0x64, 0x2a, 0x05, 0x00, 0x03, 0xff, 0xff, 0x46, 0x05, 0x00, 0x03, 0xff, 0xff, 
+    0x46, 0x05, 0x00, 0x03, 0xff, 0xff, 0x46, 0x05, 0x00, 0x03, 0xff, 0xff, 0x46, 0x05, 0x00, 0x03, 
+    0xff, 0xff, 0x46, 0x05, 0x00, 0x01, 0xff, 0xff, 0x82, 0xc6, 0x18, 0xff, 0xff, 0x45, 0xc8, 0x44, 
+    0x05, 0x00, 0x85, 0x45, 0xc8, 0xff, 0xff, 0xc6, 0x18, 0xb5, 0x96, 0xff, 0xff, 0x66, 0x2c, 0x44, 
+    0x05, 0x00, 0x85, 0x66, 0x2c, 0xff, 0xff, 0xb5, 0x96, 0x73, 0x8e, 0xff, 0xff, 0xa6, 0xf4, 0x44, 
+    0x05, 0x00, 0x85, 0xa6, 0xf4, 0xff, 0xff, 0x73, 0x8e, 0x21, 0x04, 0xff, 0xff, 0xf7, 0xde, 0x44, 
+    0x05, 0x00, 0x86, 0xf7, 0xde, 0xff, 0xff, 0x21, 0x04, 0x00, 0x00, 0xd6, 0x9a, 0xff, 0xff, 0x66, 
+    0x2c, 0x42, 0x05, 0x00, 0x82, 0x66, 0x2c, 0xff, 0xff, 0xd6, 0x9a, 0x01, 0x00, 0x00, 0x82, 0x63, 
+    0x0c, 0xff, 0xff, 0xe7, 0xbc, 0x42, 0x05, 0x00, 0x82, 0xe7, 0xbc, 0xff, 0xff, 0x63, 0x0c, 0x02, 
+    0x00, 0x00, 0x82, 0xe7, 0x1c, 0xff, 0xff, 0x76, 0x6e, 0x40, 0x05, 0x00, 0x82, 0x76, 0x6e, 0xff, 
+    0xff, 0xe7, 0x1c, 0x03, 0x00, 0x00, 0x83, 0x42, 0x08, 0xff, 0xff, 0xf7, 0xde, 0x35, 0xa6, 0x3e, 
+    0x05, 0x00, 0x83, 0x35, 0xa6, 0xf7, 0xde, 0xff, 0xff, 0x42, 0x08, 0x04, 0x00, 0x00, 0x83, 0xa5, 
+    0x14, 0xff, 0xff, 0xd7, 0x7a, 0x15, 0x42, 0x3c, 0x05, 0x00, 0x83, 0x15, 0x42, 0xd7, 0x7a, 0xff, 
+    0xff, 0xa5, 0x14, 0x05, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xd7, 0x7a, 0x15, 
+    0x42, 0x3a, 0x05, 0x00, 0x84, 0x15, 0x42, 0xd7, 0x7a, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x06, 
+    0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xd7, 0x7a, 0x35, 0xa6, 0x38, 0x05, 0x00, 
+    0x84, 0x35, 0xa6, 0xd7, 0x7a, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x84, 0x10, 
+    0x82, 0xd6, 0x9a, 0xff, 0xff, 0xf7, 0xde, 0x76, 0x6e, 0x36, 0x05, 0x00, 0x84, 0x76, 0x6e, 0xf7, 
+    0xde, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x01, 
+    0xff, 0xff, 0x81, 0xe7, 0xbc, 0x66, 0x2c, 0x32, 0x05, 0x00, 0x81, 0x66, 0x2c, 0xe7, 0xbc, 0x01, 
+    0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 0x0d, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x01, 
+    0xff, 0xff, 0x83, 0xf7, 0xde, 0xa6, 0xf4, 0x66, 0x2c, 0x45, 0xc8, 0x2a, 0x05, 0x00, 0x83, 0x45, 
+    0xc8, 0x66, 0x2c, 0xa6, 0xf4, 0xf7, 0xde, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 0x11, 
+    0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 0x0c, 0x15, 
+    0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 
+    0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x83, 0x21, 0x04, 
+    0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 
+    0x21, 0x04, 0x15, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 
+    0x63, 0x0c, 0x11, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x36, 0xff, 0xff, 0x81, 0xe7, 0x1c, 
+    0x42, 0x08, 0x0d, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x3a, 0xff, 0xff, 0x81, 0xa5, 0x14, 
+    0x10, 0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3c, 0xff, 0xff, 0x81, 0xd6, 0x9a, 
+    0x10, 0x82, 0x08, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3e, 0xff, 0xff, 0x81, 0xd6, 0x9a, 
+    0x10, 0x82, 0x06, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x40, 0xff, 0xff, 0x81, 0xd6, 0x9a, 
+    0x10, 0x82, 0x05, 0x00, 0x00, 0x80, 0xa5, 0x14, 0x42, 0xff, 0xff, 0x80, 0xa5, 0x14, 0x04, 0x00, 
+    0x00, 0x80, 0x42, 0x08, 0x44, 0xff, 0xff, 0x80, 0x42, 0x08, 0x03, 0x00, 0x00, 0x80, 0xe7, 0x1c, 
+    0x44, 0xff, 0xff, 0x80, 0xe7, 0x1c, 0x02, 0x00, 0x00, 0x80, 0x63, 0x0c, 0x46, 0xff, 0xff, 0x80, 
+    0x63, 0x0c, 0x01, 0x00, 0x00, 0x80, 0xd6, 0x9a, 0x46, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x00, 0x00, 
+    0x21, 0x04, 0x48, 0xff, 0xff, 0x81, 0x21, 0x04, 0x73, 0x8e, 0x48, 0xff, 0xff, 0x81, 0x73, 0x8e, 
+    0xb5, 0x96, 0x48, 0xff, 0xff, 0x81, 0xb5, 0x96, 0xc6, 0x18, 0x48, 0xff, 0xff, 0x80, 0xc6, 0x18, 
+    0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x12, 0xff, 0xff, 0x81, 0x56, 0x0a, 0xe7, 
+    0xbc, 0x48, 0xff, 0xff, 0x82, 0x05, 0x00, 0x15, 0x42, 0x86, 0x90, 0x47, 0xff, 0xff, 0x02, 0x05, 
+    0x00, 0x81, 0x25, 0x64, 0xc7, 0x58, 0x45, 0xff, 0xff, 0x04, 0x05, 0x00, 0x81, 0x66, 0x2c, 0xf7, 
+    0xde, 0x43, 0xff, 0xff, 0x05, 0x05, 0x00, 0x81, 0x15, 0x42, 0x96, 0xb2, 0x42, 0xff, 0xff, 0x07, 
+    0x05, 0x00, 0x81, 0x35, 0xa6, 0xd7, 0x7a, 0x40, 0xff, 0xff, 0x09, 0x05, 0x00, 0x81, 0x76, 0x6e, 
+    0xf7, 0xde, 0x3e, 0xff, 0xff, 0x0a, 0x05, 0x00, 0x81, 0x15, 0x42, 0xa6, 0xf4, 0x3d, 0xff, 0xff, 
+    0x0c, 0x05, 0x00, 0x81, 0x45, 0xc8, 0xe7, 0xbc, 0x3b, 0xff, 0xff, 0x0e, 0x05, 0x00, 0x81, 0x86, 
+    0x90, 0xf7, 0xde, 0x39, 0xff, 0xff, 0x0f, 0x05, 0x00, 0x81, 0x25, 0x64, 0xb7, 0x16, 0x38, 0xff, 
+    0xff, 0x11, 0x05, 0x00, 0x81, 0x56, 0x0a, 0xe7, 0xbc, 0x36, 0xff, 0xff, 0x12, 0x05, 0x00, 0x81, 
+    0x15, 0x42, 0x86, 0x90, 0x35, 0xff, 0xff, 0x14, 0x05, 0x00, 0x81, 0x25, 0x64, 0xc7, 0x58, 0x33, 
+    0xff, 0xff, 0x16, 0x05, 0x00, 0x81, 0x66, 0x2c, 0xf7, 0xde, 0x31, 0xff, 0xff, 0x17, 0x05, 0x00, 
+    0x81, 0x15, 0x42, 0x96, 0xb2, 0x30, 0xff, 0xff, 0x19, 0x05, 0x00, 0x80, 0x66, 0x2c, 0x2f, 0xff, 
+    0xff, 0x17, 0x05, 0x00, 0x81, 0x15, 0x42, 0x96, 0xb2, 0x30, 0xff, 0xff, 0x16, 0x05, 0x00, 0x81, 
+    0x66, 0x2c, 0xf7, 0xde, 0x31, 0xff, 0xff, 0x14, 0x05, 0x00, 0x81, 0x25, 0x64, 0xc7, 0x58, 0x33, 
+    0xff, 0xff, 0x12, 0x05, 0x00, 0x81, 0x15, 0x42, 0x86, 0x90, 0x35, 0xff, 0xff, 0x11, 0x05, 0x00, 
+    0x81, 0x56, 0x0a, 0xe7, 0xbc, 0x36, 0xff, 0xff, 0x0f, 0x05, 0x00, 0x81, 0x25, 0x64, 0xb7, 0x16, 
+    0x38, 0xff, 0xff, 0x0e, 0x05, 0x00, 0x81, 0x86, 0x90, 0xf7, 0xde, 0x39, 0xff, 0xff, 0x0c, 0x05, 
+    0x00, 0x81, 0x45, 0xc8, 0xe7, 0xbc, 0x3b, 0xff, 0xff, 0x0a, 0x05, 0x00, 0x81, 0x15, 0x42, 0xa6, 
+    0xf4, 0x3d, 0xff, 0xff, 0x09, 0x05, 0x00, 0x81, 0x76, 0x6e, 0xf7, 0xde, 0x3e, 0xff, 0xff, 0x07, 
+    0x05, 0x00, 0x81, 0x35, 0xa6, 0xd7, 0x7a, 0x40, 0xff, 0xff, 0x05, 0x05, 0x00, 0x81, 0x15, 0x42, 
+    0x96, 0xb2, 0x42, 0xff, 0xff, 0x04, 0x05, 0x00, 0x81, 0x66, 0x2c, 0xf7, 0xde, 0x43, 0xff, 0xff, 
+    0x02, 0x05, 0x00, 0x81, 0x25, 0x64, 0xc7, 0x58, 0x45, 0xff, 0xff, 0x82, 0x05, 0x00, 0x15, 0x42, 
+    0x86, 0x90, 0x47, 0xff, 0xff, 0x81, 0x56, 0x0a, 0xe7, 0xbc, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 
+    0x7f, 0xff, 0xff, 0x23, 0xff, 0xff, 0x80, 0xc6, 0x18, 0x48, 0xff, 0xff, 0x81, 0xc6, 0x18, 0xb5, 
+    0x96, 0x48, 0xff, 0xff, 0x81, 0xb5, 0x96, 0x73, 0x8e, 0x48, 0xff, 0xff, 0x81, 0x73, 0x8e, 0x21, 
+    0x04, 0x48, 0xff, 0xff, 0x82, 0x21, 0x04, 0x00, 0x00, 0xd6, 0x9a, 0x46, 0xff, 0xff, 0x80, 0xd6, 
+    0x9a, 0x01, 0x00, 0x00, 0x80, 0x63, 0x0c, 0x46, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x02, 0x00, 0x00, 
+    0x80, 0xe7, 0x1c, 0x44, 0xff, 0xff, 0x80, 0xe7, 0x1c, 0x03, 0x00, 0x00, 0x80, 0x42, 0x08, 0x44, 
+    0xff, 0xff, 0x80, 0x42, 0x08, 0x04, 0x00, 0x00, 0x80, 0xa5, 0x14, 0x42, 0xff, 0xff, 0x80, 0xa5, 
+    0x14, 0x05, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x40, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 
+    0x82, 0x06, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3e, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 
+    0x82, 0x08, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3c, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 
+    0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x3a, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 
+    0x82, 0x0d, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x36, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 
+    0x08, 0x11, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 
+    0x0c, 0x15, 0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 
+    0x83, 0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x83, 
+    0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 0x96, 
+    0x73, 0x8e, 0x21, 0x04, 0x15, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 
+    0xd6, 0x9a, 0x63, 0x0c, 0x11, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x01, 0xff, 0xff, 0x83, 
+    0xff, 0x9e, 0xed, 0x14, 0xe3, 0x0c, 0xda, 0x08, 0x2a, 0xc8, 0x00, 0x83, 0xda, 0x08, 0xe3, 0x0c, 
+    0xed, 0x14, 0xff, 0x9e, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 0x0d, 0x00, 0x00, 0x81, 
+    0x10, 0x82, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x81, 0xff, 0x1c, 0xe3, 0x0c, 0x32, 0xc8, 0x00, 0x81, 
+    0xe3, 0x0c, 0xff, 0x1c, 0x01, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x84, 
+    0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xff, 0x9e, 0xe3, 0x8e, 0x36, 0xc8, 0x00, 0x84, 0xe3, 0x8e, 
+    0xff, 0x9e, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 
+    0xff, 0xff, 0xfe, 0x9a, 0xd1, 0x86, 0x38, 0xc8, 0x00, 0x84, 0xd1, 0x86, 0xfe, 0x9a, 0xff, 0xff, 
+    0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xfe, 0x9a, 
+    0xc8, 0x82, 0x3a, 0xc8, 0x00, 0x84, 0xc8, 0x82, 0xfe, 0x9a, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 
+    0x05, 0x00, 0x00, 0x83, 0xa5, 0x14, 0xff, 0xff, 0xfe, 0x9a, 0xc8, 0x82, 0x3c, 0xc8, 0x00, 0x83, 
+    0xc8, 0x82, 0xfe, 0x9a, 0xff, 0xff, 0xa5, 0x14, 0x04, 0x00, 0x00, 0x83, 0x42, 0x08, 0xff, 0xff, 
+    0xff, 0x9e, 0xd1, 0x86, 0x3e, 0xc8, 0x00, 0x83, 0xd1, 0x86, 0xff, 0x9e, 0xff, 0xff, 0x42, 0x08, 
+    0x03, 0x00, 0x00, 0x82, 0xe7, 0x1c, 0xff, 0xff, 0xe3, 0x8e, 0x40, 0xc8, 0x00, 0x82, 0xe3, 0x8e, 
+    0xff, 0xff, 0xe7, 0x1c, 0x02, 0x00, 0x00, 0x82, 0x63, 0x0c, 0xff, 0xff, 0xff, 0x1c, 0x42, 0xc8, 
+    0x00, 0x82, 0xff, 0x1c, 0xff, 0xff, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x82, 0xd6, 0x9a, 0xff, 0xff, 
+    0xe3, 0x0c, 0x42, 0xc8, 0x00, 0x86, 0xe3, 0x0c, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x00, 0x21, 0x04, 
+    0xff, 0xff, 0xff, 0x9e, 0x44, 0xc8, 0x00, 0x85, 0xff, 0x9e, 0xff, 0xff, 0x21, 0x04, 0x73, 0x8e, 
+    0xff, 0xff, 0xed, 0x14, 0x44, 0xc8, 0x00, 0x85, 0xed, 0x14, 0xff, 0xff, 0x73, 0x8e, 0xb5, 0x96, 
+    0xff, 0xff, 0xe3, 0x0c, 0x44, 0xc8, 0x00, 0x85, 0xe3, 0x0c, 0xff, 0xff, 0xb5, 0x96, 0xc6, 0x18, 
+    0xff, 0xff, 0xda, 0x08, 0x44, 0xc8, 0x00, 0x82, 0xda, 0x08, 0xff, 0xff, 0xc6, 0x18, 0x01, 0xff, 
+    0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 
+    0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 
+    0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 
+    0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 
+    0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 
+    0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 
+    0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 
+    0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 
+    0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 
+    0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 
+    0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 
+    0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 
+    0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 
+    0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 
+    0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 
+    0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 
+    0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 
+    0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 
+    0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 
+    0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 
+    0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 
+    0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 
+    0x1a, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x15, 0xc8, 0x00, 0x1a, 0xff, 0xff, 0x15, 
+    0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 
+    0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 
+    0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 0xc8, 0x00, 0x03, 0xff, 0xff, 0x46, 
+    0xc8, 0x00, 0x01, 0xff, 0xff, 0x82, 0xc6, 0x18, 0xff, 0xff, 0xda, 0x08, 0x44, 0xc8, 0x00, 0x85, 
+    0xda, 0x08, 0xff, 0xff, 0xc6, 0x18, 0xb5, 0x96, 0xff, 0xff, 0xe3, 0x0c, 0x44, 0xc8, 0x00, 0x85, 
+    0xe3, 0x0c, 0xff, 0xff, 0xb5, 0x96, 0x73, 0x8e, 0xff, 0xff, 0xed, 0x14, 0x44, 0xc8, 0x00, 0x85, 
+    0xed, 0x14, 0xff, 0xff, 0x73, 0x8e, 0x21, 0x04, 0xff, 0xff, 0xff, 0x9e, 0x44, 0xc8, 0x00, 0x86, 
+    0xff, 0x9e, 0xff, 0xff, 0x21, 0x04, 0x00, 0x00, 0xd6, 0x9a, 0xff, 0xff, 0xe3, 0x0c, 0x42, 0xc8, 
+    0x00, 0x82, 0xe3, 0x0c, 0xff, 0xff, 0xd6, 0x9a, 0x01, 0x00, 0x00, 0x82, 0x63, 0x0c, 0xff, 0xff, 
+    0xff, 0x1c, 0x42, 0xc8, 0x00, 0x82, 0xff, 0x1c, 0xff, 0xff, 0x63, 0x0c, 0x02, 0x00, 0x00, 0x82, 
+    0xe7, 0x1c, 0xff, 0xff, 0xe3, 0x8e, 0x40, 0xc8, 0x00, 0x82, 0xe3, 0x8e, 0xff, 0xff, 0xe7, 0x1c, 
+    0x03, 0x00, 0x00, 0x83, 0x42, 0x08, 0xff, 0xff, 0xff, 0x9e, 0xd1, 0x86, 0x3e, 0xc8, 0x00, 0x83, 
+    0xd1, 0x86, 0xff, 0x9e, 0xff, 0xff, 0x42, 0x08, 0x04, 0x00, 0x00, 0x83, 0xa5, 0x14, 0xff, 0xff, 
+    0xfe, 0x9a, 0xc8, 0x82, 0x3c, 0xc8, 0x00, 0x83, 0xc8, 0x82, 0xfe, 0x9a, 0xff, 0xff, 0xa5, 0x14, 
+    0x05, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xfe, 0x9a, 0xc8, 0x82, 0x3a, 0xc8, 
+    0x00, 0x84, 0xc8, 0x82, 0xfe, 0x9a, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x84, 
+    0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xfe, 0x9a, 0xd1, 0x86, 0x38, 0xc8, 0x00, 0x84, 0xd1, 0x86, 
+    0xfe, 0x9a, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 
+    0xff, 0xff, 0xff, 0x9e, 0xe3, 0x8e, 0x36, 0xc8, 0x00, 0x84, 0xe3, 0x8e, 0xff, 0x9e, 0xff, 0xff, 
+    0xd6, 0x9a, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x81, 
+    0xff, 0x1c, 0xe3, 0x0c, 0x32, 0xc8, 0x00, 0x81, 0xe3, 0x0c, 0xff, 0x1c, 0x01, 0xff, 0xff, 0x81, 
+    0xa5, 0x14, 0x10, 0x82, 0x0d, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x01, 0xff, 0xff, 0x83, 
+    0xff, 0x9e, 0xed, 0x14, 0xe3, 0x0c, 0xda, 0x08, 0x2a, 0xc8, 0x00, 0x83, 0xda, 0x08, 0xe3, 0x0c, 
+    0xed, 0x14, 0xff, 0x9e, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 0x11, 0x00, 0x00, 0x81, 
+    0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 0x0c, 0x15, 0x00, 0x00, 0x83, 
+    0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 0x96, 
+    0x73, 0x8e, 0x21, 0x04, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 
+    0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x15, 
+    0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 0x0c, 0x11, 
+    0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x36, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 0x0d, 
+    0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x3a, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 0x0a, 
+    0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3c, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x08, 
+    0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3e, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x06, 
+    0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x40, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x05, 
+    0x00, 0x00, 0x80, 0xa5, 0x14, 0x42, 0xff, 0xff, 0x80, 0xa5, 0x14, 0x04, 0x00, 0x00, 0x80, 0x42, 
+    0x08, 0x44, 0xff, 0xff, 0x80, 0x42, 0x08, 0x03, 0x00, 0x00, 0x80, 0xe7, 0x1c, 0x44, 0xff, 0xff, 
+    0x80, 0xe7, 0x1c, 0x02, 0x00, 0x00, 0x80, 0x63, 0x0c, 0x46, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x01, 
+    0x00, 0x00, 0x80, 0xd6, 0x9a, 0x46, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x00, 0x00, 0x21, 0x04, 0x48, 
+    0xff, 0xff, 0x81, 0x21, 0x04, 0x73, 0x8e, 0x48, 0xff, 0xff, 0x81, 0x73, 0x8e, 0xb5, 0x96, 0x48, 
+    0xff, 0xff, 0x81, 0xb5, 0x96, 0xc6, 0x18, 0x48, 0xff, 0xff, 0x80, 0xc6, 0x18, 0x7f, 0xff, 0xff, 
+    0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 
+    0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 
+    0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 
+    0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 
+    0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 
+    0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 
+    0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 
+    0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 
+    0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 
+    0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 
+    0xff, 0xff, 0x1a, 0xc8, 0x00, 0x2f, 0xff, 0xff, 0x1a, 0xc8, 0x00, 0x7f, 0xff, 0xff, 0x7f, 0xff, 
+    0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x6f, 0xff, 0xff, 0x80, 0xc6, 0x18, 0x48, 0xff, 0xff, 
+    0x81, 0xc6, 0x18, 0xb5, 0x96, 0x48, 0xff, 0xff, 0x81, 0xb5, 0x96, 0x73, 0x8e, 0x48, 0xff, 0xff, 
+    0x81, 0x73, 0x8e, 0x21, 0x04, 0x48, 0xff, 0xff, 0x82, 0x21, 0x04, 0x00, 0x00, 0xd6, 0x9a, 0x46, 
+    0xff, 0xff, 0x80, 0xd6, 0x9a, 0x01, 0x00, 0x00, 0x80, 0x63, 0x0c, 0x46, 0xff, 0xff, 0x80, 0x63, 
+    0x0c, 0x02, 0x00, 0x00, 0x80, 0xe7, 0x1c, 0x44, 0xff, 0xff, 0x80, 0xe7, 0x1c, 0x03, 0x00, 0x00, 
+    0x80, 0x42, 0x08, 0x44, 0xff, 0xff, 0x80, 0x42, 0x08, 0x04, 0x00, 0x00, 0x80, 0xa5, 0x14, 0x42, 
+    0xff, 0xff, 0x80, 0xa5, 0x14, 0x05, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x40, 0xff, 0xff, 
+    0x81, 0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3e, 0xff, 0xff, 
+    0x81, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3c, 0xff, 0xff, 
+    0x81, 0xd6, 0x9a, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x3a, 0xff, 0xff, 
+    0x81, 0xa5, 0x14, 0x10, 0x82, 0x0d, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x36, 0xff, 0xff, 
+    0x81, 0xe7, 0x1c, 0x42, 0x08, 0x11, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 
+    0x81, 0xd6, 0x9a, 0x63, 0x0c, 0x15, 0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 
+    0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x0b, 0x00, 0x00, 
+    0x0b, 0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 
+    0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x15, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 
+    0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 0x0c, 0x11, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 
+    0x01, 0xff, 0xff, 0x83, 0xf7, 0x9f, 0xa5, 0x1d, 0x63, 0x1c, 0x42, 0x1b, 0x2a, 0x00, 0x19, 0x83, 
+    0x42, 0x1b, 0x63, 0x1c, 0xa5, 0x1d, 0xf7, 0x9f, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 
+    0x0d, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1f, 0x63, 0x1c, 
+    0x32, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xe7, 0x1f, 0x01, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 
+    0x0a, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xf7, 0x9f, 0x73, 0x9c, 0x36, 0x00, 
+    0x19, 0x84, 0x73, 0x9c, 0xf7, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x84, 
+    0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xd6, 0x9f, 0x31, 0x9a, 0x38, 0x00, 0x19, 0x84, 0x31, 0x9a, 
+    0xd6, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 
+    0xff, 0xff, 0xd6, 0x9f, 0x10, 0x99, 0x3a, 0x00, 0x19, 0x84, 0x10, 0x99, 0xd6, 0x9f, 0xff, 0xff, 
+    0xd6, 0x9a, 0x10, 0x82, 0x05, 0x00, 0x00, 0x83, 0xa5, 0x14, 0xff, 0xff, 0xd6, 0x9f, 0x10, 0x99, 
+    0x3c, 0x00, 0x19, 0x83, 0x10, 0x99, 0xd6, 0x9f, 0xff, 0xff, 0xa5, 0x14, 0x04, 0x00, 0x00, 0x83, 
+    0x42, 0x08, 0xff, 0xff, 0xf7, 0x9f, 0x31, 0x9a, 0x3e, 0x00, 0x19, 0x83, 0x31, 0x9a, 0xf7, 0x9f, 
+    0xff, 0xff, 0x42, 0x08, 0x03, 0x00, 0x00, 0x82, 0xe7, 0x1c, 0xff, 0xff, 0x73, 0x9c, 0x40, 0x00, 
+    0x19, 0x82, 0x73, 0x9c, 0xff, 0xff, 0xe7, 0x1c, 0x02, 0x00, 0x00, 0x82, 0x63, 0x0c, 0xff, 0xff, 
+    0xe7, 0x1f, 0x42, 0x00, 0x19, 0x82, 0xe7, 0x1f, 0xff, 0xff, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x82, 
+    0xd6, 0x9a, 0xff, 0xff, 0x63, 0x1c, 0x42, 0x00, 0x19, 0x86, 0x63, 0x1c, 0xff, 0xff, 0xd6, 0x9a, 
+    0x00, 0x00, 0x21, 0x04, 0xff, 0xff, 0xf7, 0x9f, 0x44, 0x00, 0x19, 0x85, 0xf7, 0x9f, 0xff, 0xff, 
+    0x21, 0x04, 0x73, 0x8e, 0xff, 0xff, 0xa5, 0x1d, 0x44, 0x00, 0x19, 0x85, 0xa5, 0x1d, 0xff, 0xff, 
+    0x73, 0x8e, 0xb5, 0x96, 0xff, 0xff, 0x63, 0x1c, 0x44, 0x00, 0x19, 0x85, 0x63, 0x1c, 0xff, 0xff, 
+    0xb5, 0x96, 0xc6, 0x18, 0xff, 0xff, 0x42, 0x1b, 0x44, 0x00, 0x19, 0x82, 0x42, 0x1b, 0xff, 0xff, 
+    0xc6, 0x18, 0x01, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 
+    0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x0f, 0x00, 0x19, 
+    0x81, 0xa5, 0x1d, 0x10, 0x99, 0x0c, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x10, 0x00, 0x19, 0x82, 0xff, 0xff, 0xd6, 0x9f, 0x31, 0x9a, 0x0e, 0x00, 0x19, 0x82, 0xff, 
+    0xff, 0xd6, 0x9f, 0x31, 0x9a, 0x0b, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x10, 0x00, 0x19, 0x01, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0d, 0x00, 0x19, 0x01, 
+    0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0a, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x0b, 0x00, 
+    0x19, 0x03, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x08, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 
+    0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x04, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 
+    0x0a, 0x00, 0x19, 0x04, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x07, 0x00, 0x19, 0x04, 0xff, 
+    0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x05, 0xff, 0xff, 0x81, 0xf7, 0x9f, 
+    0x63, 0x1c, 0x09, 0x00, 0x19, 0x05, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x06, 0x00, 0x19, 
+    0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x07, 0xff, 0xff, 0x81, 
+    0xa5, 0x1d, 0x10, 0x99, 0x07, 0x00, 0x19, 0x07, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x04, 
+    0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x08, 0xff, 
+    0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x06, 0x00, 0x19, 0x08, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 
+    0x9a, 0x03, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 
+    0x09, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x05, 0x00, 0x19, 0x09, 0xff, 0xff, 0x81, 0xf7, 
+    0x9f, 0x63, 0x1c, 0x02, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 
+    0x00, 0x19, 0x0b, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x03, 0x00, 0x19, 0x0b, 0xff, 0xff, 
+    0x82, 0xa5, 0x1d, 0x10, 0x99, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 
+    0x10, 0x00, 0x19, 0x0c, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x02, 0x00, 0x19, 0x0c, 0xff, 
+    0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 
+    0x00, 0x19, 0x0d, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x01, 0x00, 0x19, 0x0d, 0xff, 0xff, 
+    0x80, 0xf7, 0x9f, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x0f, 
+    0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x13, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 
+    0x10, 0x00, 0x19, 0x10, 0xff, 0xff, 0x80, 0xa5, 0x1d, 0x13, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 
+    0xff, 0xff, 0x10, 0x00, 0x19, 0x0f, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x13, 0xff, 0xff, 
+    0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x0d, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 
+    0x1c, 0x01, 0x00, 0x19, 0x0d, 0xff, 0xff, 0x80, 0xf7, 0x9f, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x0c, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x02, 0x00, 
+    0x19, 0x0c, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 
+    0xff, 0xff, 0x10, 0x00, 0x19, 0x0b, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x03, 0x00, 0x19, 
+    0x0b, 0xff, 0xff, 0x82, 0xa5, 0x1d, 0x10, 0x99, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x09, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x05, 0x00, 
+    0x19, 0x09, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x02, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 
+    0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x08, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 
+    0x06, 0x00, 0x19, 0x08, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x03, 0x00, 0x19, 0x04, 0xff, 
+    0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x07, 0xff, 0xff, 0x81, 0xa5, 0x1d, 
+    0x10, 0x99, 0x07, 0x00, 0x19, 0x07, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x04, 0x00, 0x19, 
+    0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x05, 0xff, 0xff, 0x81, 
+    0xf7, 0x9f, 0x63, 0x1c, 0x09, 0x00, 0x19, 0x05, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x06, 
+    0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x04, 0xff, 
+    0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x0a, 0x00, 0x19, 0x04, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 
+    0x9a, 0x07, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x0b, 0x00, 0x19, 0x03, 0xff, 0xff, 0x81, 0xa5, 
+    0x1d, 0x10, 0x99, 0x08, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x10, 
+    0x00, 0x19, 0x01, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0d, 0x00, 0x19, 0x01, 0xff, 0xff, 
+    0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0a, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x10, 0x00, 0x19, 0x82, 0xff, 0xff, 0xd6, 0x9f, 0x31, 0x9a, 0x0e, 0x00, 0x19, 0x82, 0xff, 
+    0xff, 0xd6, 0x9f, 0x31, 0x9a, 0x0b, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x10, 0x00, 0x19, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x0f, 0x00, 0x19, 0x81, 0xa5, 0x1d, 0x10, 
+    0x99, 0x0c, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 
+    0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x01, 0xff, 0xff, 0x82, 0xc6, 0x18, 
+    0xff, 0xff, 0x42, 0x1b, 0x44, 0x00, 0x19, 0x85, 0x42, 0x1b, 0xff, 0xff, 0xc6, 0x18, 0xb5, 0x96, 
+    0xff, 0xff, 0x63, 0x1c, 0x44, 0x00, 0x19, 0x85, 0x63, 0x1c, 0xff, 0xff, 0xb5, 0x96, 0x73, 0x8e, 
+    0xff, 0xff, 0xa5, 0x1d, 0x44, 0x00, 0x19, 0x85, 0xa5, 0x1d, 0xff, 0xff, 0x73, 0x8e, 0x21, 0x04, 
+    0xff, 0xff, 0xf7, 0x9f, 0x44, 0x00, 0x19, 0x86, 0xf7, 0x9f, 0xff, 0xff, 0x21, 0x04, 0x00, 0x00, 
+    0xd6, 0x9a, 0xff, 0xff, 0x63, 0x1c, 0x42, 0x00, 0x19, 0x82, 0x63, 0x1c, 0xff, 0xff, 0xd6, 0x9a, 
+    0x01, 0x00, 0x00, 0x82, 0x63, 0x0c, 0xff, 0xff, 0xe7, 0x1f, 0x42, 0x00, 0x19, 0x82, 0xe7, 0x1f, 
+    0xff, 0xff, 0x63, 0x0c, 0x02, 0x00, 0x00, 0x82, 0xe7, 0x1c, 0xff, 0xff, 0x73, 0x9c, 0x40, 0x00, 
+    0x19, 0x82, 0x73, 0x9c, 0xff, 0xff, 0xe7, 0x1c, 0x03, 0x00, 0x00, 0x83, 0x42, 0x08, 0xff, 0xff, 
+    0xf7, 0x9f, 0x31, 0x9a, 0x3e, 0x00, 0x19, 0x83, 0x31, 0x9a, 0xf7, 0x9f, 0xff, 0xff, 0x42, 0x08, 
+    0x04, 0x00, 0x00, 0x83, 0xa5, 0x14, 0xff, 0xff, 0xd6, 0x9f, 0x10, 0x99, 0x3c, 0x00, 0x19, 0x83, 
+    0x10, 0x99, 0xd6, 0x9f, 0xff, 0xff, 0xa5, 0x14, 0x05, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 
+    0xff, 0xff, 0xd6, 0x9f, 0x10, 0x99, 0x3a, 0x00, 0x19, 0x84, 0x10, 0x99, 0xd6, 0x9f, 0xff, 0xff, 
+    0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xd6, 0x9f, 
+    0x31, 0x9a, 0x38, 0x00, 0x19, 0x84, 0x31, 0x9a, 0xd6, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 
+    0x08, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xf7, 0x9f, 0x73, 0x9c, 0x36, 0x00, 
+    0x19, 0x84, 0x73, 0x9c, 0xf7, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x81, 
+    0x10, 0x82, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1f, 0x63, 0x1c, 0x32, 0x00, 0x19, 0x81, 
+    0x63, 0x1c, 0xe7, 0x1f, 0x01, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 0x0d, 0x00, 0x00, 0x81, 
+    0x42, 0x08, 0xe7, 0x1c, 0x01, 0xff, 0xff, 0x83, 0xf7, 0x9f, 0xa5, 0x1d, 0x63, 0x1c, 0x42, 0x1b, 
+    0x2a, 0x00, 0x19, 0x83, 0x42, 0x1b, 0x63, 0x1c, 0xa5, 0x1d, 0xf7, 0x9f, 0x01, 0xff, 0xff, 0x81, 
+    0xe7, 0x1c, 0x42, 0x08, 0x11, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 
+    0xd6, 0x9a, 0x63, 0x0c, 0x15, 0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 
+    0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x0b, 0x00, 0x00, 0x0b, 
+    0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 
+    0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x15, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 
+    0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 0x0c, 0x11, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x36, 
+    0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 0x0d, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x3a, 
+    0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3c, 
+    0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3e, 
+    0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x40, 
+    0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x05, 0x00, 0x00, 0x80, 0xa5, 0x14, 0x42, 0xff, 0xff, 
+    0x80, 0xa5, 0x14, 0x04, 0x00, 0x00, 0x80, 0x42, 0x08, 0x44, 0xff, 0xff, 0x80, 0x42, 0x08, 0x03, 
+    0x00, 0x00, 0x80, 0xe7, 0x1c, 0x44, 0xff, 0xff, 0x80, 0xe7, 0x1c, 0x02, 0x00, 0x00, 0x80, 0x63, 
+    0x0c, 0x46, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x80, 0xd6, 0x9a, 0x46, 0xff, 0xff, 
+    0x82, 0xd6, 0x9a, 0x00, 0x00, 0x21, 0x04, 0x48, 0xff, 0xff, 0x81, 0x21, 0x04, 0x73, 0x8e, 0x48, 
+    0xff, 0xff, 0x81, 0x73, 0x8e, 0xb5, 0x96, 0x48, 0xff, 0xff, 0x81, 0xb5, 0x96, 0xc6, 0x18, 0x48, 
+    0xff, 0xff, 0x80, 0xc6, 0x18, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 
+    0xff, 0x6a, 0xff, 0xff, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x0f, 0xff, 0xff, 0x81, 0x63, 0x1c, 0xf7, 
+    0x9f, 0x0c, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x82, 0x00, 0x19, 0x31, 0x9a, 0xd6, 
+    0x9f, 0x0e, 0xff, 0xff, 0x82, 0x00, 0x19, 0x31, 0x9a, 0xd6, 0x9f, 0x0b, 0xff, 0xff, 0x04, 0x00, 
+    0x19, 0x24, 0xff, 0xff, 0x01, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x0d, 0xff, 0xff, 0x01, 
+    0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x0a, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 
+    0x03, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x0b, 0xff, 0xff, 0x03, 0x00, 0x19, 0x81, 0x63, 
+    0x1c, 0xf7, 0x9f, 0x08, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x81, 
+    0x31, 0x9a, 0xd6, 0x9f, 0x0a, 0xff, 0xff, 0x04, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x07, 
+    0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x05, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 
+    0x09, 0xff, 0xff, 0x05, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x06, 0xff, 0xff, 0x04, 0x00, 
+    0x19, 0x24, 0xff, 0xff, 0x07, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x07, 0xff, 0xff, 0x07, 
+    0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x04, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 
+    0x08, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x06, 0xff, 0xff, 0x08, 0x00, 0x19, 0x81, 0x31, 
+    0x9a, 0xd6, 0x9f, 0x03, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x09, 0x00, 0x19, 0x81, 
+    0x10, 0x99, 0xa5, 0x1d, 0x05, 0xff, 0xff, 0x09, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x02, 
+    0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x0b, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 
+    0x03, 0xff, 0xff, 0x0b, 0x00, 0x19, 0x82, 0x63, 0x1c, 0xf7, 0x9f, 0xff, 0xff, 0x04, 0x00, 0x19, 
+    0x24, 0xff, 0xff, 0x0c, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x02, 0xff, 0xff, 0x0c, 0x00, 
+    0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x0d, 0x00, 0x19, 0x81, 
+    0x10, 0x99, 0xa5, 0x1d, 0x01, 0xff, 0xff, 0x0d, 0x00, 0x19, 0x80, 0x10, 0x99, 0x04, 0x00, 0x19, 
+    0x24, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x13, 0x00, 0x19, 0x24, 0xff, 
+    0xff, 0x10, 0x00, 0x19, 0x80, 0x63, 0x1c, 0x13, 0x00, 0x19, 0x24, 0xff, 0xff, 0x0f, 0x00, 0x19, 
+    0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x13, 0x00, 0x19, 0x24, 0xff, 0xff, 0x0d, 0x00, 0x19, 0x81, 0x10, 
+    0x99, 0xa5, 0x1d, 0x01, 0xff, 0xff, 0x0d, 0x00, 0x19, 0x80, 0x10, 0x99, 0x04, 0x00, 0x19, 0x24, 
+    0xff, 0xff, 0x0c, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x02, 0xff, 0xff, 0x0c, 0x00, 0x19, 
+    0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x0b, 0x00, 0x19, 0x81, 0x63, 
+    0x1c, 0xf7, 0x9f, 0x03, 0xff, 0xff, 0x0b, 0x00, 0x19, 0x82, 0x63, 0x1c, 0xf7, 0x9f, 0xff, 0xff, 
+    0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x09, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x05, 0xff, 
+    0xff, 0x09, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x02, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 
+    0xff, 0xff, 0x08, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x06, 0xff, 0xff, 0x08, 0x00, 0x19, 
+    0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x03, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x07, 0x00, 
+    0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x07, 0xff, 0xff, 0x07, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 
+    0x9f, 0x04, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x05, 0x00, 0x19, 0x81, 0x10, 0x99, 
+    0xa5, 0x1d, 0x09, 0xff, 0xff, 0x05, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x06, 0xff, 0xff, 
+    0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x0a, 0xff, 
+    0xff, 0x04, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x07, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 
+    0xff, 0xff, 0x03, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x0b, 0xff, 0xff, 0x03, 0x00, 0x19, 
+    0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x08, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x01, 0x00, 
+    0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x0d, 0xff, 0xff, 0x01, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 
+    0x1d, 0x0a, 0xff, 0xff, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x82, 0x00, 0x19, 0x31, 0x9a, 0xd6, 
+    0x9f, 0x0e, 0xff, 0xff, 0x82, 0x00, 0x19, 0x31, 0x9a, 0xd6, 0x9f, 0x0b, 0xff, 0xff, 0x04, 0x00, 
+    0x19, 0x24, 0xff, 0xff, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x0f, 0xff, 0xff, 0x81, 0x63, 0x1c, 0xf7, 
+    0x9f, 0x0c, 0xff, 0xff, 0x04, 0x00, 0x19, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 
+    0x7f, 0xff, 0xff, 0x69, 0xff, 0xff, 0x80, 0xc6, 0x18, 0x48, 0xff, 0xff, 0x81, 0xc6, 0x18, 0xb5, 
+    0x96, 0x48, 0xff, 0xff, 0x81, 0xb5, 0x96, 0x73, 0x8e, 0x48, 0xff, 0xff, 0x81, 0x73, 0x8e, 0x21, 
+    0x04, 0x48, 0xff, 0xff, 0x82, 0x21, 0x04, 0x00, 0x00, 0xd6, 0x9a, 0x46, 0xff, 0xff, 0x80, 0xd6, 
+    0x9a, 0x01, 0x00, 0x00, 0x80, 0x63, 0x0c, 0x46, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x02, 0x00, 0x00, 
+    0x80, 0xe7, 0x1c, 0x44, 0xff, 0xff, 0x80, 0xe7, 0x1c, 0x03, 0x00, 0x00, 0x80, 0x42, 0x08, 0x44, 
+    0xff, 0xff, 0x80, 0x42, 0x08, 0x04, 0x00, 0x00, 0x80, 0xa5, 0x14, 0x42, 0xff, 0xff, 0x80, 0xa5, 
+    0x14, 0x05, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x40, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 
+    0x82, 0x06, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3e, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 
+    0x82, 0x08, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3c, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 
+    0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x3a, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 
+    0x82, 0x0d, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x36, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 
+    0x08, 0x11, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 
+    0x0c, 0x15, 0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 
+    0x83, 0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x83, 
+    0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 0x96, 
+    0x73, 0x8e, 0x21, 0x04, 0x15, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 
+    0xd6, 0x9a, 0x63, 0x0c, 0x11, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x01, 0xff, 0xff, 0x83, 
+    0xf7, 0x9f, 0xa5, 0x1d, 0x63, 0x1c, 0x42, 0x1b, 0x2a, 0x00, 0x19, 0x83, 0x42, 0x1b, 0x63, 0x1c, 
+    0xa5, 0x1d, 0xf7, 0x9f, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 0x0d, 0x00, 0x00, 0x81, 
+    0x10, 0x82, 0xa5, 0x14, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1f, 0x63, 0x1c, 0x32, 0x00, 0x19, 0x81, 
+    0x63, 0x1c, 0xe7, 0x1f, 0x01, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x84, 
+    0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xf7, 0x9f, 0x73, 0x9c, 0x36, 0x00, 0x19, 0x84, 0x73, 0x9c, 
+    0xf7, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 
+    0xff, 0xff, 0xd6, 0x9f, 0x31, 0x9a, 0x38, 0x00, 0x19, 0x84, 0x31, 0x9a, 0xd6, 0x9f, 0xff, 0xff, 
+    0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xd6, 0x9f, 
+    0x10, 0x99, 0x3a, 0x00, 0x19, 0x84, 0x10, 0x99, 0xd6, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 
+    0x05, 0x00, 0x00, 0x83, 0xa5, 0x14, 0xff, 0xff, 0xd6, 0x9f, 0x10, 0x99, 0x3c, 0x00, 0x19, 0x83, 
+    0x10, 0x99, 0xd6, 0x9f, 0xff, 0xff, 0xa5, 0x14, 0x04, 0x00, 0x00, 0x83, 0x42, 0x08, 0xff, 0xff, 
+    0xf7, 0x9f, 0x31, 0x9a, 0x3e, 0x00, 0x19, 0x83, 0x31, 0x9a, 0xf7, 0x9f, 0xff, 0xff, 0x42, 0x08, 
+    0x03, 0x00, 0x00, 0x82, 0xe7, 0x1c, 0xff, 0xff, 0x73, 0x9c, 0x40, 0x00, 0x19, 0x82, 0x73, 0x9c, 
+    0xff, 0xff, 0xe7, 0x1c, 0x02, 0x00, 0x00, 0x82, 0x63, 0x0c, 0xff, 0xff, 0xe7, 0x1f, 0x42, 0x00, 
+    0x19, 0x82, 0xe7, 0x1f, 0xff, 0xff, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x82, 0xd6, 0x9a, 0xff, 0xff, 
+    0x63, 0x1c, 0x42, 0x00, 0x19, 0x86, 0x63, 0x1c, 0xff, 0xff, 0xd6, 0x9a, 0x00, 0x00, 0x21, 0x04, 
+    0xff, 0xff, 0xf7, 0x9f, 0x44, 0x00, 0x19, 0x85, 0xf7, 0x9f, 0xff, 0xff, 0x21, 0x04, 0x73, 0x8e, 
+    0xff, 0xff, 0xa5, 0x1d, 0x44, 0x00, 0x19, 0x85, 0xa5, 0x1d, 0xff, 0xff, 0x73, 0x8e, 0xb5, 0x96, 
+    0xff, 0xff, 0x63, 0x1c, 0x44, 0x00, 0x19, 0x85, 0x63, 0x1c, 0xff, 0xff, 0xb5, 0x96, 0xc6, 0x18, 
+    0xff, 0xff, 0x42, 0x1b, 0x44, 0x00, 0x19, 0x82, 0x42, 0x1b, 0xff, 0xff, 0xc6, 0x18, 0x01, 0xff, 
+    0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 
+    0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x0c, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x0f, 
+    0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 
+    0x04, 0xff, 0xff, 0x0b, 0x00, 0x19, 0x82, 0x31, 0x9a, 0xd6, 0x9f, 0xff, 0xff, 0x0e, 0x00, 0x19, 
+    0x82, 0x31, 0x9a, 0xd6, 0x9f, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 
+    0x04, 0xff, 0xff, 0x0a, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x01, 0xff, 0xff, 0x0d, 0x00, 
+    0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x01, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 
+    0x00, 0x19, 0x04, 0xff, 0xff, 0x08, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x03, 0xff, 0xff, 
+    0x0b, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x07, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x04, 
+    0xff, 0xff, 0x0a, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x04, 0xff, 0xff, 0x10, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x06, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 
+    0x9f, 0x05, 0xff, 0xff, 0x09, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x05, 0xff, 0xff, 0x10, 
+    0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x04, 0x00, 0x19, 0x81, 0x10, 
+    0x99, 0xa5, 0x1d, 0x07, 0xff, 0xff, 0x07, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x07, 0xff, 
+    0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x03, 0x00, 0x19, 
+    0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x08, 0xff, 0xff, 0x06, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 
+    0x08, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x02, 
+    0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x09, 0xff, 0xff, 0x05, 0x00, 0x19, 0x81, 0x63, 0x1c, 
+    0xf7, 0x9f, 0x09, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 
+    0xff, 0x82, 0x00, 0x19, 0x10, 0x99, 0xa5, 0x1d, 0x0b, 0xff, 0xff, 0x03, 0x00, 0x19, 0x81, 0x10, 
+    0x99, 0xa5, 0x1d, 0x0b, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 
+    0xff, 0xff, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x0c, 0xff, 0xff, 0x02, 0x00, 0x19, 0x81, 0x31, 0x9a, 
+    0xd6, 0x9f, 0x0c, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 
+    0xff, 0x80, 0xf7, 0x9f, 0x0d, 0xff, 0xff, 0x01, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x0d, 
+    0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x13, 0xff, 0xff, 0x81, 0x10, 
+    0x99, 0xa5, 0x1d, 0x0f, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x13, 
+    0xff, 0xff, 0x80, 0xa5, 0x1d, 0x10, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 
+    0x19, 0x13, 0xff, 0xff, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x0f, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 
+    0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x80, 0xf7, 0x9f, 0x0d, 0xff, 0xff, 0x01, 0x00, 
+    0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x0d, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 
+    0x00, 0x19, 0x04, 0xff, 0xff, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x0c, 0xff, 0xff, 0x02, 0x00, 0x19, 
+    0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x0c, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 
+    0x19, 0x04, 0xff, 0xff, 0x82, 0x00, 0x19, 0x10, 0x99, 0xa5, 0x1d, 0x0b, 0xff, 0xff, 0x03, 0x00, 
+    0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x0b, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 
+    0x00, 0x19, 0x04, 0xff, 0xff, 0x02, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x09, 0xff, 0xff, 
+    0x05, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x09, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x03, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x08, 
+    0xff, 0xff, 0x06, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x08, 0xff, 0xff, 0x10, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x04, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 
+    0x1d, 0x07, 0xff, 0xff, 0x07, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x07, 0xff, 0xff, 0x10, 
+    0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x06, 0x00, 0x19, 0x81, 0x63, 
+    0x1c, 0xf7, 0x9f, 0x05, 0xff, 0xff, 0x09, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x05, 0xff, 
+    0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x07, 0x00, 0x19, 
+    0x81, 0x31, 0x9a, 0xd6, 0x9f, 0x04, 0xff, 0xff, 0x0a, 0x00, 0x19, 0x81, 0x31, 0x9a, 0xd6, 0x9f, 
+    0x04, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 0xff, 0x08, 
+    0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x03, 0xff, 0xff, 0x0b, 0x00, 0x19, 0x81, 0x10, 0x99, 
+    0xa5, 0x1d, 0x03, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 0x04, 0xff, 
+    0xff, 0x0a, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xf7, 0x9f, 0x01, 0xff, 0xff, 0x0d, 0x00, 0x19, 0x81, 
+    0x63, 0x1c, 0xf7, 0x9f, 0x01, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 
+    0x04, 0xff, 0xff, 0x0b, 0x00, 0x19, 0x82, 0x31, 0x9a, 0xd6, 0x9f, 0xff, 0xff, 0x0e, 0x00, 0x19, 
+    0x82, 0x31, 0x9a, 0xd6, 0x9f, 0xff, 0xff, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x0f, 0x00, 0x19, 
+    0x04, 0xff, 0xff, 0x0c, 0x00, 0x19, 0x81, 0x10, 0x99, 0xa5, 0x1d, 0x0f, 0x00, 0x19, 0x81, 0x10, 
+    0x99, 0xa5, 0x1d, 0x10, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 
+    0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 
+    0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 
+    0x03, 0xff, 0xff, 0x46, 0x00, 0x19, 0x01, 0xff, 0xff, 0x82, 0xc6, 0x18, 0xff, 0xff, 0x42, 0x1b, 
+    0x44, 0x00, 0x19, 0x85, 0x42, 0x1b, 0xff, 0xff, 0xc6, 0x18, 0xb5, 0x96, 0xff, 0xff, 0x63, 0x1c, 
+    0x44, 0x00, 0x19, 0x85, 0x63, 0x1c, 0xff, 0xff, 0xb5, 0x96, 0x73, 0x8e, 0xff, 0xff, 0xa5, 0x1d, 
+    0x44, 0x00, 0x19, 0x85, 0xa5, 0x1d, 0xff, 0xff, 0x73, 0x8e, 0x21, 0x04, 0xff, 0xff, 0xf7, 0x9f, 
+    0x44, 0x00, 0x19, 0x86, 0xf7, 0x9f, 0xff, 0xff, 0x21, 0x04, 0x00, 0x00, 0xd6, 0x9a, 0xff, 0xff, 
+    0x63, 0x1c, 0x42, 0x00, 0x19, 0x82, 0x63, 0x1c, 0xff, 0xff, 0xd6, 0x9a, 0x01, 0x00, 0x00, 0x82, 
+    0x63, 0x0c, 0xff, 0xff, 0xe7, 0x1f, 0x42, 0x00, 0x19, 0x82, 0xe7, 0x1f, 0xff, 0xff, 0x63, 0x0c, 
+    0x02, 0x00, 0x00, 0x82, 0xe7, 0x1c, 0xff, 0xff, 0x73, 0x9c, 0x40, 0x00, 0x19, 0x82, 0x73, 0x9c, 
+    0xff, 0xff, 0xe7, 0x1c, 0x03, 0x00, 0x00, 0x83, 0x42, 0x08, 0xff, 0xff, 0xf7, 0x9f, 0x31, 0x9a, 
+    0x3e, 0x00, 0x19, 0x83, 0x31, 0x9a, 0xf7, 0x9f, 0xff, 0xff, 0x42, 0x08, 0x04, 0x00, 0x00, 0x83, 
+    0xa5, 0x14, 0xff, 0xff, 0xd6, 0x9f, 0x10, 0x99, 0x3c, 0x00, 0x19, 0x83, 0x10, 0x99, 0xd6, 0x9f, 
+    0xff, 0xff, 0xa5, 0x14, 0x05, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xd6, 0x9f, 
+    0x10, 0x99, 0x3a, 0x00, 0x19, 0x84, 0x10, 0x99, 0xd6, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 
+    0x06, 0x00, 0x00, 0x84, 0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xd6, 0x9f, 0x31, 0x9a, 0x38, 0x00, 
+    0x19, 0x84, 0x31, 0x9a, 0xd6, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x84, 
+    0x10, 0x82, 0xd6, 0x9a, 0xff, 0xff, 0xf7, 0x9f, 0x73, 0x9c, 0x36, 0x00, 0x19, 0x84, 0x73, 0x9c, 
+    0xf7, 0x9f, 0xff, 0xff, 0xd6, 0x9a, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 
+    0x01, 0xff, 0xff, 0x81, 0xe7, 0x1f, 0x63, 0x1c, 0x32, 0x00, 0x19, 0x81, 0x63, 0x1c, 0xe7, 0x1f, 
+    0x01, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 0x0d, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 
+    0x01, 0xff, 0xff, 0x83, 0xf7, 0x9f, 0xa5, 0x1d, 0x63, 0x1c, 0x42, 0x1b, 0x2a, 0x00, 0x19, 0x83, 
+    0x42, 0x1b, 0x63, 0x1c, 0xa5, 0x1d, 0xf7, 0x9f, 0x01, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 
+    0x11, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 0x0c, 
+    0x15, 0x00, 0x00, 0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 
+    0xc6, 0x18, 0xb5, 0x96, 0x73, 0x8e, 0x21, 0x04, 0x0b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x83, 0x21, 
+    0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 0x96, 0x73, 
+    0x8e, 0x21, 0x04, 0x15, 0x00, 0x00, 0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 
+    0x9a, 0x63, 0x0c, 0x11, 0x00, 0x00, 0x81, 0x42, 0x08, 0xe7, 0x1c, 0x36, 0xff, 0xff, 0x81, 0xe7, 
+    0x1c, 0x42, 0x08, 0x0d, 0x00, 0x00, 0x81, 0x10, 0x82, 0xa5, 0x14, 0x3a, 0xff, 0xff, 0x81, 0xa5, 
+    0x14, 0x10, 0x82, 0x0a, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3c, 0xff, 0xff, 0x81, 0xd6, 
+    0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3e, 0xff, 0xff, 0x81, 0xd6, 
+    0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 0x81, 0x10, 0x82, 0xd6, 0x9a, 0x40, 0xff, 0xff, 0x81, 0xd6, 
+    0x9a, 0x10, 0x82, 0x05, 0x00, 0x00, 0x80, 0xa5, 0x14, 0x42, 0xff, 0xff, 0x80, 0xa5, 0x14, 0x04, 
+    0x00, 0x00, 0x80, 0x42, 0x08, 0x44, 0xff, 0xff, 0x80, 0x42, 0x08, 0x03, 0x00, 0x00, 0x80, 0xe7, 
+    0x1c, 0x44, 0xff, 0xff, 0x80, 0xe7, 0x1c, 0x02, 0x00, 0x00, 0x80, 0x63, 0x0c, 0x46, 0xff, 0xff, 
+    0x80, 0x63, 0x0c, 0x01, 0x00, 0x00, 0x80, 0xd6, 0x9a, 0x46, 0xff, 0xff, 0x82, 0xd6, 0x9a, 0x00, 
+    0x00, 0x21, 0x04, 0x48, 0xff, 0xff, 0x81, 0x21, 0x04, 0x73, 0x8e, 0x48, 0xff, 0xff, 0x81, 0x73, 
+    0x8e, 0xb5, 0x96, 0x48, 0xff, 0xff, 0x81, 0xb5, 0x96, 0xc6, 0x18, 0x48, 0xff, 0xff, 0x80, 0xc6, 
+    0x18, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x69, 0xff, 0xff, 
+    0x04, 0x00, 0x19, 0x0c, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0f, 0xff, 0xff, 0x81, 0xf7, 
+    0x9f, 0x63, 0x1c, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x0b, 0xff, 0xff, 0x82, 0xd6, 0x9f, 0x31, 
+    0x9a, 0x00, 0x19, 0x0e, 0xff, 0xff, 0x82, 0xd6, 0x9f, 0x31, 0x9a, 0x00, 0x19, 0x24, 0xff, 0xff, 
+    0x04, 0x00, 0x19, 0x0a, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x01, 0x00, 0x19, 0x0d, 0xff, 
+    0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x01, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x08, 
+    0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x03, 0x00, 0x19, 0x0b, 0xff, 0xff, 0x81, 0xf7, 0x9f, 
+    0x63, 0x1c, 0x03, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x07, 0xff, 0xff, 0x81, 0xd6, 
+    0x9f, 0x31, 0x9a, 0x04, 0x00, 0x19, 0x0a, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x04, 0x00, 
+    0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x06, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x05, 
+    0x00, 0x19, 0x09, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x05, 0x00, 0x19, 0x24, 0xff, 0xff, 
+    0x04, 0x00, 0x19, 0x04, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x07, 0x00, 0x19, 0x07, 0xff, 
+    0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x07, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x03, 
+    0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x08, 0x00, 0x19, 0x06, 0xff, 0xff, 0x81, 0xd6, 0x9f, 
+    0x31, 0x9a, 0x08, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x02, 0xff, 0xff, 0x81, 0xa5, 
+    0x1d, 0x10, 0x99, 0x09, 0x00, 0x19, 0x05, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x09, 0x00, 
+    0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x82, 0xff, 0xff, 0xf7, 0x9f, 0x63, 0x1c, 0x0b, 0x00, 
+    0x19, 0x03, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0b, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 
+    0x00, 0x19, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x0c, 0x00, 0x19, 0x02, 0xff, 0xff, 0x81, 0xd6, 0x9f, 
+    0x31, 0x9a, 0x0c, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x80, 0x10, 0x99, 0x0d, 0x00, 
+    0x19, 0x01, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x0d, 0x00, 0x19, 0x24, 0xff, 0xff, 0x13, 
+    0x00, 0x19, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0f, 0x00, 0x19, 0x24, 0xff, 0xff, 0x13, 0x00, 0x19, 
+    0x80, 0x63, 0x1c, 0x10, 0x00, 0x19, 0x24, 0xff, 0xff, 0x13, 0x00, 0x19, 0x81, 0xf7, 0x9f, 0x63, 
+    0x1c, 0x0f, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x80, 0x10, 0x99, 0x0d, 0x00, 0x19, 
+    0x01, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x0d, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 
+    0x19, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x0c, 0x00, 0x19, 0x02, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 
+    0x9a, 0x0c, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x82, 0xff, 0xff, 0xf7, 0x9f, 0x63, 
+    0x1c, 0x0b, 0x00, 0x19, 0x03, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0b, 0x00, 0x19, 0x24, 
+    0xff, 0xff, 0x04, 0x00, 0x19, 0x02, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x09, 0x00, 0x19, 
+    0x05, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x09, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 
+    0x19, 0x03, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x08, 0x00, 0x19, 0x06, 0xff, 0xff, 0x81, 
+    0xd6, 0x9f, 0x31, 0x9a, 0x08, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x04, 0xff, 0xff, 
+    0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x07, 0x00, 0x19, 0x07, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 
+    0x07, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x06, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 
+    0x99, 0x05, 0x00, 0x19, 0x09, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 0x05, 0x00, 0x19, 0x24, 
+    0xff, 0xff, 0x04, 0x00, 0x19, 0x07, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x04, 0x00, 0x19, 
+    0x0a, 0xff, 0xff, 0x81, 0xd6, 0x9f, 0x31, 0x9a, 0x04, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 
+    0x19, 0x08, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x03, 0x00, 0x19, 0x0b, 0xff, 0xff, 0x81, 
+    0xf7, 0x9f, 0x63, 0x1c, 0x03, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x0a, 0xff, 0xff, 
+    0x81, 0xa5, 0x1d, 0x10, 0x99, 0x01, 0x00, 0x19, 0x0d, 0xff, 0xff, 0x81, 0xa5, 0x1d, 0x10, 0x99, 
+    0x01, 0x00, 0x19, 0x24, 0xff, 0xff, 0x04, 0x00, 0x19, 0x0b, 0xff, 0xff, 0x82, 0xd6, 0x9f, 0x31, 
+    0x9a, 0x00, 0x19, 0x0e, 0xff, 0xff, 0x82, 0xd6, 0x9f, 0x31, 0x9a, 0x00, 0x19, 0x24, 0xff, 0xff, 
+    0x04, 0x00, 0x19, 0x0c, 0xff, 0xff, 0x81, 0xf7, 0x9f, 0x63, 0x1c, 0x0f, 0xff, 0xff, 0x81, 0xf7, 
+    0x9f, 0x63, 0x1c, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x6a, 
+    0xff, 0xff, 0x80, 0xc6, 0x18, 0x48, 0xff, 0xff, 0x81, 0xc6, 0x18, 0xb5, 0x96, 0x48, 0xff, 0xff, 
+    0x81, 0xb5, 0x96, 0x73, 0x8e, 0x48, 0xff, 0xff, 0x81, 0x73, 0x8e, 0x21, 0x04, 0x48, 0xff, 0xff, 
+    0x82, 0x21, 0x04, 0x00, 0x00, 0xd6, 0x9a, 0x46, 0xff, 0xff, 0x80, 0xd6, 0x9a, 0x01, 0x00, 0x00, 
+    0x80, 0x63, 0x0c, 0x46, 0xff, 0xff, 0x80, 0x63, 0x0c, 0x02, 0x00, 0x00, 0x80, 0xe7, 0x1c, 0x44, 
+    0xff, 0xff, 0x80, 0xe7, 0x1c, 0x03, 0x00, 0x00, 0x80, 0x42, 0x08, 0x44, 0xff, 0xff, 0x80, 0x42, 
+    0x08, 0x04, 0x00, 0x00, 0x80, 0xa5, 0x14, 0x42, 0xff, 0xff, 0x80, 0xa5, 0x14, 0x05, 0x00, 0x00, 
+    0x81, 0x10, 0x82, 0xd6, 0x9a, 0x40, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x06, 0x00, 0x00, 
+    0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3e, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x08, 0x00, 0x00, 
+    0x81, 0x10, 0x82, 0xd6, 0x9a, 0x3c, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x10, 0x82, 0x0a, 0x00, 0x00, 
+    0x81, 0x10, 0x82, 0xa5, 0x14, 0x3a, 0xff, 0xff, 0x81, 0xa5, 0x14, 0x10, 0x82, 0x0d, 0x00, 0x00, 
+    0x81, 0x42, 0x08, 0xe7, 0x1c, 0x36, 0xff, 0xff, 0x81, 0xe7, 0x1c, 0x42, 0x08, 0x11, 0x00, 0x00, 
+    0x81, 0x63, 0x0c, 0xd6, 0x9a, 0x32, 0xff, 0xff, 0x81, 0xd6, 0x9a, 0x63, 0x0c, 0x15, 0x00, 0x00, 
+    0x83, 0x21, 0x04, 0x73, 0x8e, 0xb5, 0x96, 0xc6, 0x18, 0x2a, 0xff, 0xff, 0x83, 0xc6, 0x18, 0xb5, 
+    0x96, 0x73, 0x8e, 0x21, 0x04, 0x0b, 0x00, 0x00
+};
+
+const RunSprite playerIconsPlay = { playerIconsRuns + 0, 75, 75 };
+const RunSprite playerIconsPlayPressed = { playerIconsRuns + 1354, 75, 75 };
+const RunSprite playerIconsStop = { playerIconsRuns + 2156, 75, 75 };
+const RunSprite playerIconsStopPressed = { playerIconsRuns + 3319, 75, 75 };
+const RunSprite playerIconsNext = { playerIconsRuns + 3936, 75, 75 };
+const RunSprite playerIconsNextPressed = { playerIconsRuns + 5615, 75, 75 };
+const RunSprite playerIconsPrev = { playerIconsRuns + 6748, 75, 75 };
+const RunSprite playerIconsPrevPressed = { playerIconsRuns + 8427, 75, 75 };
@@ -0,0 +1,22 @@
+/*
+    playerIcons.h
+    Run length RGB565 sprite atlas generated by Tools/spriteGen.cpp.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __PLAYERICONS_H__
+#define __PLAYERICONS_H__
+
+#include "runsprite.h"
+
+extern const RunSprite playerIconsPlay;
+extern const RunSprite playerIconsPlayPressed;
+extern const RunSprite playerIconsStop;
+extern const RunSprite playerIconsStopPressed;
+extern const RunSprite playerIconsNext;
+extern const RunSprite playerIconsNextPressed;
+extern const RunSprite playerIconsPrev;
+extern const RunSprite playerIconsPrevPressed;
+
+#endif
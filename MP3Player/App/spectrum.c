@@ -0,0 +1,216 @@
+/*
+    spectrum.c
+    Band levels from the VS1053 spectrum analyzer plugin, see spectrum.h.
+
+    The plugin is VLSI's spectrum analyzer for the VS1053b, which is not
+    part of this tree. App/spectrumPlugin.plg is an empty stand-in, with
+    which the player builds and runs with no levels; replace it with the
+    .plg file from VLSI's VS1053b patches and plugins page. A .plg file
+    declares the compressed plugin image as const unsigned short plugin[].
+
+    Reading the levels takes one SCI write and one SCI read per band, with
+    the SPI bus shared with the LCD and the SD card. So that they never
+    hold up the audio, Mp3Task only reads them just after DREQ has woken
+    it from a full FIFO: the decoder then has nearly 2 KB of MP3 data in
+    hand, over 50 ms at 320 kbit/s, against well under a millisecond for
+    a read. SpectrumGetStats() shows what the reads cost.
+
+    Not yet shown on the board: with the stand-in no read is ever made, so
+    the bars and the bound above are checked only by Tools/spectrumTest.cpp
+    against a model of the SCI registers. With the real plugin in place
+    and APP_CFG_SPECTRUM_EN set, DisplayTask's report gives the loads,
+    reads, deferred reads and longest read (maxUs) to check it against.
+
+    The VU level is the RMS of the band levels. Like a meter's needle it
+    rises at once and falls back at most SPECTRUM_VU_FALL a read.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "spectrum.h"
+
+#if APP_CFG_SPECTRUM_EN > 0u
+
+#include "spectrumPlugin.plg"
+
+// SCI instructions and registers
+#define SCI_WRITE       0x02
+#define SCI_READ        0x03
+#define SCI_WRAM        0x06
+#define SCI_WRAMADDR    0x07
+
+// Analyzer data in the decoder's memory, as documented with the plugin
+#define SA_BANDS_ADDR   0x1802  // number of bands
+#define SA_VALUES_ADDR  0x1804  // a word per band: bits 5:0 level, 11:6 peak
+#define SA_LEVEL_MASK   0x3F
+#define SA_PEAK_SHIFT   6
+
+// Compressed plugin image: address, count, then count values, or with
+// bit 15 of count set, one value to write (count & 0x7FFF) times
+#define PLUGIN_RUN      0x8000
+
+static SpectrumLevels latest;   // guarded by a critical section
+static INT32U sequence;         // sets of levels published
+static SpectrumStats stats;
+static INT32U lastRead;         // OSTimeGet() of the last read
+static BOOLEAN loaded;          // the plugin image was not empty
+static INT8U vuLevel;           // last VU level published
+
+static void SciWrite(HANDLE hMp3, INT8U reg, INT16U value)
+{
+    INT8U cmd[4] = { SCI_WRITE, reg, (INT8U)(value >> 8), (INT8U)value };
+    INT32U length = sizeof(cmd);
+    Write(hMp3, cmd, &length);
+    stats.sciOps++;
+}
+
+static INT16U SciRead(HANDLE hMp3, INT8U reg)
+{
+    INT8U cmd[4] = { SCI_READ, reg, 0, 0 };
+    INT32U length = sizeof(cmd);
+    Read(hMp3, cmd, &length);
+    stats.sciOps++;
+    return (cmd[2] << 8) | cmd[3];
+}
+
+// Square root rounded down, a bit of the result at a time
+static INT16U SquareRoot(INT32U x)
+{
+    INT32U root = 0;
+    INT32U bit = 1UL << 30;
+
+    while (bit > x) bit >>= 2;
+    for ( ; bit != 0; bit >>= 2)
+    {
+        if (x >= root + bit)
+        {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+    }
+    return (INT16U)root;
+}
+
+// SpectrumLoad
+// Loads the plugin into the decoder. A reset removes it, so call after
+// each soft reset, with the driver in command mode. With the empty
+// stand-in image nothing is loaded and no reads ever fall due.
+// hMp3: an open handle to the MP3 decoder
+void SpectrumLoad(HANDLE hMp3)
+{
+    const INT32U size = sizeof(plugin) / sizeof(plugin[0]);
+    INT32U i = 0;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    while (i + 2 <= size)
+    {
+        INT8U reg = (INT8U)plugin[i++];
+        INT16U n = plugin[i++];
+        if (n & PLUGIN_RUN)
+        {
+            INT16U value = plugin[i++];
+            for (n &= ~PLUGIN_RUN; n > 0; n--) SciWrite(hMp3, reg, value);
+        }
+        else
+        {
+            for ( ; n > 0 && i < size; n--) SciWrite(hMp3, reg, plugin[i++]);
+        }
+    }
+    loaded = (i > 0);
+    if (loaded) stats.loads++;
+    vuLevel = 0;
+    lastRead = OSTimeGet();
+}
+
+// SpectrumIsDue
+// Returns: OS_TRUE if the plugin is loaded and SPECTRUM_PERIOD_TICKS have
+// passed since the last read
+BOOLEAN SpectrumIsDue(void)
+{
+    return loaded && (OSTimeGet() - lastRead) >= SPECTRUM_PERIOD_TICKS;
+}
+
+// SpectrumDefer
+// Counts a read that was due but put off because the decoder was not
+// known to have a full FIFO.
+void SpectrumDefer(void)
+{
+    stats.deferred++;
+}
+
+// SpectrumRead
+// Reads the band levels and publishes them for SpectrumGet(). Call with
+// the driver in data mode, only when the decoder's FIFO has just been
+// found full; the driver is left in data mode.
+// hMp3: an open handle to the MP3 decoder
+void SpectrumRead(HANDLE hMp3)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    SpectrumLevels levels;
+    INT32U power = 0;
+    INT32U start = DWT->CYCCNT;
+
+    Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_COMMAND, 0, 0);
+    SciWrite(hMp3, SCI_WRAMADDR, SA_BANDS_ADDR);
+    levels.count = (INT8U)SciRead(hMp3, SCI_WRAM);
+    if (levels.count > SPECTRUM_MAX_BANDS) levels.count = SPECTRUM_MAX_BANDS;
+
+    SciWrite(hMp3, SCI_WRAMADDR, SA_VALUES_ADDR);
+    for (INT8U i = 0; i < levels.count; i++)
+    {
+        INT16U value = SciRead(hMp3, SCI_WRAM);
+        levels.level[i] = value & SA_LEVEL_MASK;
+        levels.peak[i] = (value >> SA_PEAK_SHIFT) & SA_LEVEL_MASK;
+        power += (INT32U)levels.level[i] * levels.level[i];
+    }
+    Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_DATA, 0, 0);
+
+    INT8U rms = levels.count > 0 ? (INT8U)SquareRoot(power / levels.count) : 0;
+    if (rms >= vuLevel) vuLevel = rms;
+    else vuLevel = (vuLevel - rms > SPECTRUM_VU_FALL) ? vuLevel - SPECTRUM_VU_FALL : rms;
+    levels.vu = vuLevel;
+
+    INT32U us = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000);
+    stats.reads++;
+    stats.totalUs += us;
+    if (us > stats.maxUs) stats.maxUs = us;
+    lastRead = OSTimeGet();
+
+    OS_ENTER_CRITICAL();
+    latest = levels;
+    sequence++;
+    OS_EXIT_CRITICAL();
+}
+
+// SpectrumGet
+// Copies the latest band levels.
+// levels: receives the levels
+// Returns: the number of sets read so far; unchanged means no new levels
+INT32U SpectrumGet(SpectrumLevels *levels)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    INT32U n;
+
+    OS_ENTER_CRITICAL();
+    *levels = latest;
+    n = sequence;
+    OS_EXIT_CRITICAL();
+    return n;
+}
+
+// SpectrumGetStats
+// Copies the counts of analyzer reads and their cost. Only Mp3Task
+// changes them, so a copy taken from another task may be a read behind.
+void SpectrumGetStats(SpectrumStats *copy)
+{
+    *copy = stats;
+}
+
+#endif // APP_CFG_SPECTRUM_EN
@@ -0,0 +1,58 @@
+/*
+    spectrum.h
+    Band levels from the VS1053 spectrum analyzer plugin, for the visualizer.
+
+    Mp3Task loads the plugin after each decoder reset and reads the levels
+    between data writes; DisplayTask takes the latest set each frame.
+
+    Enable with APP_CFG_SPECTRUM_EN in app_cfg.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __SPECTRUM_H__
+#define __SPECTRUM_H__
+
+#include <app_cfg.h>
+#include <pjdf.h>
+
+#define SPECTRUM_MAX_BANDS      23      // most bands the plugin can be set up for
+#define SPECTRUM_LEVEL_MAX      63      // levels and peaks are 6 bit fields
+#define SPECTRUM_PERIOD_TICKS   40      // read no more often than this, 25 times a second
+#define SPECTRUM_VU_FALL        2       // most the VU level falls a read, full scale in 1.3 s
+
+typedef struct
+{
+    INT8U count;                        // bands in use
+    INT8U level[SPECTRUM_MAX_BANDS];    // current level of each band, 0 to SPECTRUM_LEVEL_MAX
+    INT8U peak[SPECTRUM_MAX_BANDS];     // held peak of each band
+    INT8U vu;                           // RMS of the levels, falling slowly, for the VU meter
+} SpectrumLevels;
+
+typedef struct
+{
+    INT32U loads;       // plugin loads
+    INT32U reads;       // sets of levels read
+    INT32U deferred;    // passes of Mp3Task with a read due but put off, the FIFO not known to be full
+    INT32U sciOps;      // SCI reads and writes made for the analyzer
+    INT32U maxUs;       // longest read, with the SPI bus held
+    INT32U totalUs;
+} SpectrumStats;
+
+#if APP_CFG_SPECTRUM_EN > 0u
+void SpectrumLoad(HANDLE hMp3);
+BOOLEAN SpectrumIsDue(void);
+void SpectrumRead(HANDLE hMp3);
+INT32U SpectrumGet(SpectrumLevels *levels);
+void SpectrumDefer(void);
+void SpectrumGetStats(SpectrumStats *stats);
+#else
+#define SpectrumLoad(hMp3)
+#define SpectrumIsDue()         OS_FALSE
+#define SpectrumRead(hMp3)
+#define SpectrumGet(levels)     0
+#define SpectrumDefer()
+#define SpectrumGetStats(stats)
+#endif
+
+#endif /* __SPECTRUM_H__ */
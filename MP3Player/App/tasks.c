@@ -14,25 +14,63 @@ Module Description:
 
 ************************************************************************************/
 #include <stdarg.h>
+#include <stdlib.h>
 
 #include "bsp.h"
 #include "print.h"
 #include "mp3Util.h"
+#include "trace.h"
+#include "tickBench.h"
+#include "appMsg.h"
+#include "lcdBench.h"
+#include "pixelBench.h"
+#include "uiWidgets.h"
+#include "albumArt.h"
+#include "playerIcons.h"
+#include "spectrum.h"
+#include "trackIndex.h"
+#include "uiScrollList.h"
+#include "touchBench.h"
+#include "gesture.h"
+#include "SD.h"
 
 #include <Adafruit_GFX.h>    // Core graphics library
 #include <Adafruit_ILI9341.h>
+#include <Adafruit_ILI9341_Strip.h>
+#include <Adafruit_ILI9341_Scroll.h>
 #include <Adafruit_FT6206.h>
+#include <dejaVuSansBold16.h>
 
 Adafruit_ILI9341 lcdCtrl = Adafruit_ILI9341(); // The LCD controller
 
+Adafruit_ILI9341_Strip stripCtrl = Adafruit_ILI9341_Strip(&lcdCtrl); // Flicker free redraws of LCD regions
+
+Adafruit_ILI9341_Scroll titleScroll = Adafruit_ILI9341_Scroll(&lcdCtrl, &stripCtrl); // Rolls new song titles in
+
 Adafruit_FT6206 touchCtrl = Adafruit_FT6206(); // The touch controller
 
-//BUTTONS
+UiScreen uiScreen = UiScreen(&lcdCtrl, &stripCtrl, ILI9341_BLACK); // Repaints only what changed
+
+//WIDGETS
+// Keep clear of the title band, rows TITLE_TOP to TITLE_TOP+TITLE_ROWS-1
+
+UiLabel statusLabel = UiLabel(40, 80, 125, 20, ILI9341_WHITE, NULL, 2);
+UiLabel timeLabel = UiLabel(170, 80, 60, 16, ILI9341_WHITE, NULL, 2);
+#define PROGRESS_MAX 1000   // finer than the bar's columns, so each column step shows
+#define PROGRESS_LEFT 40
+#define PROGRESS_WIDTH 160
+UiProgressBar progressBar = UiProgressBar(PROGRESS_LEFT, 102, PROGRESS_WIDTH, 6, ILI9341_WHITE, ILI9341_GREEN, PROGRESS_MAX);
 
-Adafruit_GFX_Button playButton = Adafruit_GFX_Button();
-Adafruit_GFX_Button stopButton = Adafruit_GFX_Button();
-Adafruit_GFX_Button nextButton = Adafruit_GFX_Button();
-Adafruit_GFX_Button prevButton = Adafruit_GFX_Button();
+// Icons from Tools/icons, packed by Tools/spriteGen.cpp
+UiButton playButton = UiButton(33, 113, &playerIconsPlay, &playerIconsPlayPressed);
+UiButton stopButton = UiButton(133, 113, &playerIconsStop, &playerIconsStopPressed);
+UiButton nextButton = UiButton(133, 213, &playerIconsNext, &playerIconsNextPressed);
+UiButton prevButton = UiButton(33, 213, &playerIconsPrev, &playerIconsPrevPressed);
+
+#if APP_CFG_SPECTRUM_EN > 0u
+UiSpectrum spectrumBars = UiSpectrum(33, 291, 175, 20, ILI9341_GREEN, ILI9341_WHITE, SPECTRUM_LEVEL_MAX);
+UiProgressBar vuMeter = UiProgressBar(33, 313, 175, 6, ILI9341_WHITE, ILI9341_YELLOW, SPECTRUM_LEVEL_MAX);
+#endif
 
 #define PENRADIUS 3
 
@@ -47,6 +85,37 @@ long MapTouchToScreen(long x, long in_min, long in_max, long out_min, long out_m
 
 #define BUFSIZE 256
 
+// Song title band, scrolled by the panel when the song changes
+#define TITLE_TOP           60
+#define TITLE_ROWS          20
+#define TITLE_SCROLL_STEP   1       // rows per frame, 480 bytes each
+#define TITLE_SCROLL_DELAY  5       // ticks between frames
+#define NO_TITLE            0xFF
+
+// DisplayTask sleeps until there is something to show. Only a drag of
+// the track browser, or the spectrum while a song plays, makes it run in
+// frames of UI_FRAME_TICKS, applying every update of a frame together.
+#define UI_FRAME_TICKS      40
+
+// The title band's content is a column of TITLE_ROWS high entries, entry i
+// showing the song titleTape[i & 1]: the one on screen and the one rolling in
+static INT8U titleTape[2] = { NO_TITLE, NO_TITLE };
+
+// Song whose album art is on screen, NO_TITLE if none
+static INT8U artSong = NO_TITLE;
+
+// Track browser: the SD card's tracks, listed below the title band in
+// place of the player's widgets. It takes over the title band's hardware
+// scrolling, and its header takes the title band's rows.
+#define BROWSE_TOP          (TITLE_TOP + TITLE_ROWS)
+#define BROWSE_ROW_HEIGHT   20
+UiScrollList trackList = UiScrollList(&titleScroll, BROWSE_ROW_HEIGHT, ILI9341_WHITE, &dejaVuSansBold16);
+static BOOLEAN browserShown = OS_FALSE;    // DisplayTask's
+
+// Lines TouchTask has dragged the list by that DisplayTask has yet to
+// scroll, guarded by a critical section
+static INT32S browseDrag = 0;
+
 /************************************************************************************
 
    Allocate the stacks for each task.
@@ -56,7 +125,6 @@ long MapTouchToScreen(long x, long in_min, long in_max, long out_min, long out_m
 
 static OS_STK   TouchTaskStk[APP_CFG_TASK_START_STK_SIZE];
 static OS_STK   DisplayTaskStk[APP_CFG_TASK_START_STK_SIZE];
-static OS_STK   CommandTaskStk[APP_CFG_TASK_START_STK_SIZE];
 static OS_STK   Mp3TaskStk[APP_CFG_TASK_START_STK_SIZE];
 
      
@@ -64,7 +132,6 @@ static OS_STK   Mp3TaskStk[APP_CFG_TASK_START_STK_SIZE];
 void TouchTask(void* pdata);
 void DisplayTask(void* pdata);
 //void Mp3DemoTask(void* pdata);
-void CommandTask(void* pdata);
 void Mp3Task(void* pdata);
 
 
@@ -76,22 +143,88 @@ void PrintToLcdWithBuf(char *buf, int size, char *format, ...);
 // Globals
 //BOOLEAN nextSong = OS_FALSE;
 
-// Message queue nonsense
-
-#define QUEUE_SIZE 4
+// Command bus
+// TouchTask sets one flag per command and Mp3Task pends on the command flags
+// together with the decoder's DREQ flag, so it sleeps until there is work.
 
 typedef enum {
   play,
   stop,
   next,
-  prev
+  prev,
+  NUM_COMMANDS
 } commands;
 
-OS_EVENT * commandMsgQ;
-
-void* commandMsg[QUEUE_SIZE];
+#define MP3_CMD_PLAY   0x0001
+#define MP3_CMD_STOP   0x0002
+#define MP3_CMD_NEXT   0x0004
+#define MP3_CMD_PREV   0x0008
+#define MP3_EVT_DREQ   0x0010   // set from the DREQ interrupt when the decoder can take more data
+#define MP3_CMD_SEEK   0x0020   // jump to seekTarget in the song
+#define MP3_CMD_VOLUME 0x0040   // set the volume to volumeTarget
+#define MP3_CMD_ALL    (MP3_CMD_PLAY | MP3_CMD_STOP | MP3_CMD_NEXT | MP3_CMD_PREV | MP3_CMD_SEEK | MP3_CMD_VOLUME)
+
+// Arguments of MP3_CMD_SEEK and MP3_CMD_VOLUME, set by TouchTask before
+// it sets the flag
+static INT16U seekTarget;       // out of PROGRESS_MAX
+static INT8U volumeTarget;      // SCI_VOL attenuation, 0.5 dB steps
+
+#define MP3_VOLUME_DEFAULT  0x10    // as BspMp3SetVol1010
+#define MP3_VOLUME_QUIETEST 0x60    // as BspMp3SetVol6060, as far down as a drag goes
+
+// Flag for each command, indexed by commands
+static const OS_FLAGS commandFlags[NUM_COMMANDS] = { MP3_CMD_PLAY, MP3_CMD_STOP, MP3_CMD_NEXT, MP3_CMD_PREV };
+
+// Button for each command, indexed by commands. TouchTask only hit tests
+// them, reading their fixed geometry; DisplayTask owns their drawing.
+static UiButton * const commandButtons[NUM_COMMANDS] = { &playButton, &stopButton, &nextButton, &prevButton };
+
+OS_FLAG_GRP * mp3Flags;
+
+// Touch input
+// TouchTask samples the panel every TOUCH_ACTIVE_TICKS while it is touched
+// and until the gesture engine has seen the touch end. Otherwise it sleeps
+// with no timeout until the FT6206 INT line wakes it, making no I2C
+// transactions at all while idle. A board without the line wired builds
+// with APP_CFG_TOUCH_INT_EN 0 instead, and then TouchTask polls at the
+// touch rate for TOUCH_IDLE_AFTER ticks after the last touch and every
+// TOUCH_IDLE_TICKS after that.
+
+#define TOUCH_EVT_INT       0x0001  // set from the touch interrupt when a touch begins
+#define TOUCH_ACTIVE_TICKS  5
+#define TOUCH_IDLE_TICKS    50
+#define TOUCH_IDLE_AFTER    2000
+
+OS_FLAG_GRP * touchFlags;
+
+typedef struct
+{
+    INT32U wakeups;     // times TouchTask woke without a touch in progress
+    INT32U samples;     // burst reads of the touch controller
+    INT32U busUs;       // spent in them, with interrupts disabled
+    INT32U maxUs;       // longest
+} TouchStats;
+
+static TouchStats touchStats;   // TouchTask's, read by DisplayTask's report
+
+// Gestures
+// A tap on a button gives its command and a swipe left or right the next
+// or previous song. A drag that starts in the seek band, the status and
+// progress rows, seeks to where it is let go; any other drag that starts
+// mostly up or down sets the volume, a 0.5 dB step per pixel. A tap on the
+// title, or a long press away from the buttons, shows or hides the track
+// browser. There dragging scrolls the list and a long press anywhere
+// hides it; the list is for looking only, as songs play from flash.
+#define SEEK_TOP            (TITLE_TOP + TITLE_ROWS)
+#define SEEK_BOTTOM         112
 
-commands commandMem[QUEUE_SIZE];
+typedef enum {
+  dragNone,
+  dragScroll,       // scrolling the track browser
+  dragSeek,         // along the seek band
+  dragVolume,       // up or down
+  dragSideways      // a swipe, if it is quick enough
+} touchDrag;
 
 // Mailboxes
 
@@ -108,13 +241,52 @@ typedef enum {
 typedef enum {
   startDisplay,
   playDisplay,
+  resumeDisplay,
   pauseDisplay
 } displayState;
 
-OS_EVENT * mp3MBox;
-OS_EVENT * displayMBox;
+// Display updates
+// The player's transitions are AppMsg messages of type APP_MSG_DISPLAY,
+// owned by DisplayTask once posted. They are rare and none may be lost: if
+// the pool or the queue is full, DisplayTask is told to show the latest
+// transition instead. State that changes often - the playing position, the
+// buttons held down and the track browser - is a latest value guarded by a
+// critical section, so however much of it comes while DisplayTask is busy
+// nothing queues up. Each post sets a flag in displayFlags, on which
+// DisplayTask sleeps.
+#define DISPLAY_QUEUE_SIZE 4
+
+OS_EVENT * displayQ;
+
+void* displayMsg[DISPLAY_QUEUE_SIZE];
+
+#define DISPLAY_EVT_MSG         0x0001  // a transition is on displayQ
+#define DISPLAY_EVT_LOST        0x0002  // a transition was not queued, show latestDisplay
+#define DISPLAY_EVT_POSITION    0x0004  // displayPosition changed
+#define DISPLAY_EVT_BUTTONS     0x0008  // displayButtons changed
+#define DISPLAY_EVT_BROWSE      0x0010  // browseWanted changed
+#define DISPLAY_EVT_DRAG        0x0020  // the track list was dragged
+#define DISPLAY_EVT_ALL         0x003F
+
+OS_FLAG_GRP * displayFlags;
+
+// Seconds played in the high half, progress through the song out of
+// PROGRESS_MAX in the low half. Mp3Task sets the position no more often
+// than every POSITION_PERIOD_TICKS.
+#define DISPLAY_POSITION(seconds, progress) (((INT32U)(seconds) << 16) | (progress))
+#define POSITION_PERIOD_TICKS   250
+
+static INT32U displayPosition;              // DISPLAY_POSITION() of the song playing
+static INT8U displayButtons;                // a bit per command whose button is held down
+static displayState latestDisplay = startDisplay;   // Mp3Task's last transition,
+static INT8U latestSong;                            // and its song
+static BOOLEAN browseWanted = OS_FALSE;     // TouchTask's: the browser should be up
 
 void updateMp3PlayerState(mp3PlayerState* state, commands currentCommand);
+void PostDisplayUpdate(displayState newDisplayState);
+void PostDisplayPosition(INT16U seconds, INT16U progress);
+void PostDisplayButton(commands button, BOOLEAN pressed);
+void PostDisplayBrowse(BOOLEAN show);
 
 // Current Song Index - used for MP3 Task and Display Task
 INT8U currentSongIndex = 0;
@@ -140,6 +312,12 @@ void StartupTask(void* pdata)
     // Start the system tick
     OS_CPU_SysTickInit(OS_TICKS_PER_SEC);
     
+    // Optionally measure the cost of the tick handler (APP_CFG_TICK_BENCH_EN)
+    TickBench();
+    
+    // Optionally measure the pixel kernels (APP_CFG_PIXEL_BENCH_EN)
+    PixelBench();
+    
     // Initialize SD card
     PrintWithBuf(buf, PRINTBUFMAX, "Opening handle to SD driver: %s\n", PJDF_DEVICE_ID_SD_ADAFRUIT);
     hSD = Open(PJDF_DEVICE_ID_SD_ADAFRUIT, 0);
@@ -157,89 +335,43 @@ void StartupTask(void* pdata)
     pjdfErr = Ioctl(hSD, PJDF_CTRL_SD_SET_SPI_HANDLE, &hSPI, &length);
     if(PJDF_IS_ERROR(pjdfErr)) while(1);
 
+    // Mount the card and open the index of its tracks for the browser,
+    // listing them again if there is no index or the card has changed
+    if (SD.begin(hSD)) {
+        PrintWithBuf(buf, BUFSIZE, "StartupTask: %lu tracks on the SD card\n", TrackIndexOpen(OS_FALSE));
+    } else {
+        PrintWithBuf(buf, BUFSIZE, "StartupTask: no SD card\n");
+    }
+
     // Create the test tasks
     PrintWithBuf(buf, BUFSIZE, "StartupTask: Creating the application tasks\n");
     
-    commandMsgQ = OSQCreate(&commandMsg[0], QUEUE_SIZE);
-    mp3MBox = OSMboxCreate((void*)0);
-    displayMBox = OSMboxCreate((void*)0);
+    INT8U err;
+    mp3Flags = OSFlagCreate(0, &err);
+    if (err != OS_ERR_NONE) while(1);
+    displayFlags = OSFlagCreate(0, &err);
+    if (err != OS_ERR_NONE) while(1);
+    AppMsgInit();
+    displayQ = OSQCreate(&displayMsg[0], DISPLAY_QUEUE_SIZE);
 
     // The maximum number of tasks the application can have is defined by OS_MAX_TASKS in os_cfg.h
     OSTaskCreate(TouchTask, (void*)0, &TouchTaskStk[APP_CFG_TASK_START_STK_SIZE-1], 6);
     OSTaskCreate(DisplayTask, (void*)0, &DisplayTaskStk[APP_CFG_TASK_START_STK_SIZE-1], 8);
-    OSTaskCreate(CommandTask, (void*)0, &CommandTaskStk[APP_CFG_TASK_START_STK_SIZE-1], 3);
     OSTaskCreate(Mp3Task, (void*)0, &Mp3TaskStk[APP_CFG_TASK_START_STK_SIZE-1], 5);
     
+    // Name the tasks and message objects so they can be identified in traces
+    OSTaskNameSet(6, (INT8U*)"TouchTask", &err);
+    OSTaskNameSet(8, (INT8U*)"DisplayTask", &err);
+    OSTaskNameSet(5, (INT8U*)"Mp3Task", &err);
+    OSFlagNameSet(mp3Flags, (INT8U*)"mp3Flags", &err);
+    OSFlagNameSet(displayFlags, (INT8U*)"displayFlags", &err);
+    OSEventNameSet(displayQ, (INT8U*)"displayQ", &err);
 
     // Delete ourselves, letting the work be done in the new tasks.
     PrintWithBuf(buf, BUFSIZE, "StartupTask: deleting self\n");
 	OSTaskDel(OS_PRIO_SELF);
 }
 
-/************************************************************************************
-
-   Command Task
-
-************************************************************************************/
-void CommandTask(void* pdata)
-{
-    char buf[BUFSIZE];
-	PrintWithBuf(buf, BUFSIZE, "CommandTask: starting\n");
-    
-    INT8U err;
-    commands* pCurrentCommand;
-    while(1) {
-        pCurrentCommand = (commands*)OSQPend(commandMsgQ, 0, &err);
-        PrintWithBuf(buf, BUFSIZE, "CommandTask: received command!\n");
-        switch(*pCurrentCommand) {
-        case play:
-            PrintWithBuf(buf, BUFSIZE, "CommandTask: Pressed play!\n");
-            err = OSMboxPost(mp3MBox, (void*)pCurrentCommand);
-            if(err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "CommandTask: error posting to mp3 mailbox - %d!\n", err);
-            }
-            
-            break;
-        case stop:
-            PrintWithBuf(buf, BUFSIZE, "CommandTask: Pressed stop!\n");
-            err = OSMboxPost(mp3MBox, (void*)pCurrentCommand);
-            if(err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "CommandTask: error posting to mp3 mailbox - %d!\n", err);
-            }
-            break;
-        case next:
-            PrintWithBuf(buf, BUFSIZE, "CommandTask: Pressed next!\n");
-            *pCurrentCommand = stop;
-            err = OSMboxPost(mp3MBox, (void*)pCurrentCommand);
-            if(err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "CommandTask: error posting to mp3 mailbox - %d!\n", err);
-            }
-            OSTimeDly(5);
-            *pCurrentCommand = next;
-            err = OSMboxPost(mp3MBox, (void*)pCurrentCommand);
-            if(err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "CommandTask: error posting to mp3 mailbox - %d!\n", err);
-            }
-            break;
-        case prev:
-            PrintWithBuf(buf, BUFSIZE, "CommandTask: Pressed next!\n");
-            *pCurrentCommand = stop;
-            err = OSMboxPost(mp3MBox, (void*)pCurrentCommand);
-            if(err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "CommandTask: error posting to mp3 mailbox - %d!\n", err);
-            }
-            OSTimeDly(5);
-            *pCurrentCommand = prev;
-            err = OSMboxPost(mp3MBox, (void*)pCurrentCommand);
-            if(err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "CommandTask: error posting to mp3 mailbox - %d!\n", err);
-            }
-            break;
-        }
-        OSTimeDly(5);
-    }
-}
-
 /************************************************************************************
 
    MP3 Task
@@ -275,13 +407,22 @@ void Mp3Task(void* pdata)
     PrintWithBuf(buf, BUFSIZE, "Finished MP3 device test\n");
     OSTimeDly(500);
     
-    commands* pCurrentCommand;
+    // Have the driver set MP3_EVT_DREQ each time the decoder can take more data
+    Mp3DreqFlag dreqFlag = { mp3Flags, MP3_EVT_DREQ };
+    length = sizeof(dreqFlag);
+    pjdfErr = Ioctl(hMp3, PJDF_CTRL_MP3_SET_DREQ_FLAG, &dreqFlag, &length);
+    if(PJDF_IS_ERROR(pjdfErr)) while(1);
+    
+    INT8U err;
+    OS_FLAGS flags;
+    OS_FLAGS waitFlags;
+    commands currentCommand;
     
     mp3PlayerState state = init;
-    displayState newDisplayState = startDisplay;
 
     // mp3 stream variables
     INT32U bufLen;
+    INT32U progressStep;    // bytes of the song per step of progress
     INT8U *bufPos;
     INT32U iBufPos = 0;
     INT32U chunkLen;
@@ -291,27 +432,76 @@ void Mp3Task(void* pdata)
     // Bools used in state machine
     BOOLEAN notifyPause = false;
     BOOLEAN playNextSong = false;
+    BOOLEAN decoderReady;
+    BOOLEAN decoderFull = false;
+    BOOLEAN fifoFull;
+    BOOLEAN seekPending = false;    // seekTarget is yet to be applied
+    INT32U positionTime = 0;
+    INT16U seconds, progress;
+    INT16U lastSeconds = 0, lastProgress = 0;
+    INT8U volume = MP3_VOLUME_DEFAULT;
+    INT32U seekPos, bytesPerSecond;
   
     while(1) {
-        pCurrentCommand = (commands*)OSMboxAccept(mp3MBox);
-        if(pCurrentCommand) {
-            //notifyDisplayIfNeeded(&state, *pCurrentCommand);
-            if(state == pause && *pCurrentCommand == play) {
-                newDisplayState = playDisplay;
-                OSMboxPost(displayMBox, (void*)&newDisplayState);
+        // Sleep until a command arrives or, while playing with the decoder
+        // FIFO full, until DREQ rises. Other states have work to do so they
+        // only pick up commands that are already waiting.
+        if (state == init || state == pause || (state == playback && decoderFull)) {
+            waitFlags = (state == playback) ? (MP3_CMD_ALL | MP3_EVT_DREQ) : MP3_CMD_ALL;
+            flags = OSFlagPend(mp3Flags, waitFlags, OS_FLAG_WAIT_SET_ANY + OS_FLAG_CONSUME, 0, &err);
+        } else {
+            flags = OSFlagAccept(mp3Flags, MP3_CMD_ALL, OS_FLAG_WAIT_SET_ANY + OS_FLAG_CONSUME, &err);
+        }
+        // Woken by DREQ from a full FIFO: the decoder has nearly all of
+        // its 2 KB FIFO in hand, time enough to read the spectrum
+        fifoFull = decoderFull && (flags & MP3_EVT_DREQ);
+        decoderFull = false;
+        
+        // Several commands may have been set since the last pass
+        for (int i = 0; i < NUM_COMMANDS; i++) {
+            if (!(flags & commandFlags[i])) continue;
+            currentCommand = (commands)i;
+            TraceUser(TRACE_USER_MP3_COMMAND, currentCommand);
+            if(state == pause && currentCommand == play) {
+                PostDisplayUpdate(resumeDisplay);
                 notifyPause = true;
             }
-            updateMp3PlayerState(&state, *pCurrentCommand);
+            updateMp3PlayerState(&state, currentCommand);
+        }
+        
+        // Volume and seek take their argument from TouchTask
+        if (flags & MP3_CMD_VOLUME) {
+            volume = volumeTarget;
+            Mp3SetVolume(hMp3, volume);
+        }
+        if (flags & MP3_CMD_SEEK) {
+            seekPending = (state == playback || state == pause);
+        }
+        if (seekPending && lastSeconds > 0 && (state == playback || state == pause)) {
+            // Jump in the stream and let the decoder find the next frame.
+            // SCI_DECODE_TIME only counts on, so set it from the byte rate
+            // of the song so far, which is why a seek waits for the first
+            // second to be played.
+            seekPending = false;
+            seekPos = progressStep * seekTarget;
+            if (seekPos < bufLen) {
+                bytesPerSecond = iBufPos / lastSeconds;
+                seconds = bytesPerSecond ? (INT16U)(seekPos / bytesPerSecond) : 0;
+                bufPos = (INT8U*)songData[currentSongIndex] + seekPos;
+                iBufPos = seekPos;
+                Mp3SetDecodeTime(hMp3, seconds);
+                PostDisplayPosition(seconds, seekTarget);
+                lastSeconds = seconds;
+                lastProgress = seekTarget;
+            }
         }
         switch(state) {
         case init:
         case pause:
             if(notifyPause) {
-                newDisplayState = pauseDisplay;
-                OSMboxPost(displayMBox, (void*)&newDisplayState);
+                PostDisplayUpdate(pauseDisplay);
                 notifyPause = false;
             }
-            OSTimeDly(50);
             break;
         case nextSong:
             if (currentSongIndex == NUM_SONGS-1) {
@@ -334,6 +524,7 @@ void Mp3Task(void* pdata)
             iBufPos = 0;
             bufPos = (INT8U*)songData[currentSongIndex];
             bufLen = songSizes[currentSongIndex];
+            progressStep = bufLen / PROGRESS_MAX ? bufLen / PROGRESS_MAX : 1;
             // Place MP3 driver in command mode (subsequent writes will be sent to the decoder's command interface)
             Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_COMMAND, 0, 0);
             
@@ -341,25 +532,67 @@ void Mp3Task(void* pdata)
             length = BspMp3SoftResetLen;
             Write(hMp3, (void*)BspMp3SoftReset, &length);
          
-            // Set volume
-            length = BspMp3SetVol1010Len;
-            Write(hMp3, (void*)BspMp3SetVol1010, &length);
-
             // To allow streaming data, set the decoder mode to Play Mode
             length = BspMp3PlayModeLen;
             Write(hMp3, (void*)BspMp3PlayMode, &length);
+            
+            // The reset removed the analyzer plugin (APP_CFG_SPECTRUM_EN)
+            SpectrumLoad(hMp3);
+            
+            // Set volume, as last dragged to
+            Mp3SetVolume(hMp3, volume);
            
             // Set MP3 driver to data mode (subsequent writes will be sent to decoder's data interface)
             Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_DATA, 0, 0);
             
-            newDisplayState = playDisplay;
-            OSMboxPost(displayMBox, (void*)&newDisplayState);
+            PostDisplayUpdate(playDisplay);
+            // The reset also cleared SCI_DECODE_TIME
+            PostDisplayPosition(0, 0);
+            lastSeconds = lastProgress = 0;
+            positionTime = OSTimeGet();
+            seekPending = false;
             
             notifyPause = true;
             state = playback;
             playNextSong = false;
             break;
         case playback:
+            // Only write when the decoder has room so the write never waits.
+            // Clear the DREQ flag before sampling the pin so that a rising
+            // edge after the sample wakes the pend above.
+            OSFlagPost(mp3Flags, MP3_EVT_DREQ, OS_FLAG_CLR, &err);
+            length = sizeof(decoderReady);
+            Ioctl(hMp3, PJDF_CTRL_MP3_IS_READY, &decoderReady, &length);
+            if (!decoderReady) {
+                decoderFull = true;
+                break;
+            }
+            
+            // Spectrum levels for the display, read only with a full
+            // FIFO in hand so that the bus time never starves the decoder
+            if (SpectrumIsDue()) {
+                if (fifoFull) {
+                    SpectrumRead(hMp3);
+                } else {
+                    SpectrumDefer();
+                }
+            }
+            
+            // Position for the display at a low fixed rate, and only if it
+            // moved. DREQ is high so the decode time read does not wait.
+            if (OSTimeGet() - positionTime >= POSITION_PERIOD_TICKS) {
+                positionTime = OSTimeGet();
+                seconds = Mp3GetDecodeTime(hMp3);
+                // iBufPos * PROGRESS_MAX would overflow past 4 MB
+                progress = (INT16U)(iBufPos / progressStep);
+                if (progress > PROGRESS_MAX) progress = PROGRESS_MAX;
+                if (seconds != lastSeconds || progress != lastProgress) {
+                    PostDisplayPosition(seconds, progress);
+                    lastSeconds = seconds;
+                    lastProgress = progress;
+                }
+            }
+            
             // detect last chunk of pBuf
             if (bufLen - iBufPos < MP3_DECODER_BUF_SIZE)
             {
@@ -377,17 +610,17 @@ void Mp3Task(void* pdata)
             }
                     
             Write(hMp3, bufPos, &chunkLen);
+            if (iBufPos == 0) TraceUser(TRACE_USER_MP3_FIRST_DATA, currentSongIndex);
                     
             bufPos += chunkLen;
             iBufPos += chunkLen;
-            OSTimeDly(1);
+            
             break;
         case stopPlayback:
             Ioctl(hMp3, PJDF_CTRL_MP3_SELECT_COMMAND, 0, 0);
             length = BspMp3SoftResetLen;
             Write(hMp3, (void*)BspMp3SoftReset, &length);
-            newDisplayState = startDisplay;
-            OSMboxPost(displayMBox, (void*)&newDisplayState);
+            PostDisplayUpdate(startDisplay);
             notifyPause = false;
             if (playNextSong) {
                 state = startPlayback;
@@ -400,6 +633,109 @@ void Mp3Task(void* pdata)
     }
 }
 
+/************************************************************************************
+
+   Sends a display transition with the current song to DisplayTask
+
+************************************************************************************/
+void PostDisplayUpdate(displayState newDisplayState)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    INT8U err;
+    
+    OS_ENTER_CRITICAL();
+    latestDisplay = newDisplayState;
+    latestSong = currentSongIndex;
+    OS_EXIT_CRITICAL();
+    
+    // Pool exhausted or queue full, counted in the AppMsg stats
+    AppMsg *pMsg = AppMsgAlloc(APP_MSG_DISPLAY, newDisplayState, currentSongIndex);
+    if (pMsg == NULL || AppMsgPost(displayQ, pMsg) != OS_ERR_NONE) {
+        OSFlagPost(displayFlags, DISPLAY_EVT_LOST, OS_FLAG_SET, &err);
+        return;
+    }
+    OSFlagPost(displayFlags, DISPLAY_EVT_MSG, OS_FLAG_SET, &err);
+}
+
+/************************************************************************************
+
+   Sets the playing position in the current song for DisplayTask
+
+************************************************************************************/
+void PostDisplayPosition(INT16U seconds, INT16U progress)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    INT8U err;
+    
+    OS_ENTER_CRITICAL();
+    displayPosition = DISPLAY_POSITION(seconds, progress);
+    OS_EXIT_CRITICAL();
+    OSFlagPost(displayFlags, DISPLAY_EVT_POSITION, OS_FLAG_SET, &err);
+}
+
+/************************************************************************************
+
+   Tells DisplayTask that a button went down or up, to show it pressed
+
+************************************************************************************/
+void PostDisplayButton(commands button, BOOLEAN pressed)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    INT8U err;
+    
+    OS_ENTER_CRITICAL();
+    if (pressed) {
+        displayButtons |= 1 << button;
+    } else {
+        displayButtons &= ~(1 << button);
+    }
+    OS_EXIT_CRITICAL();
+    OSFlagPost(displayFlags, DISPLAY_EVT_BUTTONS, OS_FLAG_SET, &err);
+}
+
+/************************************************************************************
+
+   Asks DisplayTask to show or hide the track browser. Only TouchTask
+   calls it.
+
+************************************************************************************/
+void PostDisplayBrowse(BOOLEAN show)
+{
+    INT8U err;
+    
+    browseWanted = show;
+    OSFlagPost(displayFlags, DISPLAY_EVT_BROWSE, OS_FLAG_SET, &err);
+}
+
+/************************************************************************************
+
+   Adds a drag of the track list for DisplayTask's next frame, so however
+   fast the touch samples come the list scrolls once a frame
+
+************************************************************************************/
+static void PostBrowseDrag(INT32S lines)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    INT8U err;
+
+    OS_ENTER_CRITICAL();
+    browseDrag += lines;
+    OS_EXIT_CRITICAL();
+    OSFlagPost(displayFlags, DISPLAY_EVT_DRAG, OS_FLAG_SET, &err);
+}
+
+static INT32S TakeBrowseDrag(void)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    INT32S lines;
+
+    OS_ENTER_CRITICAL();
+    lines = browseDrag;
+    browseDrag = 0;
+    OS_EXIT_CRITICAL();
+    return lines;
+}
+
 /************************************************************************************
 
    Updates MP3 Task state
@@ -427,12 +763,13 @@ void updateMp3PlayerState(mp3PlayerState* state, commands currentCommand)
     return;
   }
   
-  if((*state == stopPlayback || *state == init)   && currentCommand == next) {
+  // Skipping while playing or paused needs no stop first: startPlayback resets the decoder
+  if((*state == stopPlayback || *state == init || *state == playback || *state == pause) && currentCommand == next) {
     *state = nextSong;
     return;
   }
   
-  if((*state == stopPlayback || *state == init)  && currentCommand == prev) {
+  if((*state == stopPlayback || *state == init || *state == playback || *state == pause) && currentCommand == prev) {
     *state = prevSong;
     return;
   }
@@ -446,22 +783,21 @@ void updateMp3PlayerState(mp3PlayerState* state, commands currentCommand)
 static void DrawLcdContents()
 {
     lcdCtrl.setRotation(180);
-    playButton.initButton(&lcdCtrl, 70, 150, 75, 75, ILI9341_WHITE, ILI9341_GREEN, ILI9341_WHITE, "play", 2);
-    stopButton.initButton(&lcdCtrl, 170, 150, 75, 75, ILI9341_WHITE, ILI9341_RED, ILI9341_WHITE, "stop", 2);
-    nextButton.initButton(&lcdCtrl, 170, 250, 75, 75, ILI9341_WHITE, ILI9341_BLUE, ILI9341_WHITE, "next", 2);
-    prevButton.initButton(&lcdCtrl, 70, 250, 75, 75, ILI9341_WHITE, ILI9341_BLUE, ILI9341_WHITE, "prev", 2);
+    uiScreen.add(&statusLabel);
+    uiScreen.add(&timeLabel);
+    uiScreen.add(&progressBar);
+    uiScreen.add(&playButton);
+    uiScreen.add(&stopButton);
+    uiScreen.add(&nextButton);
+    uiScreen.add(&prevButton);
+#if APP_CFG_SPECTRUM_EN > 0u
+    uiScreen.add(&spectrumBars);
+    uiScreen.add(&vuMeter);
+#endif
     
-    lcdCtrl.fillScreen(ILI9341_BLACK);
-    
-    // Print a message on the LCD
-    lcdCtrl.setCursor(40, 60);
-    lcdCtrl.setTextColor(ILI9341_WHITE);  
-    lcdCtrl.setTextSize(2);
-    playButton.drawButton();
-    stopButton.drawButton();
-    nextButton.drawButton();
-    prevButton.drawButton();
-
+    // The first paint clears the whole screen behind the widgets
+    uiScreen.invalidateAll();
+    uiScreen.paint();
 }
 
 /************************************************************************************
@@ -469,14 +805,51 @@ static void DrawLcdContents()
    Update song title on display
 
 ************************************************************************************/
-void UpdateSongName()
+static void DrawTitleLines(Adafruit_GFX *gfx, int16_t y, int32_t firstLine, int16_t count, void *arg)
 {
-    char buf[BUFSIZE];
-    lcdCtrl.fillRect(40, 60, 200, 20, ILI9341_BLACK);
-    lcdCtrl.setCursor(40, 60);
-    lcdCtrl.setTextColor(ILI9341_WHITE);  
-    lcdCtrl.setTextSize(2);
-    PrintToLcdWithBuf(buf, BUFSIZE, (char *)songNames[currentSongIndex]);
+    for (int32_t entry = firstLine / TITLE_ROWS; entry * TITLE_ROWS < firstLine + count; entry++)
+    {
+        INT8U song = titleTape[entry & 1];
+        if (song == NO_TITLE) continue;
+
+        gfx->setCursor(40, y + (int16_t)(entry * TITLE_ROWS - firstLine));
+        gfx->setTextColor(ILI9341_WHITE);
+        gfx->setFont(&dejaVuSansBold16);
+        for (const char *p = songNames[song]; *p != 0; p++) gfx->write(*p);
+        gfx->setFont(NULL);
+    }
+}
+
+void UpdateSongName(INT8U songIndex)
+{
+    // The browser has the band; the title is drawn when it comes back
+    if (browserShown) {
+        titleTape[0] = songIndex;
+        return;
+    }
+
+    INT32U entry = titleScroll.position() / TITLE_ROWS;
+    if (titleTape[entry & 1] == songIndex) return;
+
+    // Roll the new title up into view; each frame draws only the new rows
+    titleTape[(entry + 1) & 1] = songIndex;
+    for (int i = 0; i < TITLE_ROWS; i += TITLE_SCROLL_STEP)
+    {
+        titleScroll.scroll(TITLE_SCROLL_STEP, DrawTitleLines, NULL);
+        OSTimeDly(TITLE_SCROLL_DELAY);
+    }
+}
+
+/************************************************************************************
+
+   Show the album art of a song above its title
+
+************************************************************************************/
+void UpdateAlbumArt(INT8U songIndex)
+{
+    if (artSong == songIndex) return;
+    artSong = songIndex;
+    AlbumArtShow(lcdCtrl, songData[songIndex], songSizes[songIndex]);
 }
 
 /************************************************************************************
@@ -486,12 +859,28 @@ void UpdateSongName()
 ************************************************************************************/
 void DrawPlayDisplay()
 {
-    char buf[BUFSIZE];
-    lcdCtrl.fillRect(40, 80, 125, 20, ILI9341_BLACK);
-    lcdCtrl.setCursor(40, 80);
-    lcdCtrl.setTextColor(ILI9341_WHITE);  
-    lcdCtrl.setTextSize(2);
-    PrintToLcdWithBuf(buf, BUFSIZE, "playing...");
+    statusLabel.setText("playing...");
+}
+
+/************************************************************************************
+
+   Show the time played as m:ss
+
+************************************************************************************/
+void DrawElapsedTime(INT16U seconds)
+{
+    char text[8];
+    INT16U minutes = seconds / 60;
+    int i = 0;
+
+    if (minutes > 99) minutes = 99;
+    text[i++] = minutes >= 10 ? '0' + minutes / 10 : ' ';
+    text[i++] = '0' + minutes % 10;
+    text[i++] = ':';
+    text[i++] = '0' + (seconds % 60) / 10;
+    text[i++] = '0' + seconds % 10;
+    text[i] = 0;
+    timeLabel.setText(text);
 }
 
 /************************************************************************************
@@ -501,12 +890,7 @@ void DrawPlayDisplay()
 ************************************************************************************/
 void DrawPauseDisplay()
 {
-    char buf[BUFSIZE];
-    lcdCtrl.fillRect(40, 80, 125, 20, ILI9341_BLACK);
-    lcdCtrl.setCursor(40, 80);
-    lcdCtrl.setTextColor(ILI9341_WHITE);  
-    lcdCtrl.setTextSize(2);
-    PrintToLcdWithBuf(buf, BUFSIZE, "paused... ");
+    statusLabel.setText("paused... ");
 }
 
 /************************************************************************************
@@ -516,8 +900,64 @@ void DrawPauseDisplay()
 ************************************************************************************/
 void DrawStartDisplay()
 {
-    lcdCtrl.fillRect(40, 60, 200, 20, ILI9341_BLACK);
-    lcdCtrl.fillRect(40, 80, 125, 20, ILI9341_BLACK);
+    titleTape[0] = titleTape[1] = NO_TITLE;
+    if (!browserShown) {
+        titleScroll.reset();
+        titleScroll.redraw(DrawTitleLines, NULL);
+    }
+    artSong = NO_TITLE;
+    AlbumArtClear(lcdCtrl);
+    statusLabel.setText("");
+    timeLabel.setText("");
+    progressBar.setValue(0);
+}
+
+/************************************************************************************
+
+   Track browser: a row of the list is the 8.3 name from the SD track index
+
+************************************************************************************/
+static BOOLEAN FetchTrackRow(INT32U index, char *text, INT16U size, void *arg)
+{
+    TrackIndexEntry entry;
+
+    if (!TrackIndexGet(index, &entry)) return OS_FALSE;
+    strncpy(text, entry.name, size - 1);
+    text[size - 1] = 0;
+    return OS_TRUE;
+}
+
+void ShowBrowser()
+{
+    char buf[BUFSIZE];
+
+    // Keep the title on show as content line 0 for when the band comes back
+    titleTape[0] = titleTape[(titleScroll.position() / TITLE_ROWS) & 1];
+    titleScroll.end();
+    browserShown = OS_TRUE;
+    TakeBrowseDrag();
+
+    stripCtrl.begin(0, TITLE_TOP, ILI9341_TFTWIDTH, TITLE_ROWS, ILI9341_BLACK);
+    do {
+        stripCtrl.setCursor(40, TITLE_TOP);
+        stripCtrl.setTextColor(ILI9341_YELLOW);
+        stripCtrl.setFont(&dejaVuSansBold16);
+        PrintToLcdWithBuf(buf, BUFSIZE, "%lu tracks", TrackIndexCount());
+        stripCtrl.setFont(NULL);
+    } while (stripCtrl.nextStrip());
+    trackList.begin(BROWSE_TOP, ILI9341_TFTHEIGHT - BROWSE_TOP, ILI9341_BLACK,
+        TrackIndexCount(), FetchTrackRow, NULL);
+}
+
+void HideBrowser()
+{
+    UiRect below = { 0, BROWSE_TOP, ILI9341_TFTWIDTH, ILI9341_TFTHEIGHT - BROWSE_TOP };
+
+    trackList.end();
+    browserShown = OS_FALSE;
+    titleScroll.begin(TITLE_TOP, TITLE_ROWS, ILI9341_BLACK);
+    titleScroll.redraw(DrawTitleLines, NULL);
+    uiScreen.invalidate(below);
 }
 
 /************************************************************************************
@@ -551,46 +991,174 @@ void DisplayTask(void* pdata)
 
 	PrintWithBuf(buf, BUFSIZE, "Initializing LCD controller\n");
     lcdCtrl.setPjdfHandle(hLcd);
+    INT32U initStart = OSTimeGet();
+    Ili9341BusStats initStats;
+    lcdCtrl.resetBusStats();
     lcdCtrl.begin();
+    lcdCtrl.getBusStats(&initStats);
+    PrintWithBuf(buf, BUFSIZE, "LCD init: %lu ms, %lu bytes in %lu transfers\n",
+        (OSTimeGet() - initStart) * 1000 / OS_TICKS_PER_SEC, initStats.bytes, initStats.transfers);
+
+    // Optionally measure full screen fill time (APP_CFG_LCD_BENCH_EN)
+    LcdBench(lcdCtrl, hLcd);
 
     DrawLcdContents();
+    titleScroll.begin(TITLE_TOP, TITLE_ROWS, ILI9341_BLACK);
     
     INT8U err;
-    displayState* pNewDisplay;
-    
-    //int currentSongIndex = 0;
-    bool paused = false;
+    AppMsg* pMsg;
+    OS_CPU_SR cpu_sr = 0u;
+    OS_FLAGS flags, waitFlags;
+    INT16U timeout;
+    displayState newDisplay;
+    INT8U song;
+    INT32U position;
+    INT8U buttons;
+    INT32S lines;
+    BOOLEAN dragging = OS_FALSE;    // the list moved in the last frame
+    BOOLEAN playing = OS_FALSE;     // a song is playing, not paused or stopped
+    BOOLEAN report;
+    INT32U bytes;
+    UiStats uiStats;
+#if APP_CFG_SPECTRUM_EN > 0u
+    SpectrumLevels levels;
+    SpectrumStats spectrumStats;
+    INT32U spectrumSeq = 0;
+    INT32U seq;
+#endif
     
     while(1) {
-        pNewDisplay = (displayState*)OSMboxPend(displayMBox, 0, &err);
-        PrintWithBuf(buf, BUFSIZE, "DisplayTask: unpended! - %d\n", err);
-        switch(*pNewDisplay) {
-        case startDisplay:
-            PrintWithBuf(buf, BUFSIZE, "DisplayTask: update - start!\n");
-            DrawStartDisplay();
-            paused = false;
-            break;
-        case playDisplay:
-            PrintWithBuf(buf, BUFSIZE, "DisplayTask: update - play!\n");
-            if (!paused) UpdateSongName();
-            DrawPlayDisplay();
-            paused = false;
-            break;
-        case pauseDisplay:
-            PrintWithBuf(buf, BUFSIZE, "DisplayTask: update - pause!\n");
-            DrawPauseDisplay();
-            paused = true;
-            break;
+        // Sleep until there is something to show. While the list is being
+        // dragged its drags are taken once a frame, and the spectrum is
+        // polled once a frame while a song plays.
+        waitFlags = DISPLAY_EVT_ALL;
+        timeout = 0;
+        if (dragging) {
+            waitFlags &= ~DISPLAY_EVT_DRAG;
+            timeout = UI_FRAME_TICKS;
+        }
+#if APP_CFG_SPECTRUM_EN > 0u
+        if (playing) timeout = UI_FRAME_TICKS;
+#endif
+        flags = OSFlagPend(displayFlags, waitFlags, OS_FLAG_WAIT_SET_ANY + OS_FLAG_CONSUME, timeout, &err);
+        report = false;
+        
+        // Transitions in the order they were sent, then the latest one if
+        // one could not be queued
+        while ((pMsg = (AppMsg*)OSQAccept(displayQ, &err)) != NULL || (flags & DISPLAY_EVT_LOST)) {
+            if (pMsg != NULL) {
+                newDisplay = (displayState)pMsg->arg;
+                song = (INT8U)pMsg->data;
+                PrintWithBuf(buf, BUFSIZE, "DisplayTask: unpended! - %d, queued %lu ticks\n", err, OSTimeGet() - pMsg->timestamp);
+                AppMsgFree(pMsg);
+            } else {
+                OS_ENTER_CRITICAL();
+                newDisplay = latestDisplay;
+                song = latestSong;
+                OS_EXIT_CRITICAL();
+                flags &= ~DISPLAY_EVT_LOST;
+                PrintWithBuf(buf, BUFSIZE, "DisplayTask: update lost, showing the latest\n");
+            }
+            report = true;
+            playing = (newDisplay == playDisplay || newDisplay == resumeDisplay);
+            TraceUser(TRACE_USER_DISPLAY_BEGIN, newDisplay);
+            switch(newDisplay) {
+            case startDisplay:
+                PrintWithBuf(buf, BUFSIZE, "DisplayTask: update - start!\n");
+                DrawStartDisplay();
+                break;
+            case playDisplay:
+                PrintWithBuf(buf, BUFSIZE, "DisplayTask: update - play!\n");
+                UpdateAlbumArt(song);
+                UpdateSongName(song);
+                DrawPlayDisplay();
+                break;
+            case resumeDisplay:
+                PrintWithBuf(buf, BUFSIZE, "DisplayTask: update - resume!\n");
+                DrawPlayDisplay();
+                break;
+            case pauseDisplay:
+                PrintWithBuf(buf, BUFSIZE, "DisplayTask: update - pause!\n");
+                DrawPauseDisplay();
+                break;
+            default:
+                break;
+            }
+            TraceUser(TRACE_USER_DISPLAY_END, newDisplay);
+        }
+        
+        // Only the bar columns and clock digits that moved are redrawn
+        if (flags & DISPLAY_EVT_POSITION) {
+            OS_ENTER_CRITICAL();
+            position = displayPosition;
+            OS_EXIT_CRITICAL();
+            progressBar.setValue((INT16U)position);
+            DrawElapsedTime((INT16U)(position >> 16));
+        }
+        
+        // A sprite swap, painted by the button as one address window
+        if (flags & DISPLAY_EVT_BUTTONS) {
+            OS_ENTER_CRITICAL();
+            buttons = displayButtons;
+            OS_EXIT_CRITICAL();
+            for (int i = 0; i < NUM_COMMANDS; i++) {
+                commandButtons[i]->setPressed((buttons & (1 << i)) != 0);
+            }
+        }
+        
+        if (flags & DISPLAY_EVT_BROWSE) {
+            if (browseWanted && !browserShown) {
+                ShowBrowser();
+            } else if (!browseWanted && browserShown) {
+                HideBrowser();
+            }
+        }
+        
+#if APP_CFG_SPECTRUM_EN > 0u
+        // Only bars whose levels moved are repainted
+        seq = SpectrumGet(&levels);
+        if (seq != spectrumSeq) {
+            spectrumSeq = seq;
+            spectrumBars.setLevels(levels.level, levels.peak, levels.count);
+            vuMeter.setValue(levels.vu);
+        }
+#endif
+        
+        // The widgets keep their changes while the browser is up and are
+        // repainted when it goes
+        if (browserShown) {
+            lines = TakeBrowseDrag();
+            dragging = (lines != 0);
+            trackList.scrollBy(lines);
+            bytes = 0;
+        } else {
+            dragging = OS_FALSE;
+            bytes = uiScreen.paint();
+        }
+        if (report) {
+            uiScreen.getStats(&uiStats);
+            PrintWithBuf(buf, BUFSIZE, "DisplayTask: painted %lu bytes, most %lu, %lu paints\n",
+                bytes, uiStats.maxBytes, uiStats.paints);
+#if APP_CFG_SPECTRUM_EN > 0u
+            SpectrumGetStats(&spectrumStats);
+            PrintWithBuf(buf, BUFSIZE, "DisplayTask: spectrum %lu loads, %lu reads, %lu deferred, %lu SCI ops, %lu us most, %lu us average\n",
+                spectrumStats.loads, spectrumStats.reads, spectrumStats.deferred, spectrumStats.sciOps, spectrumStats.maxUs,
+                spectrumStats.reads ? spectrumStats.totalUs / spectrumStats.reads : 0);
+#endif
+            AppMsgPrintStats(buf, BUFSIZE);
+            PrintWithBuf(buf, BUFSIZE, "DisplayTask: touch %lu samples, %lu us most, %lu us average, %lu wakeups\n",
+                touchStats.samples, touchStats.maxUs,
+                touchStats.samples ? touchStats.busUs / touchStats.samples : 0, touchStats.wakeups);
         }
-        OSTimeDly(5);
     }
     
 }
 
-// Renders a character at the current cursor position on the LCD
+// Renders a character at the current cursor position of the strip renderer,
+// so call during a stripCtrl pass
 static void PrintCharToLcd(char c)
 {
-    lcdCtrl.write(c);
+    stripCtrl.write(c);
 }
 
 /************************************************************************************
@@ -608,6 +1176,153 @@ void PrintToLcdWithBuf(char *buf, int size, char *format, ...)
 }
 
 
+/************************************************************************************
+
+   Sleeps TouchTask until the panel may have been touched
+
+************************************************************************************/
+static void TouchWait(INT32U lastTouch)
+{
+#if APP_CFG_TOUCH_INT_EN > 0u
+    INT8U err;
+    
+    // Clear the event before sampling the line so that a touch beginning
+    // after the sample still wakes the pend. A line held low with no touch
+    // reported is sampled at the touch rate rather than spun on.
+    OSFlagPost(touchFlags, TOUCH_EVT_INT, OS_FLAG_CLR, &err);
+    if (BspTouchIsActive()) {
+        OSTimeDly(TOUCH_ACTIVE_TICKS);
+    } else {
+        OSFlagPend(touchFlags, TOUCH_EVT_INT, OS_FLAG_WAIT_SET_ANY + OS_FLAG_CONSUME, 0, &err);
+    }
+#else
+    OSTimeDly((OSTimeGet() - lastTouch < TOUCH_IDLE_AFTER) ? TOUCH_ACTIVE_TICKS : TOUCH_IDLE_TICKS);
+#endif
+    touchStats.wakeups++;
+}
+
+/************************************************************************************
+
+   Sends a command to Mp3Task
+
+************************************************************************************/
+static void TouchCommand(char *buf, OS_FLAGS command)
+{
+    INT8U err;
+    
+    OSFlagPost(mp3Flags, command, OS_FLAG_SET, &err);
+    if (err != 0) {
+        PrintWithBuf(buf, BUFSIZE, "error!\n");
+    }
+}
+
+/************************************************************************************
+
+   Acts on a gesture from TouchTask's gesture engine, see Gestures above
+
+************************************************************************************/
+static void TouchGesture(char *buf, const GestureEvent *event)
+{
+    static INT8S pressed = -1;                  // button shown pressed, -1 if none
+    static touchDrag drag = dragNone;
+    static INT16S volume = MP3_VOLUME_DEFAULT;
+    boolean inTitle = event->startY >= TITLE_TOP && event->startY < TITLE_TOP + TITLE_ROWS;
+    boolean inSeek = event->startY >= SEEK_TOP && event->startY < SEEK_BOTTOM;
+    INT32S progress;
+    
+    // A button shown pressed comes up as soon as the touch is anything
+    // but a press
+    if (pressed >= 0 && event->type != GESTURE_DOWN) {
+        PostDisplayButton((commands)pressed, false);
+        pressed = -1;
+    }
+    
+    switch (event->type) {
+    case GESTURE_DOWN:
+        drag = dragNone;
+        if (browseWanted) break;
+        for (int i = 0; i < NUM_COMMANDS; i++) {
+            if (!commandButtons[i]->contains(event->startX, event->startY)) continue;
+            pressed = i;
+            PostDisplayButton((commands)i, true);
+            break;
+        }
+        break;
+        
+    case GESTURE_TAP:
+        if (inTitle) {
+            PostDisplayBrowse(!browseWanted);
+            break;
+        }
+        if (browseWanted) break;
+        for (int i = 0; i < NUM_COMMANDS; i++) {
+            if (!commandButtons[i]->contains(event->startX, event->startY)) continue;
+            TraceUser(TRACE_USER_TOUCH_PRESS, i);
+            TouchCommand(buf, commandFlags[i]);
+            break;
+        }
+        break;
+        
+    case GESTURE_LONG_PRESS:
+        // A button held down is not a long press on the screen
+        if (!browseWanted) {
+            for (int i = 0; i < NUM_COMMANDS; i++) {
+                if (commandButtons[i]->contains(event->startX, event->startY)) return;
+            }
+        }
+        PostDisplayBrowse(!browseWanted);
+        break;
+        
+    case GESTURE_DRAG_START:
+        // What a drag does is settled by where and which way it starts
+        if (browseWanted) {
+            drag = dragScroll;
+        } else if (inSeek) {
+            drag = dragSeek;
+        } else if (abs(event->dy) > abs(event->dx)) {
+            drag = dragVolume;
+        } else {
+            drag = dragSideways;
+        }
+        // fall through, the start has moved too
+    case GESTURE_DRAG:
+        if (drag == dragScroll) {
+            PostBrowseDrag(-event->dy);
+        } else if (drag == dragVolume) {
+            // Up is louder, less attenuation
+            volume += event->dy;
+            if (volume < 0) volume = 0;
+            if (volume > MP3_VOLUME_QUIETEST) volume = MP3_VOLUME_QUIETEST;
+            if (volume != volumeTarget) {
+                volumeTarget = (INT8U)volume;
+                TouchCommand(buf, MP3_CMD_VOLUME);
+            }
+        }
+        break;
+        
+    case GESTURE_SWIPE_LEFT:
+    case GESTURE_SWIPE_RIGHT:
+        if (drag == dragSideways) {
+            TraceUser(TRACE_USER_TOUCH_PRESS, event->type == GESTURE_SWIPE_LEFT ? next : prev);
+            TouchCommand(buf, event->type == GESTURE_SWIPE_LEFT ? MP3_CMD_NEXT : MP3_CMD_PREV);
+            break;
+        }
+        // fall through, a quick drag along the seek band still seeks
+    case GESTURE_DRAG_END:
+        if (drag == dragSeek) {
+            progress = (INT32S)(event->x - PROGRESS_LEFT) * PROGRESS_MAX / PROGRESS_WIDTH;
+            if (progress < 0) progress = 0;
+            if (progress > PROGRESS_MAX - 1) progress = PROGRESS_MAX - 1;
+            seekTarget = (INT16U)progress;
+            TouchCommand(buf, MP3_CMD_SEEK);
+        }
+        break;
+        
+    default:
+        break;
+    }
+}
+
 /************************************************************************************
 
    Touch Task
@@ -628,83 +1343,71 @@ void TouchTask(void* pdata)
         PrintWithBuf(buf, BUFSIZE, "Couldn't start FT6206 touchscreen controller\n");
         while (1);
     }
+    TouchBench(touchCtrl);
     
-    commands currentCommand;
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    
+    Gesture gesture;
+    GestureEvent event;
+    boolean active = false;     // touched at the last sample
+    int16_t x = 0, y = 0;
+    INT32U now, lastTouch = 0;
+    FT6206Sample sample;
+    
+#if APP_CFG_TOUCH_INT_EN > 0u
     INT8U err;
+    touchFlags = OSFlagCreate(0, &err);
+    if (err != OS_ERR_NONE) while(1);
+    OSFlagNameSet(touchFlags, (INT8U*)"touchFlags", &err);
+    BspTouchIntEnable(touchFlags, TOUCH_EVT_INT);
+#endif
+    GestureInit(&gesture);
 
     while (1) { 
         boolean touched = false;
         
-        // TODO: Poll for a touch on the touch panel
-        // <Your code here>
-        // <hint: Call a function provided by touchCtrl
-        touched = touchCtrl.touched();
-        if (! touched) {
-            playButton.press(false);
-            stopButton.press(false);
-            nextButton.press(false);
-            prevButton.press(false);
-            OSTimeDly(5);
-            continue;
+        // Follow a touch at the sampling rate until the gesture engine has
+        // seen it end, otherwise wait for one
+        if (active || GestureIsActive(&gesture)) {
+            OSTimeDly(TOUCH_ACTIVE_TICKS);
+        } else {
+            TouchWait(lastTouch);
         }
         
-        TS_Point rawPoint;
-       
-        // TODO: Retrieve a point  
-        // <Your code here>
-        rawPoint = touchCtrl.getPoint();
-
-        if (rawPoint.x == 0 && rawPoint.y == 0)
-        {
-            continue; // usually spurious, so ignore
-        }
+        // Read the touch count and points in one I2C burst
+        INT32U start = DWT->CYCCNT;
+        touched = touchCtrl.readSample(&sample);
+        INT32U us = (DWT->CYCCNT - start) / (SystemCoreClock / 1000000);
+        touchStats.samples++;
+        touchStats.busUs += us;
+        if (us > touchStats.maxUs) touchStats.maxUs = us;
+        active = touched;
+        now = OSTimeGet();
         
-        if (playButton.contains(ILI9341_TFTWIDTH - rawPoint.x, ILI9341_TFTHEIGHT - rawPoint.y) && !playButton.isPressed()){
-            playButton.press(true);
-            currentCommand = play;
-            err = OSQPost(commandMsgQ, (void*)&currentCommand);
-            if (err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "error!\n");
-            } else {
-                OSTimeDly(5);
-            }
-            continue;
-        }
-        
-        if (stopButton.contains(ILI9341_TFTWIDTH - rawPoint.x, ILI9341_TFTHEIGHT - rawPoint.y) && !stopButton.isPressed()){
-            stopButton.press(true);
-            currentCommand = stop;
-            err = OSQPost(commandMsgQ, (void*)&currentCommand);
-            if (err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "error!\n");
-            } else {
-                OSTimeDly(5);
+        if (touched) {
+            lastTouch = now;
+            const FT6206Point *rawPoint = &sample.point[0];
+            if (rawPoint->x == 0 && rawPoint->y == 0)
+            {
+                continue; // usually spurious, so ignore
             }
-            continue; 
+            x = ILI9341_TFTWIDTH - rawPoint->x;
+            y = ILI9341_TFTHEIGHT - rawPoint->y;
         }
         
-        if (nextButton.contains(ILI9341_TFTWIDTH - rawPoint.x, ILI9341_TFTHEIGHT - rawPoint.y) && !nextButton.isPressed()){
-            nextButton.press(true);
-            currentCommand = next;
-            err = OSQPost(commandMsgQ, (void*)&currentCommand);
-            if (err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "error!\n");
-            } else {
-                OSTimeDly(5);
-            }
-            continue;
+#if APP_CFG_TOUCH_LOG_EN > 0u
+        // Samples in the format Tools/gestureReplay reads
+        if (touched) {
+            PrintWithBuf(buf, BUFSIZE, "TOUCH %lu %d %d\n", now, x, y);
+        } else {
+            PrintWithBuf(buf, BUFSIZE, "TOUCH %lu -\n", now);
         }
+#endif
         
-        if (prevButton.contains(ILI9341_TFTWIDTH - rawPoint.x, ILI9341_TFTHEIGHT - rawPoint.y) && !prevButton.isPressed()){
-            prevButton.press(true);
-            currentCommand = prev;
-            err = OSQPost(commandMsgQ, (void*)&currentCommand);
-            if (err != 0) {
-                PrintWithBuf(buf, BUFSIZE, "error!\n");
-            } else {
-                OSTimeDly(5);
-            }
-            continue;
+        if (GestureUpdate(&gesture, now, touched, x, y, &event)) {
+            TraceUser(TRACE_USER_GESTURE, event.type);
+            TouchGesture(buf, &event);
         }
     }
 }
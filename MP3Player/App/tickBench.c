@@ -0,0 +1,94 @@
+/*
+    tickBench.c
+    Startup microbenchmark of the uCOS-II tick handler.
+
+    Creates a growing number of long-delayed tasks and times OSTimeTick()
+    with the DWT cycle counter after each one. Without OS_TICK_LIST_EN the
+    cost grows with every TCB in OSTCBList; with the delta list it stays flat
+    because none of the delays expire. Build with OS_TICK_LIST_EN set to 0
+    and to 1 and compare the printed tables.
+
+    Enable with APP_CFG_TICK_BENCH_EN in app_cfg.h. Each measured call to
+    OSTimeTick() advances OSTime by one tick.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "print.h"
+#include "tickBench.h"
+
+#if APP_CFG_TICK_BENCH_EN > 0u
+
+#define TICK_BENCH_MAX_TASKS    12      // number of delayed tasks to add
+#define TICK_BENCH_FIRST_PRIO   10      // first of TICK_BENCH_MAX_TASKS priorities unused by the application
+#define TICK_BENCH_STK_SIZE     128
+#define TICK_BENCH_SAMPLES      200     // OSTimeTick() calls timed per task count
+#define TICK_BENCH_DELAY        60000   // ticks; long enough not to expire during the benchmark
+
+static OS_STK tickBenchStk[TICK_BENCH_MAX_TASKS][TICK_BENCH_STK_SIZE];
+
+// Parks in a long delay so that its TCB is on the tick's work list
+static void TickBenchTask(void* pdata)
+{
+    while (1)
+    {
+        OSTimeDly(TICK_BENCH_DELAY);
+    }
+}
+
+// Times TICK_BENCH_SAMPLES calls to OSTimeTick() and prints the result
+static void TickBenchMeasure(char *buf, int nTasks)
+{
+    INT32U start;
+    INT32U cycles;
+    INT32U minCycles = 0xFFFFFFFF;
+    INT32U maxCycles = 0;
+    INT32U sumCycles = 0;
+
+    for (int i = 0; i < TICK_BENCH_SAMPLES; i++)
+    {
+        start = DWT->CYCCNT;
+        OSTimeTick();
+        cycles = DWT->CYCCNT - start;
+
+        if (cycles < minCycles) minCycles = cycles;
+        if (cycles > maxCycles) maxCycles = cycles;
+        sumCycles += cycles;
+    }
+
+    PrintWithBuf(buf, PRINTBUFMAX, "TickBench: %2d delayed tasks: min %4lu avg %4lu max %4lu cycles\n",
+        nTasks, minCycles, sumCycles / TICK_BENCH_SAMPLES, maxCycles);
+}
+
+// TickBench
+// Prints the cost of OSTimeTick() for 0 to TICK_BENCH_MAX_TASKS delayed tasks
+// then deletes the benchmark tasks. Call from the startup task after the
+// tick has been started and before the application tasks are created.
+void TickBench(void)
+{
+    char buf[PRINTBUFMAX];
+    INT8U err;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    PrintWithBuf(buf, PRINTBUFMAX, "TickBench: OS_TICK_LIST_EN = %d\n", OS_TICK_LIST_EN);
+    TickBenchMeasure(buf, 0);
+
+    for (int i = 0; i < TICK_BENCH_MAX_TASKS; i++)
+    {
+        err = OSTaskCreate(TickBenchTask, (void*)0, &tickBenchStk[i][TICK_BENCH_STK_SIZE-1], TICK_BENCH_FIRST_PRIO + i);
+        if (err != OS_ERR_NONE) while (1);
+
+        OSTimeDly(1); // let the new task run and enter its delay
+        TickBenchMeasure(buf, i + 1);
+    }
+
+    for (int i = 0; i < TICK_BENCH_MAX_TASKS; i++)
+    {
+        OSTaskDel(TICK_BENCH_FIRST_PRIO + i);
+    }
+}
+
+#endif // APP_CFG_TICK_BENCH_EN
@@ -0,0 +1,19 @@
+/*
+    tickBench.h
+    Startup microbenchmark of the uCOS-II tick handler.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __TICKBENCH_H__
+#define __TICKBENCH_H__
+
+#include <app_cfg.h>
+
+#if APP_CFG_TICK_BENCH_EN > 0u
+void TickBench(void);
+#else
+#define TickBench()
+#endif
+
+#endif /* __TICKBENCH_H__ */
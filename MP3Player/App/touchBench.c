@@ -0,0 +1,88 @@
+/*
+    touchBench.c
+    Startup benchmark of the I2C bus time of a touch sample.
+
+    Times the two ways of reading a sample from the FT6206:
+      touched+getPoint - the touch count register, then the 16 registers
+                         holding the first point: two pointer writes and
+                         two reads
+      readSample       - count, both points, event flags and weights in a
+                         single 15 byte burst: one pointer write, one read
+
+    The bus transfers busy-wait in bspI2c.c with interrupts disabled, so the
+    times are the CPU time and the interrupt latency each sample costs. They
+    do not depend on whether the panel is touched.
+
+    Enable with APP_CFG_TOUCH_BENCH_EN in app_cfg.h. Call from the touch task
+    after touch.begin().
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "print.h"
+#include "touchBench.h"
+
+#if APP_CFG_TOUCH_BENCH_EN > 0u
+
+#define TOUCH_BENCH_SAMPLES     50      // samples timed each way
+
+typedef enum
+{
+    TOUCH_BENCH_SPLIT,
+    TOUCH_BENCH_BURST
+} TouchBenchMethod;
+
+// Times TOUCH_BENCH_SAMPLES samples read one way and prints the result
+static void TouchBenchMeasure(char *buf, Adafruit_FT6206 &touch, TouchBenchMethod method)
+{
+    FT6206Sample sample;
+    INT32U start;
+    INT32U cycles;
+    INT32U minCycles = 0xFFFFFFFF;
+    INT32U maxCycles = 0;
+    INT32U sumCycles = 0;
+    INT32U perUs = SystemCoreClock / 1000000;
+
+    for (int i = 0; i < TOUCH_BENCH_SAMPLES; i++)
+    {
+        OSTimeDly(1);   // start each sample on a fresh tick, as TouchTask does
+
+        start = DWT->CYCCNT;
+        if (method == TOUCH_BENCH_SPLIT)
+        {
+            touch.touched();
+            touch.getPoint();
+        }
+        else
+        {
+            touch.readSample(&sample);
+        }
+        cycles = DWT->CYCCNT - start;
+
+        if (cycles < minCycles) minCycles = cycles;
+        if (cycles > maxCycles) maxCycles = cycles;
+        sumCycles += cycles;
+    }
+
+    PrintWithBuf(buf, PRINTBUFMAX, "TouchBench: %-16s min %4lu avg %4lu max %4lu us per sample\n",
+        method == TOUCH_BENCH_SPLIT ? "touched+getPoint" : "readSample",
+        minCycles / perUs, sumCycles / TOUCH_BENCH_SAMPLES / perUs, maxCycles / perUs);
+}
+
+// TouchBench
+// Prints the bus time of a touch sample read as two transactions and as
+// one burst.
+// touch: a touch controller that has been begun
+void TouchBench(Adafruit_FT6206 &touch)
+{
+    char buf[PRINTBUFMAX];
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    TouchBenchMeasure(buf, touch, TOUCH_BENCH_SPLIT);
+    TouchBenchMeasure(buf, touch, TOUCH_BENCH_BURST);
+}
+
+#endif // APP_CFG_TOUCH_BENCH_EN
@@ -0,0 +1,20 @@
+/*
+    touchBench.h
+    Startup benchmark of the I2C bus time of a touch sample.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __TOUCHBENCH_H__
+#define __TOUCHBENCH_H__
+
+#include <app_cfg.h>
+
+#if APP_CFG_TOUCH_BENCH_EN > 0u
+#include <Adafruit_FT6206.h>
+void TouchBench(Adafruit_FT6206 &touch);
+#else
+#define TouchBench(touch)
+#endif
+
+#endif /* __TOUCHBENCH_H__ */
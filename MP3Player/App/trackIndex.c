@@ -0,0 +1,182 @@
+/*
+    trackIndex.c
+    An index of the MP3 files on the SD card, see trackIndex.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "print.h"
+#include "SD.h"
+#include "trackIndex.h"
+
+#define TRACK_INDEX_MAGIC   0x58444954      // "TIDX"
+
+// First record of the index file: the root directory it was listed from
+typedef struct
+{
+    INT32U magic;                   // TRACK_INDEX_MAGIC once the index is complete
+    INT32U count;                   // MP3 files in the root
+    INT32U bytes;                   // sum of their sizes
+    INT8U reserved[8];
+} TrackIndexHeader;
+
+static File indexFile;      // open for reading once the index exists
+static INT32U trackCount;
+
+// True if name ends in .MP3, in any case
+static BOOLEAN IsMp3Name(const char *name)
+{
+    const char *ext = strrchr(name, '.');
+    if (ext == NULL) return OS_FALSE;
+    return (ext[1] == 'M' || ext[1] == 'm') && (ext[2] == 'P' || ext[2] == 'p') &&
+        ext[3] == '3' && ext[4] == 0;
+}
+
+// Counts the MP3 files in the root directory and sums their sizes into
+// header, the way TrackIndexBuild() records them
+static void TrackIndexScan(TrackIndexHeader *header)
+{
+    memset(header, 0, sizeof(TrackIndexHeader));
+    header->magic = TRACK_INDEX_MAGIC;
+
+    File root = SD.open("/");
+    if (root) root.rewindDirectory();
+    while (root)
+    {
+        File file = root.openNextFile();
+        if (!file) break;
+        if (!file.isDirectory() && IsMp3Name(file.name()))
+        {
+            header->count++;
+            header->bytes += file.size();
+        }
+        file.close();
+    }
+    if (root) root.close();
+}
+
+// True if the open index is complete and was listed from a root directory
+// that matches card
+static BOOLEAN TrackIndexIsCurrent(const TrackIndexHeader *card)
+{
+    TrackIndexHeader header;
+
+    if (indexFile.read(&header, sizeof(header)) != sizeof(header)) return OS_FALSE;
+    return header.magic == TRACK_INDEX_MAGIC && header.count == card->count &&
+        header.bytes == card->bytes &&
+        indexFile.size() == sizeof(header) + header.count * sizeof(TrackIndexEntry);
+}
+
+// Lists the root directory into a new index file, returns the tracks found.
+// The header is written last and only marked complete if every entry was,
+// so an index cut short is listed again at the next startup.
+static INT32U TrackIndexBuild(void)
+{
+    TrackIndexHeader header;
+    TrackIndexEntry entry;
+    INT32U count = 0;
+    BOOLEAN complete = OS_TRUE;
+
+    SD.remove((char*)TRACK_INDEX_FILE);
+    File out = SD.open(TRACK_INDEX_FILE, FILE_WRITE);
+    if (!out) return 0;
+
+    memset(&header, 0, sizeof(header));
+    if (out.write((const uint8_t*)&header, sizeof(header)) != sizeof(header))
+    {
+        out.close();
+        return 0;
+    }
+
+    File root = SD.open("/");
+    if (root) root.rewindDirectory();
+    while (root)
+    {
+        File file = root.openNextFile();
+        if (!file) break;
+        if (!file.isDirectory() && IsMp3Name(file.name()))
+        {
+            memset(&entry, 0, sizeof(entry));
+            strncpy(entry.name, file.name(), TRACK_NAME_MAX - 1);
+            entry.size = file.size();
+            if (out.write((const uint8_t*)&entry, sizeof(entry)) != sizeof(entry))
+            {
+                complete = OS_FALSE;
+                file.close();
+                break;
+            }
+            header.count++;
+            header.bytes += entry.size;
+        }
+        file.close();
+    }
+    if (root) root.close();
+
+    if (complete) header.magic = TRACK_INDEX_MAGIC;
+    if (out.seek(0) && out.write((const uint8_t*)&header, sizeof(header)) == sizeof(header))
+    {
+        count = header.count;
+    }
+    out.close();
+    return count;
+}
+
+// TrackIndexOpen
+// Opens the index, building it first if it is missing, out of date with
+// the root directory or rebuild is set.
+// rebuild: OS_TRUE to list the card again
+// Returns: the number of tracks, 0 if there is no index
+INT32U TrackIndexOpen(BOOLEAN rebuild)
+{
+    char buf[PRINTBUFMAX];
+    TrackIndexHeader card;
+    INT32U start = OSTimeGet();
+
+    if (indexFile) indexFile.close();
+    trackCount = 0;
+
+    if (!rebuild)
+    {
+        TrackIndexScan(&card);
+        indexFile = SD.open(TRACK_INDEX_FILE, FILE_READ);
+        if (indexFile && TrackIndexIsCurrent(&card))
+        {
+            trackCount = card.count;
+            PrintWithBuf(buf, PRINTBUFMAX, "TrackIndex: %lu tracks, checked in %lu ms\n",
+                trackCount, (OSTimeGet() - start) * 1000 / OS_TICKS_PER_SEC);
+            return trackCount;
+        }
+        if (indexFile) indexFile.close();
+    }
+
+    INT32U count = TrackIndexBuild();
+    PrintWithBuf(buf, PRINTBUFMAX, "TrackIndex: listed %lu tracks in %lu ms\n",
+        count, (OSTimeGet() - start) * 1000 / OS_TICKS_PER_SEC);
+
+    indexFile = SD.open(TRACK_INDEX_FILE, FILE_READ);
+    if (!indexFile) return 0;
+    trackCount = count;
+    return trackCount;
+}
+
+// TrackIndexCount
+// Returns: the number of tracks in the open index
+INT32U TrackIndexCount(void)
+{
+    return trackCount;
+}
+
+// TrackIndexGet
+// Reads one entry of the index.
+// index: 0 to TrackIndexCount() - 1
+// entry: receives the entry
+// Returns: OS_TRUE if it was read
+BOOLEAN TrackIndexGet(INT32U index, TrackIndexEntry *entry)
+{
+    if (index >= trackCount || !indexFile) return OS_FALSE;
+    if (!indexFile.seek(sizeof(TrackIndexHeader) + index * sizeof(TrackIndexEntry))) return OS_FALSE;
+    if (indexFile.read(entry, sizeof(TrackIndexEntry)) != sizeof(TrackIndexEntry)) return OS_FALSE;
+    entry->name[TRACK_NAME_MAX - 1] = 0;
+    return OS_TRUE;
+}
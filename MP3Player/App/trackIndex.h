@@ -0,0 +1,45 @@
+/*
+    trackIndex.h
+    An index of the MP3 files on the SD card, kept on the card.
+
+    Listing a directory of FAT entries means reading it from the start, so
+    the library is listed once into TRACK_INDEX_FILE, a file of fixed size
+    records, and row n of the track list is then one seek and one read
+    however large the library is.
+
+    The file starts with a header giving the number of MP3 files the root
+    directory held when it was listed and the sum of their sizes. At
+    startup TrackIndexOpen() lists the root again to compare them, which
+    only reads directory entries, and rebuilds the index if it is missing
+    or files were added, removed or replaced; TrackIndexOpen(OS_TRUE)
+    rebuilds it regardless.
+
+    Only MP3 files in the root directory are indexed, by their 8.3 names,
+    the only names the SD library knows.
+
+    Call TrackIndexOpen() after SD.begin(), and the other functions from
+    one task at a time: the SD library is not reentrant.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __TRACKINDEX_H__
+#define __TRACKINDEX_H__
+
+#include "bsp.h"
+
+#define TRACK_INDEX_FILE    "TRACKS.IDX"
+#define TRACK_NAME_MAX      13      // 8.3 name and terminator
+
+typedef struct
+{
+    char name[TRACK_NAME_MAX];
+    INT8U reserved[3];
+    INT32U size;                    // bytes
+} TrackIndexEntry;
+
+INT32U TrackIndexOpen(BOOLEAN rebuild);
+INT32U TrackIndexCount(void);
+BOOLEAN TrackIndexGet(INT32U index, TrackIndexEntry *entry);
+
+#endif /* __TRACKINDEX_H__ */
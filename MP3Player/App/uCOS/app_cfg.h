@@ -46,6 +46,13 @@
 */
 
 #define  APP_CFG_SERIAL_EN                      DEF_ENABLED
+#define  APP_CFG_TICK_BENCH_EN                  0u          /* Measure OSTimeTick() cost at startup (tickBench.c) */
+#define  APP_CFG_LCD_BENCH_EN                   0u          /* Measure LCD fill, text and shape cost at startup (lcdBench.c) */
+#define  APP_CFG_PIXEL_BENCH_EN                 0u          /* Measure pixel kernel cost at startup (pixelBench.c) */
+#define  APP_CFG_TOUCH_BENCH_EN                 0u          /* Measure the I2C time of a touch sample at startup (touchBench.c) */
+#define  APP_CFG_SPECTRUM_EN                    0u          /* Spectrum bars and VU meter, empty until VLSI's plugin replaces spectrumPlugin.plg (spectrum.c) */
+#define  APP_CFG_TOUCH_INT_EN                   1u          /* FT6206 INT on D2 (PA10) wakes TouchTask, 0 polls the panel instead (bspLcd.h) */
+#define  APP_CFG_TOUCH_LOG_EN                   0u          /* Print each touch sample for Tools/gestureReplay (gesture.h) */
 
 
 /*
@@ -37,6 +37,7 @@
 */
 
 #include  <ucos_ii.h>
+#include  <trace.h>
 //#include  <stm32f4xx_hal.h>
 
 
@@ -152,6 +153,7 @@ void  App_TaskDelHook (OS_TCB *ptcb)
 #if OS_VERSION >= 251
 void  App_TaskIdleHook (void)
 {
+    TracePollUart();                                            /* Dump the trace buffer when requested on the UART     */
 }
 #endif
 
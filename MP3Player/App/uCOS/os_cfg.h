@@ -49,9 +49,14 @@
 
 #define OS_TICK_STEP_EN           1u   /* Enable tick stepping feature for uC/OS-View                  */
 #define OS_TICKS_PER_SEC       1000u   /* Set the number of ticks in one second                        */
+#define OS_TICK_LIST_EN           1u   /* Keep delayed tasks in a delta list for OSTimeTick()          */
+#define OS_TICKLESS_EN            1u   /* Idle hook stops the tick until the next delay expires        */
+                                       /* ... requires OS_TICK_LIST_EN, skews the stat task CPU usage  */
 
 #define OS_TLS_TBL_SIZE           0u   /* Size of Thread-Local Storage Table                           */
 
+#define OS_TRACE_EN               1u   /* Record kernel events in the trace ring buffer (Util/trace.c) */
+
 
                                        /* --------------------- TASK STACK SIZE ---------------------- */
 #define OS_TASK_TMR_STK_SIZE    128u   /* Timer      task stack size (# of OS_STK wide entries)        */
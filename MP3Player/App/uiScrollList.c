@@ -0,0 +1,133 @@
+/*
+    uiScrollList.c
+    A list of any length shown in the panel's hardware scroll band, see
+    uiScrollList.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "uiScrollList.h"
+
+#define UI_SCROLL_LIST_MARGIN   4   // pixels left of and above the text of a row
+
+UiScrollList::UiScrollList(Adafruit_ILI9341_Scroll *scroll, int16_t rowHeight,
+    uint16_t color, const RunFont *font)
+{
+    this->scroll = scroll;
+    this->rowHeight = rowHeight > 0 ? rowHeight : 1;
+    this->color = color;
+    this->font = font;
+    fetch = NULL;
+    fetchArg = NULL;
+    count = 0;
+    top = height = 0;
+    memset(rowIndex, 0, sizeof(rowIndex));
+    memset(&stats, 0, sizeof(stats));
+}
+
+// Show count rows in screen rows top to top+height-1, from the first.
+// The band is cut down if more rows would be in view than are cached.
+void UiScrollList::begin(int16_t top, int16_t height, uint16_t bg, INT32U count,
+    UiRowFetchFn fetch, void *arg)
+{
+    if (height > (UI_SCROLL_LIST_ROWS - 1) * rowHeight) height = (UI_SCROLL_LIST_ROWS - 1) * rowHeight;
+
+    this->top = top;
+    this->height = height;
+    this->count = count;
+    this->fetch = fetch;
+    fetchArg = arg;
+    memset(rowIndex, 0, sizeof(rowIndex));
+
+    scroll->begin(top, height, bg);
+    fetchRows(0, height);
+    scroll->redraw(drawLines, this);
+    stats.lines += height;
+}
+
+// Give the scroll band back
+void UiScrollList::end(void)
+{
+    scroll->end();
+    height = 0;
+}
+
+// Move lines pixel rows down the list, up if negative, stopping at either
+// end. Only the rows coming into view are fetched and drawn.
+void UiScrollList::scrollBy(int32_t lines)
+{
+    if (height == 0) return;
+
+    int32_t pos = scroll->position();
+    int32_t last = (int32_t)count * rowHeight - height;
+    int32_t to = pos + lines;
+    if (to > last) to = last;
+    if (to < 0) to = 0;
+    lines = to - pos;
+    if (lines == 0) return;
+
+    if (lines >= height || lines <= -height) fetchRows(to, height);
+    else if (lines > 0) fetchRows(pos + height, lines);
+    else fetchRows(to, -lines);
+
+    scroll->scroll(lines, drawLines, this);
+    stats.lines += (lines >= height || lines <= -height) ? height : (lines > 0 ? lines : -lines);
+}
+
+// Row under screen row y, or -1 if none
+int32_t UiScrollList::itemAt(int16_t y) const
+{
+    if (height == 0 || y < top || y >= top + height) return -1;
+    int32_t row = (scroll->position() + y - top) / rowHeight;
+    return row < (int32_t)count ? row : -1;
+}
+
+INT32U UiScrollList::getCount(void) const
+{
+    return count;
+}
+
+void UiScrollList::getStats(UiScrollListStats *stats) const
+{
+    *stats = this->stats;
+}
+
+// Make sure the rows covering count lines from firstLine are cached
+void UiScrollList::fetchRows(int32_t firstLine, int32_t count)
+{
+    for (int32_t row = firstLine / rowHeight; row * rowHeight < firstLine + count && row < (int32_t)this->count; row++)
+    {
+        INT8U slot = row % UI_SCROLL_LIST_ROWS;
+        if (rowIndex[slot] == (INT32U)row + 1)
+        {
+            stats.hits++;
+            continue;
+        }
+        if (fetch == NULL || !fetch(row, rows[slot], UI_SCROLL_LIST_TEXT, fetchArg)) rows[slot][0] = 0;
+        rows[slot][UI_SCROLL_LIST_TEXT - 1] = 0;
+        rowIndex[slot] = row + 1;
+        stats.fetches++;
+    }
+}
+
+// ScrollDrawFn for the band: draws the cached rows over the lines asked for
+void UiScrollList::drawLines(Adafruit_GFX *gfx, int16_t y, int32_t firstLine, int16_t count, void *arg)
+{
+    UiScrollList *list = (UiScrollList*)arg;
+
+    gfx->setTextColor(list->color);
+    gfx->setTextSize(1);
+    gfx->setTextWrap(false);
+    gfx->setFont(list->font);
+    for (int32_t row = firstLine / list->rowHeight; row * list->rowHeight < firstLine + count && row < (int32_t)list->count; row++)
+    {
+        INT8U slot = row % UI_SCROLL_LIST_ROWS;
+        if (list->rowIndex[slot] != (INT32U)row + 1) continue;
+
+        gfx->setCursor(UI_SCROLL_LIST_MARGIN, y + (int16_t)(row * list->rowHeight - firstLine) + UI_SCROLL_LIST_MARGIN);
+        for (const char *p = list->rows[slot]; *p != 0; p++) gfx->write(*p);
+    }
+    gfx->setFont(NULL);
+    gfx->setTextWrap(true);
+}
@@ -0,0 +1,71 @@
+/*
+    uiScrollList.h
+    A list of any length shown in the panel's hardware scroll band.
+
+    The rows are not held by the list: it asks a fetch function for the
+    text of a row when the row comes into view and keeps only the rows on
+    screen, in a small cache indexed by row number. Scrolling moves the
+    band with Adafruit_ILI9341_Scroll and draws just the lines that come
+    into view, so its cost depends on how far the list moves and not on
+    how long it is.
+
+    Rows are fetched before any drawing starts, so a fetch function may
+    use the SPI bus, to read an index from the SD card say.
+
+    The list owns the scroll band between begin() and end(); the title
+    band, which uses the same hardware, must be ended first.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __UISCROLLLIST_H__
+#define __UISCROLLLIST_H__
+
+#include <Adafruit_ILI9341_Scroll.h>
+
+#define UI_SCROLL_LIST_ROWS     16      // rows cached, more than fit in the band
+#define UI_SCROLL_LIST_TEXT     32      // characters in a row, including the terminator
+
+// Copies the text of row index, at most size characters with the
+// terminator, to text. Returns OS_FALSE if the row can't be read.
+typedef BOOLEAN (*UiRowFetchFn)(INT32U index, char *text, INT16U size, void *arg);
+
+typedef struct
+{
+    INT32U fetches;     // rows read through the fetch function
+    INT32U hits;        // rows that came into view already cached
+    INT32U lines;       // panel lines drawn
+} UiScrollListStats;
+
+class UiScrollList
+{
+public:
+    UiScrollList(Adafruit_ILI9341_Scroll *scroll, int16_t rowHeight, uint16_t color,
+        const RunFont *font);
+
+    void begin(int16_t top, int16_t height, uint16_t bg, INT32U count,
+        UiRowFetchFn fetch, void *arg);
+    void end(void);
+    void scrollBy(int32_t lines);
+    int32_t itemAt(int16_t y) const;
+    INT32U getCount(void) const;
+    void getStats(UiScrollListStats *stats) const;
+
+private:
+    static void drawLines(Adafruit_GFX *gfx, int16_t y, int32_t firstLine, int16_t count, void *arg);
+    void fetchRows(int32_t firstLine, int32_t count);
+
+    Adafruit_ILI9341_Scroll *scroll;
+    UiRowFetchFn fetch;
+    void *fetchArg;
+    INT32U count;
+    int16_t top, height;
+    int16_t rowHeight;
+    uint16_t color;
+    const RunFont *font;
+    char rows[UI_SCROLL_LIST_ROWS][UI_SCROLL_LIST_TEXT];
+    INT32U rowIndex[UI_SCROLL_LIST_ROWS];   // row number cached in each slot, plus 1, 0 if none
+    UiScrollListStats stats;
+};
+
+#endif /* __UISCROLLLIST_H__ */
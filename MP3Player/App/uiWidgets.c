@@ -0,0 +1,507 @@
+/*
+    uiWidgets.c
+    Retained mode widgets for the LCD, see uiWidgets.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "uiWidgets.h"
+
+static INT32U UiRectArea(const UiRect &r)
+{
+    return (INT32U)r.w * r.h;
+}
+
+static UiRect UiRectUnion(const UiRect &a, const UiRect &b)
+{
+    UiRect u;
+    int16_t right = (a.x + a.w > b.x + b.w) ? a.x + a.w : b.x + b.w;
+    int16_t bottom = (a.y + a.h > b.y + b.h) ? a.y + a.h : b.y + b.h;
+
+    u.x = a.x < b.x ? a.x : b.x;
+    u.y = a.y < b.y ? a.y : b.y;
+    u.w = right - u.x;
+    u.h = bottom - u.y;
+    return u;
+}
+
+static boolean UiRectIntersects(const UiRect &a, const UiRect &b)
+{
+    return (a.x < b.x + b.w) && (b.x < a.x + a.w) && (a.y < b.y + b.h) && (b.y < a.y + a.h);
+}
+
+// True if b lies wholly within a
+static boolean UiRectContains(const UiRect &a, const UiRect &b)
+{
+    return (b.x >= a.x) && (b.y >= a.y) && (b.x + b.w <= a.x + a.w) && (b.y + b.h <= a.y + a.h);
+}
+
+// Pixels drawn twice or needlessly if a and b are painted as their union.
+// Negative when they overlap by more than the union adds.
+static int32_t UiRectMergeCost(const UiRect &a, const UiRect &b)
+{
+    return (int32_t)UiRectArea(UiRectUnion(a, b)) - (int32_t)UiRectArea(a) - (int32_t)UiRectArea(b);
+}
+
+
+/************************************************************************************
+
+   UiWidget
+
+************************************************************************************/
+
+UiWidget::UiWidget(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    rect.x = x;
+    rect.y = y;
+    rect.w = w;
+    rect.h = h;
+    screen = NULL;
+    next = NULL;
+}
+
+// True if the screen point x,y is on the widget
+boolean UiWidget::contains(int16_t x, int16_t y) const
+{
+    return (x >= rect.x) && (x < rect.x + rect.w) && (y >= rect.y) && (y < rect.y + rect.h);
+}
+
+// Widgets may leave pixels to the background unless they say otherwise
+boolean UiWidget::opaque(void) const
+{
+    return false;
+}
+
+// Mark the whole widget for redrawing
+void UiWidget::invalidate(void)
+{
+    if (screen != NULL) screen->invalidate(rect);
+}
+
+// Mark part of the widget for redrawing, in screen coordinates
+void UiWidget::invalidate(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    UiRect r = { x, y, w, h };
+    if (screen != NULL) screen->invalidate(r);
+}
+
+
+/************************************************************************************
+
+   UiScreen
+
+************************************************************************************/
+
+// lcd: the LCD the strip renderer draws to, for the bus byte counts
+// bg: the color behind the widgets
+UiScreen::UiScreen(Adafruit_ILI9341 *lcd, Adafruit_ILI9341_Strip *strip, uint16_t bg)
+{
+    this->lcd = lcd;
+    this->strip = strip;
+    widgets = NULL;
+    bgColor = bg;
+    nDirty = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+// Add a widget, drawn over the widgets added before it. The new widget is
+// marked dirty.
+void UiScreen::add(UiWidget *widget)
+{
+    UiWidget **pp = &widgets;
+    while (*pp != NULL) pp = &(*pp)->next;
+    *pp = widget;
+    widget->next = NULL;
+    widget->screen = this;
+    widget->invalidate();
+}
+
+// Mark a rectangle of the screen for redrawing. It is merged with a
+// rectangle already dirty if that costs at most UI_MERGE_SLACK pixels;
+// once UI_MAX_DIRTY rectangles are dirty it is merged with the one that
+// grows least.
+void UiScreen::invalidate(const UiRect &r)
+{
+    UiRect c = r;
+    int16_t width = lcd->width();
+    int16_t height = lcd->height();
+
+    if (c.x < 0) { c.w += c.x; c.x = 0; }
+    if (c.y < 0) { c.h += c.y; c.y = 0; }
+    if (c.x + c.w > width) c.w = width - c.x;
+    if (c.y + c.h > height) c.h = height - c.y;
+    if (c.w <= 0 || c.h <= 0) return;
+
+    INT8U best = 0;
+    int32_t bestCost = 0x7FFFFFFF;
+    for (INT8U i = 0; i < nDirty; i++)
+    {
+        int32_t cost = UiRectMergeCost(dirty[i], c);
+        if (cost < bestCost)
+        {
+            bestCost = cost;
+            best = i;
+        }
+    }
+
+    if (nDirty > 0 && (bestCost <= UI_MERGE_SLACK || nDirty == UI_MAX_DIRTY))
+    {
+        dirty[best] = UiRectUnion(dirty[best], c);
+
+        // The grown rectangle may now be worth merging with another
+        for (INT8U i = 0; i < nDirty; i++)
+        {
+            if (i != best && UiRectMergeCost(dirty[i], dirty[best]) <= UI_MERGE_SLACK)
+            {
+                dirty[best] = UiRectUnion(dirty[best], dirty[i]);
+                dirty[i] = dirty[--nDirty];
+                if (best == nDirty) best = i;
+                i = (INT8U)-1; // start over, the list changed
+            }
+        }
+        return;
+    }
+
+    dirty[nDirty++] = c;
+}
+
+// Mark the whole screen for redrawing
+void UiScreen::invalidateAll(void)
+{
+    UiRect all = { 0, 0, lcd->width(), lcd->height() };
+    nDirty = 0;
+    invalidate(all);
+}
+
+boolean UiScreen::isDirty(void) const
+{
+    return nDirty > 0;
+}
+
+// The widget that can draw r straight to the LCD: an opaque widget that
+// holds all of r and that no other widget overlaps, so drawing it whole
+// changes nothing but its own pixels. NULL if there is none.
+UiWidget *UiScreen::directWidget(const UiRect &r) const
+{
+    UiWidget *found = NULL;
+
+    for (UiWidget *w = widgets; w != NULL; w = w->next)
+    {
+        if (!UiRectIntersects(w->rect, r)) continue;
+        if (found != NULL || !w->opaque() || !UiRectContains(w->rect, r)) return NULL;
+        found = w;
+    }
+    if (found == NULL) return NULL;
+    for (UiWidget *w = widgets; w != NULL; w = w->next)
+    {
+        if (w != found && UiRectIntersects(w->rect, found->rect)) return NULL;
+    }
+    return found;
+}
+
+// Redraw the dirty rectangles, each one once with every widget that
+// touches it. Returns the LCD bus bytes sent.
+INT32U UiScreen::paint(void)
+{
+    Ili9341BusStats bus;
+
+    if (nDirty == 0) return 0;
+
+    lcd->resetBusStats();
+    for (INT8U i = 0; i < nDirty; i++)
+    {
+        const UiRect &r = dirty[i];
+        UiWidget *direct = directWidget(r);
+        if (direct != NULL)
+        {
+            direct->draw(lcd);
+            stats.rects++;
+            stats.direct++;
+            stats.pixels += UiRectArea(direct->rect);
+            continue;
+        }
+
+        strip->begin(r.x, r.y, r.w, r.h, bgColor);
+        do {
+            for (UiWidget *w = widgets; w != NULL; w = w->next)
+            {
+                if (UiRectIntersects(w->rect, r)) w->draw(strip);
+            }
+        } while (strip->nextStrip());
+
+        stats.rects++;
+        stats.pixels += UiRectArea(r);
+    }
+    nDirty = 0;
+    lcd->getBusStats(&bus);
+
+    stats.paints++;
+    stats.lastBytes = bus.bytes;
+    stats.totalBytes += bus.bytes;
+    if (bus.bytes > stats.maxBytes) stats.maxBytes = bus.bytes;
+    return bus.bytes;
+}
+
+void UiScreen::getStats(UiStats *stats) const
+{
+    *stats = this->stats;
+}
+
+
+/************************************************************************************
+
+   UiLabel
+
+************************************************************************************/
+
+UiLabel::UiLabel(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color,
+    const RunFont *font, uint8_t textSize)
+    : UiWidget(x, y, w, h)
+{
+    text[0] = 0;
+    this->color = color;
+    this->font = font;
+    this->textSize = textSize;
+}
+
+// Change the text, redrawing the label only if it differs. The 5x7 font
+// is fixed width, so with it only the characters from the first to the
+// last that changed are redrawn, the changed digits of a clock say.
+void UiLabel::setText(const char *text)
+{
+    if (strncmp(this->text, text, UI_LABEL_MAX - 1) == 0) return;
+
+    // Changed span; a change in length changes everything to the end
+    int16_t oldLen = (int16_t)strlen(this->text);
+    int16_t newLen = 0;
+    while (newLen < UI_LABEL_MAX - 1 && text[newLen] != 0) newLen++;
+    int16_t last = oldLen > newLen ? oldLen : newLen;
+    int16_t first = 0;
+    while (first < oldLen && first < newLen && this->text[first] == text[first]) first++;
+    while (oldLen == newLen && last > first && this->text[last - 1] == text[last - 1]) last--;
+
+    strncpy(this->text, text, UI_LABEL_MAX - 1);
+    this->text[UI_LABEL_MAX - 1] = 0;
+    if (font != NULL)
+    {
+        invalidate();
+        return;
+    }
+
+    int16_t cell = 6 * textSize;
+    int16_t x = rect.x + first * cell;
+    int16_t w = (last - first) * cell;
+    if (x >= rect.x + rect.w) return;
+    if (x + w > rect.x + rect.w) w = rect.x + rect.w - x;
+    invalidate(x, rect.y, w, rect.h);
+}
+
+void UiLabel::draw(Adafruit_GFX *gfx)
+{
+    gfx->setCursor(rect.x, rect.y);
+    gfx->setTextColor(color);
+    gfx->setTextSize(textSize);
+    gfx->setTextWrap(false);
+    gfx->setFont(font);
+    for (const char *p = text; *p != 0; p++) gfx->write(*p);
+    gfx->setFont(NULL);
+    gfx->setTextWrap(true);
+}
+
+
+/************************************************************************************
+
+   UiButton
+
+************************************************************************************/
+
+UiButton::UiButton(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t outline,
+    uint16_t fill, uint16_t textColor, const char *label, uint8_t textSize)
+    : UiWidget(x, y, w, h)
+{
+    this->label = label;
+    this->outline = outline;
+    this->fill = fill;
+    this->textColor = textColor;
+    this->textSize = textSize;
+    normalSprite = NULL;
+    pressedSprite = NULL;
+    pressed = false;
+}
+
+UiButton::UiButton(int16_t x, int16_t y, const RunSprite *normal, const RunSprite *pressed)
+    : UiWidget(x, y, normal->width, normal->height)
+{
+    normalSprite = normal;
+    pressedSprite = pressed;
+    label = NULL;
+    outline = fill = textColor = 0;
+    textSize = 0;
+    this->pressed = false;
+}
+
+void UiButton::setPressed(boolean pressed)
+{
+    if (this->pressed == pressed) return;
+    this->pressed = pressed;
+    invalidate();
+}
+
+void UiButton::draw(Adafruit_GFX *gfx)
+{
+    if (normalSprite != NULL)
+    {
+        gfx->drawSprite(rect.x, rect.y, pressed ? pressedSprite : normalSprite);
+        return;
+    }
+
+    int16_t r = (rect.w < rect.h ? rect.w : rect.h) / 4;
+    int16_t cx = rect.x + rect.w / 2;
+    int16_t cy = rect.y + rect.h / 2;
+
+    gfx->fillRoundRect(rect.x, rect.y, rect.w, rect.h, r, pressed ? textColor : fill);
+    gfx->drawRoundRect(rect.x, rect.y, rect.w, rect.h, r, outline);
+
+    gfx->setFont(NULL);
+    gfx->setCursor(cx - strlen(label) * 3 * textSize, cy - 4 * textSize);
+    gfx->setTextColor(pressed ? fill : textColor);
+    gfx->setTextSize(textSize);
+    for (const char *p = label; *p != 0; p++) gfx->write(*p);
+}
+
+// Sprites cover the button; the label button's rounded corners do not
+boolean UiButton::opaque(void) const
+{
+    return normalSprite != NULL;
+}
+
+
+/************************************************************************************
+
+   UiProgressBar
+
+************************************************************************************/
+
+UiProgressBar::UiProgressBar(int16_t x, int16_t y, int16_t w, int16_t h,
+    uint16_t outline, uint16_t fill, uint16_t max)
+    : UiWidget(x, y, w, h)
+{
+    this->outline = outline;
+    this->fill = fill;
+    this->max = max > 0 ? max : 1;
+    value = 0;
+}
+
+// Width of the filled part inside the 1 pixel outline
+int16_t UiProgressBar::fillWidth(uint16_t value) const
+{
+    if (value > max) value = max;
+    return (int16_t)((INT32U)(rect.w - 2) * value / max);
+}
+
+// Set the value, redrawing only the columns whose fill changes
+void UiProgressBar::setValue(uint16_t value)
+{
+    int16_t oldWidth = fillWidth(this->value);
+    int16_t newWidth = fillWidth(value);
+
+    this->value = value;
+    if (newWidth == oldWidth) return;
+    if (newWidth > oldWidth)
+        invalidate(rect.x + 1 + oldWidth, rect.y + 1, newWidth - oldWidth, rect.h - 2);
+    else
+        invalidate(rect.x + 1 + newWidth, rect.y + 1, oldWidth - newWidth, rect.h - 2);
+}
+
+void UiProgressBar::draw(Adafruit_GFX *gfx)
+{
+    gfx->drawRect(rect.x, rect.y, rect.w, rect.h, outline);
+    gfx->fillRect(rect.x + 1, rect.y + 1, fillWidth(value), rect.h - 2, fill);
+}
+
+
+/************************************************************************************
+
+   UiSpectrum
+
+************************************************************************************/
+
+UiSpectrum::UiSpectrum(int16_t x, int16_t y, int16_t w, int16_t h,
+    uint16_t barColor, uint16_t peakColor, uint8_t max)
+    : UiWidget(x, y, w, h)
+{
+    this->barColor = barColor;
+    this->peakColor = peakColor;
+    this->max = max > 0 ? max : 1;
+    count = 0;
+}
+
+// First column of a band; bands are separated by one background column
+int16_t UiSpectrum::barLeft(uint8_t band) const
+{
+    return rect.x + (int16_t)((INT32U)rect.w * band / count);
+}
+
+// Top row of a bar at level, rect.y + rect.h when empty
+int16_t UiSpectrum::barTop(uint8_t level) const
+{
+    if (level > max) level = max;
+    return rect.y + rect.h - (int16_t)((INT32U)rect.h * level / max);
+}
+
+// Set the levels and peaks of count bands, redrawing in each band only
+// the rows between its old and new bar tops and its old and new peak lines
+void UiSpectrum::setLevels(const uint8_t *levels, const uint8_t *peaks, uint8_t count)
+{
+    if (count > UI_SPECTRUM_BANDS) count = UI_SPECTRUM_BANDS;
+    if (count != this->count)
+    {
+        this->count = count;
+        memcpy(level, levels, count);
+        memcpy(peak, peaks, count);
+        invalidate();
+        return;
+    }
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (levels[i] == level[i] && peaks[i] == peak[i]) continue;
+
+        int16_t oldTop = barTop(level[i]), newTop = barTop(levels[i]);
+        int16_t oldPeak = barTop(peak[i]), newPeak = barTop(peaks[i]);
+        int16_t top = rect.y + rect.h, bottom = rect.y;
+
+        if (oldTop != newTop)
+        {
+            top = oldTop < newTop ? oldTop : newTop;
+            bottom = oldTop < newTop ? newTop : oldTop;
+        }
+        if (oldPeak != newPeak)
+        {
+            // The line sits on the row above the bar's top at that level
+            int16_t a = (oldPeak < newPeak ? oldPeak : newPeak) - 1;
+            int16_t b = oldPeak < newPeak ? newPeak : oldPeak;
+            if (a < top) top = a;
+            if (b > bottom) bottom = b;
+        }
+        if (top < rect.y) top = rect.y;
+        level[i] = levels[i];
+        peak[i] = peaks[i];
+        if (bottom > top) invalidate(barLeft(i), top, barLeft(i + 1) - barLeft(i) - 1, bottom - top);
+    }
+}
+
+void UiSpectrum::draw(Adafruit_GFX *gfx)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        int16_t x = barLeft(i);
+        int16_t w = barLeft(i + 1) - x - 1;
+        int16_t top = barTop(level[i]);
+
+        gfx->fillRect(x, top, w, rect.y + rect.h - top, barColor);
+        if (peak[i] > 0 && barTop(peak[i]) > rect.y)
+            gfx->drawFastHLine(x, barTop(peak[i]) - 1, w, peakColor);
+    }
+}
@@ -0,0 +1,176 @@
+/*
+    uiWidgets.h
+    Retained mode widgets for the LCD.
+
+    Widgets keep their own state and mark the part of the screen that a
+    change affects as dirty. Nothing is drawn until UiScreen::paint(),
+    which the display task calls once per frame: overlapping or nearby
+    dirty rectangles are merged, and each remaining rectangle is redrawn
+    once through the strip renderer, every widget it touches drawing
+    itself clipped to it.
+
+    A dirty rectangle inside an opaque widget that no other widget
+    overlaps is instead drawn by that widget straight to the LCD, as one
+    address window without going through the strip buffers.
+
+    Only the display task may change or paint widgets. Widget geometry is
+    fixed, so other tasks may call contains() for hit testing.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __UIWIDGETS_H__
+#define __UIWIDGETS_H__
+
+#include <Adafruit_ILI9341_Strip.h>
+
+#define UI_MAX_DIRTY        8       // dirty rectangles kept before merging is forced
+#define UI_MERGE_SLACK      256     // pixels two rectangles may waste and still be merged
+#define UI_LABEL_MAX        32      // characters in a label, including the terminator
+#define UI_SPECTRUM_BANDS   32      // most bars in a spectrum
+
+typedef struct
+{
+    int16_t x, y, w, h;
+} UiRect;
+
+typedef struct
+{
+    INT32U paints;      // paint() calls that drew something
+    INT32U rects;       // rectangles drawn
+    INT32U direct;      // of those, drawn by one opaque widget straight to the LCD
+    INT32U pixels;      // pixels drawn
+    INT32U lastBytes;   // LCD bus bytes of the last paint
+    INT32U maxBytes;    // most LCD bus bytes of any paint
+    INT32U totalBytes;
+} UiStats;
+
+class UiScreen;
+
+class UiWidget
+{
+public:
+    UiWidget(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    // Draws the whole widget; the caller clips it to the dirty rectangle
+    virtual void draw(Adafruit_GFX *gfx) = 0;
+
+    // True if draw() sets every pixel of the widget's rectangle
+    virtual boolean opaque(void) const;
+
+    boolean contains(int16_t x, int16_t y) const;
+    void invalidate(void);
+
+protected:
+    void invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    UiRect rect;
+
+private:
+    friend class UiScreen;
+    UiScreen *screen;
+    UiWidget *next;
+};
+
+class UiScreen
+{
+public:
+    UiScreen(Adafruit_ILI9341 *lcd, Adafruit_ILI9341_Strip *strip, uint16_t bg);
+
+    void add(UiWidget *widget);
+    void invalidate(const UiRect &r);
+    void invalidateAll(void);
+    boolean isDirty(void) const;
+    INT32U paint(void);
+    void getStats(UiStats *stats) const;
+
+private:
+    UiWidget *directWidget(const UiRect &r) const;
+
+    Adafruit_ILI9341 *lcd;
+    Adafruit_ILI9341_Strip *strip;
+    UiWidget *widgets;
+    uint16_t bgColor;
+    UiRect dirty[UI_MAX_DIRTY];
+    INT8U nDirty;
+    UiStats stats;
+};
+
+// One line of text. font NULL uses the 5x7 font at textSize, with which a
+// new text redraws only the characters that changed.
+class UiLabel : public UiWidget
+{
+public:
+    UiLabel(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color,
+        const RunFont *font, uint8_t textSize);
+
+    void setText(const char *text);
+    void draw(Adafruit_GFX *gfx);
+
+private:
+    char text[UI_LABEL_MAX];
+    uint16_t color;
+    const RunFont *font;
+    uint8_t textSize;
+};
+
+// Rounded button with a centered 5x7 label, shown inverted while pressed,
+// or a button drawn as a sprite with another for the pressed state. The
+// two sprites must be the same size, which is the button's.
+class UiButton : public UiWidget
+{
+public:
+    UiButton(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t outline,
+        uint16_t fill, uint16_t textColor, const char *label, uint8_t textSize);
+    UiButton(int16_t x, int16_t y, const RunSprite *normal, const RunSprite *pressed);
+
+    void setPressed(boolean pressed);
+    void draw(Adafruit_GFX *gfx);
+    boolean opaque(void) const;
+
+private:
+    const RunSprite *normalSprite, *pressedSprite;  // NULL for a label button
+    const char *label;
+    uint16_t outline, fill, textColor;
+    uint8_t textSize;
+    boolean pressed;
+};
+
+// Horizontal bar filled in proportion to value / max
+class UiProgressBar : public UiWidget
+{
+public:
+    UiProgressBar(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t outline,
+        uint16_t fill, uint16_t max);
+
+    void setValue(uint16_t value);
+    void draw(Adafruit_GFX *gfx);
+
+private:
+    int16_t fillWidth(uint16_t value) const;
+
+    uint16_t outline, fill;
+    uint16_t value, max;
+};
+
+// Vertical bars side by side, each filled in proportion to its level / max,
+// with a one pixel line marking the band's peak
+class UiSpectrum : public UiWidget
+{
+public:
+    UiSpectrum(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t barColor,
+        uint16_t peakColor, uint8_t max);
+
+    void setLevels(const uint8_t *levels, const uint8_t *peaks, uint8_t count);
+    void draw(Adafruit_GFX *gfx);
+
+private:
+    int16_t barLeft(uint8_t band) const;
+    int16_t barTop(uint8_t level) const;
+
+    uint8_t level[UI_SPECTRUM_BANDS], peak[UI_SPECTRUM_BANDS];
+    uint8_t count, max;
+    uint16_t barColor, peakColor;
+};
+
+#endif /* __UIWIDGETS_H__ */
@@ -39,4 +39,74 @@ void BspLcdInitILI9341()
     GPIO_InitStruct.GPIO_PuPd = GPIO_PuPd_UP;
      
     GPIO_Init(LCD_ILI9341_DC_GPIO, &GPIO_InitStruct);
+    
+    /*-------- Configure FT6206 touch interrupt Pin PA10, open drain, low while touched --------*/ 
+ 
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOA, ENABLE);
+    GPIO_InitStruct.GPIO_Pin = LCD_FT6206_INT_GPIO_Pin;
+    GPIO_InitStruct.GPIO_Mode = GPIO_Mode_IN;
+    GPIO_InitStruct.GPIO_Speed = GPIO_Speed_2MHz;
+    GPIO_InitStruct.GPIO_OType = GPIO_OType_PP;
+    GPIO_InitStruct.GPIO_PuPd = GPIO_PuPd_UP;
+     
+    GPIO_Init(LCD_FT6206_INT_GPIO, &GPIO_InitStruct);
+}
+
+// Event flag group and bits posted by the touch interrupt
+static OS_FLAG_GRP *touchIntFlagGrp = 0;
+static OS_FLAGS touchIntFlags = 0;
+
+// BspTouchIntEnable
+// Enables an interrupt on the falling edge of the FT6206 INT line, i.e.
+// when a touch begins. The interrupt sets the given flags so a task can
+// block until the panel is touched instead of polling it over I2C. A
+// touch already in progress raises no interrupt, so check
+// BspTouchIsActive() after clearing the flags and before pending on them.
+// pFlagGrp: the event flag group to post to
+// flags: the flag bits to set
+void BspTouchIntEnable(OS_FLAG_GRP *pFlagGrp, OS_FLAGS flags)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    
+    OS_ENTER_CRITICAL();
+    touchIntFlagGrp = pFlagGrp;
+    touchIntFlags = flags;
+    OS_EXIT_CRITICAL();
+    
+    // As for DREQ, program SYSCFG and EXTI directly (see bspMp3.c)
+    SYSCFG->EXTICR[2] = (SYSCFG->EXTICR[2] & ~SYSCFG_EXTICR3_EXTI10) | LCD_FT6206_INT_EXTI_PORT;
+    EXTI->FTSR |= LCD_FT6206_INT_EXTI_LINE;
+    EXTI->RTSR &= ~LCD_FT6206_INT_EXTI_LINE;
+    EXTI->PR = LCD_FT6206_INT_EXTI_LINE;    // discard any stale edge
+    EXTI->IMR |= LCD_FT6206_INT_EXTI_LINE;
+    
+    NVIC_SetPriority(LCD_FT6206_INT_IRQn, LCD_FT6206_INT_IRQ_PRIO);
+    NVIC_EnableIRQ(LCD_FT6206_INT_IRQn);
+}
+
+// BspTouchIsActive
+// Returns: OS_TRUE if the FT6206 INT line is low, i.e. the panel is touched
+BOOLEAN BspTouchIsActive()
+{
+    return GPIO_ReadInputDataBit(LCD_FT6206_INT_GPIO, LCD_FT6206_INT_GPIO_Pin) ? OS_FALSE : OS_TRUE;
+}
+
+// Touch interrupt (EXTI lines 10 to 15, overrides the weak handler in startup.s).
+// Only line 10 is enabled.
+void EXTI10Thru15IrqHandler(void)
+{
+    INT8U err;
+    
+    OSIntEnter();
+    
+    if (EXTI->PR & LCD_FT6206_INT_EXTI_LINE)
+    {
+        EXTI->PR = LCD_FT6206_INT_EXTI_LINE;    // acknowledge
+        if (touchIntFlagGrp != 0)
+        {
+            OSFlagPost(touchIntFlagGrp, touchIntFlags, OS_FLAG_SET, &err);
+        }
+    }
+    
+    OSIntExit();
 }
\ No newline at end of file
@@ -26,10 +26,31 @@
 #define LCD_ILI9341_DC_LOW()        GPIO_ResetBits(LCD_ILI9341_DC_GPIO, LCD_ILI9341_DC_GPIO_Pin);
 #define LCD_ILI9341_DC_HIGH()       GPIO_SetBits(LCD_ILI9341_DC_GPIO, LCD_ILI9341_DC_GPIO_Pin);
 
+// FT6206 touch controller interrupt: held low while the panel is touched.
+// The shield does not route it to a header pin; wire its touch IRQ pad
+// to D2, PA10 on the Nucleo board, for APP_CFG_TOUCH_INT_EN.
+#define LCD_FT6206_INT_GPIO                 GPIOA
+#define LCD_FT6206_INT_GPIO_Pin             GPIO_Pin_10
+#define LCD_FT6206_INT_EXTI_PORT            SYSCFG_EXTICR3_EXTI10_PA   // route PA10 to EXTI line 10
+#define LCD_FT6206_INT_EXTI_LINE            EXTI_IMR_MR10
+#define LCD_FT6206_INT_IRQn                 EXTI15_10_IRQn
+#define LCD_FT6206_INT_IRQ_PRIO             8
+
 #define LCD_SPI_DEVICE_ID  PJDF_DEVICE_ID_SPI1
 
 #define LCD_SPI_DATARATE  SPI_BaudRatePrescaler_2  // Tune to find optimal value LCD controller will work with
 
 void BspLcdInitILI9341();
+void BspTouchIntEnable(OS_FLAG_GRP *pFlagGrp, OS_FLAGS flags);
+BOOLEAN BspTouchIsActive();
+
+// Referenced by the vector table in startup.s so needs C linkage
+#ifdef __cplusplus
+extern "C" {
+#endif
+void EXTI10Thru15IrqHandler(void);
+#ifdef __cplusplus
+}
+#endif
 
 #endif
\ No newline at end of file
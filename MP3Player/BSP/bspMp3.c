@@ -20,6 +20,8 @@ const INT8U BspMp3SetClockF[] = { 0x02, 0x03, 0x98, 0x00 };
 const INT8U BspMp3SetVol1010[] = { 0x02, 0x0B, 0x10, 0x10 };
 const INT8U BspMp3SetVol6060[] = { 0x02, 0x0B, 0x60, 0x60 };
 const INT8U BspMp3ReadVol[] = { 0x3, 0x0B, 0x00, 0x00 };
+const INT8U BspMp3ReadDecodeTime[] = { 0x3, 0x04, 0x00, 0x00 };  // seconds decoded since the last reset
+const INT8U BspMp3WriteDecodeTime[] = { 0x2, 0x04, 0x00, 0x00 }; // seconds in bytes 2 and 3
 
 // Lengths of the above commands
 const INT8U BspMp3SineWaveLen = sizeof(BspMp3SineWave);
@@ -31,6 +33,8 @@ const INT8U BspMp3SetClockFLen = sizeof(BspMp3SetClockF);
 const INT8U BspMp3SetVol1010Len = sizeof(BspMp3SetVol1010);
 const INT8U BspMp3SetVol6060Len = sizeof(BspMp3SetVol6060);
 const INT8U BspMp3ReadVolLen = sizeof(BspMp3ReadVol);
+const INT8U BspMp3ReadDecodeTimeLen = sizeof(BspMp3ReadDecodeTime);
+const INT8U BspMp3WriteDecodeTimeLen = sizeof(BspMp3WriteDecodeTime);
 
 
 
@@ -73,4 +77,60 @@ void BspMp3InitVS1053()
     GPIO_InitStruct.GPIO_PuPd = GPIO_PuPd_DOWN;
      
     GPIO_Init(MP3_VS1053_DREQ_GPIO, &GPIO_InitStruct);
-}
\ No newline at end of file
+}
+// Event flag group and bits posted by the DREQ interrupt
+static OS_FLAG_GRP *mp3DreqFlagGrp = 0;
+static OS_FLAGS mp3DreqFlags = 0;
+
+// BspMp3DreqIntEnable
+// Enables an interrupt on the rising edge of DREQ, i.e. each time the VS1053
+// FIFO goes from full to able to accept another MP3_DECODER_BUF_SIZE bytes.
+// The interrupt sets the given flags so a task can block until the decoder
+// wants data instead of polling. DREQ that is already high raises no interrupt,
+// so check BspMp3IsReady() after clearing the flags and before pending on them.
+// pFlagGrp: the event flag group to post to
+// flags: the flag bits to set
+void BspMp3DreqIntEnable(OS_FLAG_GRP *pFlagGrp, OS_FLAGS flags)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    
+    OS_ENTER_CRITICAL();
+    mp3DreqFlagGrp = pFlagGrp;
+    mp3DreqFlags = flags;
+    OS_EXIT_CRITICAL();
+    
+    // No SYSCFG_EXTILineConfig() in this StdPeriph subset so program the
+    // registers directly. The SYSCFG clock is enabled in hw_init.c.
+    SYSCFG->EXTICR[0] = (SYSCFG->EXTICR[0] & ~SYSCFG_EXTICR1_EXTI3) | MP3_VS1053_DREQ_EXTI_PORT;
+    EXTI->RTSR |= MP3_VS1053_DREQ_EXTI_LINE;
+    EXTI->FTSR &= ~MP3_VS1053_DREQ_EXTI_LINE;
+    EXTI->PR = MP3_VS1053_DREQ_EXTI_LINE;   // discard any stale edge
+    EXTI->IMR |= MP3_VS1053_DREQ_EXTI_LINE;
+    
+    NVIC_SetPriority(MP3_VS1053_DREQ_IRQn, MP3_VS1053_DREQ_IRQ_PRIO);
+    NVIC_EnableIRQ(MP3_VS1053_DREQ_IRQn);
+}
+
+// BspMp3IsReady
+// Returns: OS_TRUE if DREQ is high, i.e. the VS1053 can accept at least
+//     MP3_DECODER_BUF_SIZE bytes of data or a command.
+BOOLEAN BspMp3IsReady()
+{
+    return GPIO_ReadInputDataBit(MP3_VS1053_DREQ_GPIO, MP3_VS1053_DREQ_GPIO_Pin) ? OS_TRUE : OS_FALSE;
+}
+
+// DREQ rising edge interrupt (EXTI line 3, overrides the weak handler in startup.s)
+void EXTI3IrqHandler(void)
+{
+    INT8U err;
+    
+    OSIntEnter();
+    
+    EXTI->PR = MP3_VS1053_DREQ_EXTI_LINE;   // acknowledge
+    if (mp3DreqFlagGrp != 0)
+    {
+        OSFlagPost(mp3DreqFlagGrp, mp3DreqFlags, OS_FLAG_SET, &err);
+    }
+    
+    OSIntExit();
+}
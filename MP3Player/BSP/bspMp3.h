@@ -21,6 +21,10 @@
 
 #define MP3_VS1053_DREQ_GPIO               GPIOB
 #define MP3_VS1053_DREQ_GPIO_Pin           GPIO_Pin_3
+#define MP3_VS1053_DREQ_EXTI_PORT          SYSCFG_EXTICR1_EXTI3_PB   // route PB3 to EXTI line 3
+#define MP3_VS1053_DREQ_EXTI_LINE          EXTI_IMR_MR3
+#define MP3_VS1053_DREQ_IRQn               EXTI3_IRQn
+#define MP3_VS1053_DREQ_IRQ_PRIO           6
 
 #define MP3_VS1053_MCS_ASSERT()       GPIO_ResetBits(MP3_VS1053_MCS_GPIO, MP3_VS1053_MCS_GPIO_Pin);
 #define MP3_VS1053_MCS_DEASSERT()      GPIO_SetBits(MP3_VS1053_MCS_GPIO, MP3_VS1053_MCS_GPIO_Pin);
@@ -45,6 +49,8 @@ extern const INT8U BspMp3SetClockF[];
 extern const INT8U BspMp3SetVol1010[];
 extern const INT8U BspMp3SetVol6060[];
 extern const INT8U BspMp3ReadVol[];
+extern const INT8U BspMp3ReadDecodeTime[];
+extern const INT8U BspMp3WriteDecodeTime[];
 
 // Lengths of the above commands
 extern const INT8U BspMp3SineWaveLen;
@@ -56,8 +62,21 @@ extern const INT8U BspMp3SetClockFLen;
 extern const INT8U BspMp3SetVol1010Len;
 extern const INT8U BspMp3SetVol6060Len;
 extern const INT8U BspMp3ReadVolLen;
+extern const INT8U BspMp3ReadDecodeTimeLen;
+extern const INT8U BspMp3WriteDecodeTimeLen;
 
 
 void BspMp3InitVS1053();
+void BspMp3DreqIntEnable(OS_FLAG_GRP *pFlagGrp, OS_FLAGS flags);
+BOOLEAN BspMp3IsReady();
+
+// Referenced by the vector table in startup.s so needs C linkage
+#ifdef __cplusplus
+extern "C" {
+#endif
+void EXTI3IrqHandler(void);
+#ifdef __cplusplus
+}
+#endif
 
 #endif
\ No newline at end of file
@@ -10,6 +10,22 @@
 
 #include "bsp.h"
 
+static OS_EVENT *spi1DmaSem = 0;     // posted when a SPI1 TX DMA transfer ends
+static BOOLEAN spi1DmaBusy = OS_FALSE; // a transfer was started and not yet waited for
+
+// Sets up DMA2 stream 3 for SPI1 transmit. The stream is programmed per
+// transfer by SPI_DmaStart16().
+static void BspSPI1DmaInit()
+{
+    RCC->AHB1ENR |= RCC_AHB1ENR_DMA2EN;
+
+    spi1DmaSem = OSSemCreate(0);
+    if (spi1DmaSem == NULL) while (1);  // not enough semaphores available
+
+    NVIC_SetPriority(SPI1_TX_DMA_IRQn, SPI1_TX_DMA_IRQ_PRIO);
+    NVIC_EnableIRQ(SPI1_TX_DMA_IRQn);
+}
+
 // BspSPI1Init
 // Initializes the SPI1 memory mapped register block and enables it for use
 // as a master SPI device.
@@ -49,6 +65,8 @@ void BspSPI1Init()
     GPIO_PinAFConfig(GPIOA, GPIO_PinSource7, GPIO_AF_SPI1);
 
     SPI_Cmd(SPI1, ENABLE);
+
+    BspSPI1DmaInit();
 }
 
 
@@ -93,3 +111,113 @@ void SPI_SetDataRate(SPI_TypeDef *spi, uint16_t value)
   spi->CR1 = tmpreg;  // write back the register
 }
 
+
+// Waits until the last frame has left the shift register and discards
+// whatever was received meanwhile, clearing any overrun.
+static void SPI_WaitIdle(SPI_TypeDef *spi)
+{
+    while(!SPI_I2S_GetFlagStatus(spi, SPI_I2S_FLAG_TXE));
+    while(SPI_I2S_GetFlagStatus(spi, SPI_I2S_FLAG_BSY));
+    (void)spi->DR;
+    (void)spi->SR;
+}
+
+// SPI_DmaStart16
+// Starts sending count 16 bit values, each high byte first, and returns
+// without waiting. On SPI1 the values go out by DMA, reading successive
+// values from src, or src[0] every time if increment is false; src must
+// stay unchanged until SPI_DmaWait(). Other SPIs send before returning.
+// The caller must hold the SPI lock and assert the slave chip select as
+// for SPI_SendBuffer(), and call SPI_DmaWait() before anything else uses
+// the SPI.
+void SPI_DmaStart16(SPI_TypeDef *spi, const uint16_t *src, uint16_t count, BOOLEAN increment)
+{
+    DMA_Stream_TypeDef *stream = SPI1_TX_DMA_STREAM;
+    uint8_t bytes[2];
+
+    if (spi != SPI1 || spi1DmaSem == 0)
+    {
+        // No DMA stream assigned, send from the CPU
+        for (uint16_t i = 0; i < count; i++)
+        {
+            uint16_t value = src[increment ? i : 0];
+            bytes[0] = (uint8_t)(value >> 8);
+            bytes[1] = (uint8_t)value;
+            SPI_SendBuffer(spi, bytes, 2);
+        }
+        return;
+    }
+    if (count == 0) return;
+
+    // 16 bit frames so one DMA item is one value. DFF may only change while disabled.
+    SPI_WaitIdle(spi);
+    spi->CR1 &= ~SPI_CR1_SPE;
+    spi->CR1 |= SPI_CR1_DFF;
+    spi->CR1 |= SPI_CR1_SPE;
+
+    stream->CR &= ~DMA_SxCR_EN;
+    while (stream->CR & DMA_SxCR_EN);
+    DMA2->LIFCR = SPI1_TX_DMA_FLAGS;
+
+    stream->PAR = (uint32_t)&spi->DR;
+    stream->M0AR = (uint32_t)src;
+    stream->NDTR = count;
+    stream->FCR = 0; // direct mode
+    stream->CR = SPI1_TX_DMA_CHANNEL | DMA_SxCR_MSIZE_0 | DMA_SxCR_PSIZE_0 | DMA_SxCR_DIR_0 |
+                 DMA_SxCR_TCIE | DMA_SxCR_TEIE | (increment ? DMA_SxCR_MINC : 0);  // memory to peripheral
+    spi1DmaBusy = OS_TRUE;
+    stream->CR |= DMA_SxCR_EN;
+    spi->CR2 |= SPI_CR2_TXDMAEN;
+}
+
+// SPI_DmaWait
+// Pends until the transfer started by SPI_DmaStart16() has completed and
+// returns the SPI to 8 bit frames. Returns at once if none is in progress.
+void SPI_DmaWait(SPI_TypeDef *spi)
+{
+    INT8U err;
+
+    if (spi != SPI1 || !spi1DmaBusy) return;
+
+    OSSemPend(spi1DmaSem, 0, &err);
+    spi->CR2 &= ~SPI_CR2_TXDMAEN;
+    spi1DmaBusy = OS_FALSE;
+
+    SPI_WaitIdle(spi);
+    spi->CR1 &= ~SPI_CR1_SPE;
+    spi->CR1 &= ~SPI_CR1_DFF;
+    spi->CR1 |= SPI_CR1_SPE;
+}
+
+// SPI_SendRepeated
+// Sends the 16 bit value, high byte first, count times. On SPI1 this is done
+// by DMA from a single halfword with memory increment off, chunked to the
+// 65535 item limit, and the calling task pends until each chunk completes
+// so the CPU is free meanwhile. The caller must hold the SPI lock and assert
+// the slave chip select as for SPI_SendBuffer().
+void SPI_SendRepeated(SPI_TypeDef *spi, uint16_t value, uint32_t count)
+{
+    uint16_t n;
+
+    while (count > 0)
+    {
+        n = count < SPI_DMA_MAX_ITEMS ? count : SPI_DMA_MAX_ITEMS;
+        SPI_DmaStart16(spi, &value, n, OS_FALSE);
+        SPI_DmaWait(spi);
+        count -= n;
+    }
+}
+
+// SPI1 TX DMA transfer complete or error
+void DMA2Stream3IrqHandler(void)
+{
+    OSIntEnter();
+
+    if (DMA2->LISR & (DMA_LISR_TCIF3 | DMA_LISR_TEIF3))
+    {
+        DMA2->LIFCR = SPI1_TX_DMA_FLAGS;
+        OSSemPost(spi1DmaSem);
+    }
+
+    OSIntExit();
+}
@@ -15,11 +15,32 @@
 
 #define PJDF_SPI1 SPI1 // Address of SPI1 memory mapped register block
 
+// SPI1 TX requests are served by DMA2 stream 3 channel 3
+#define SPI1_TX_DMA_STREAM        DMA2_Stream3
+#define SPI1_TX_DMA_CHANNEL       (DMA_SxCR_CHSEL_0 | DMA_SxCR_CHSEL_1)
+#define SPI1_TX_DMA_IRQn          DMA2_Stream3_IRQn
+#define SPI1_TX_DMA_IRQ_PRIO      7
+#define SPI1_TX_DMA_FLAGS         (DMA_LIFCR_CTCIF3 | DMA_LIFCR_CHTIF3 | DMA_LIFCR_CTEIF3 | DMA_LIFCR_CDMEIF3 | DMA_LIFCR_CFEIF3)
+
+#define SPI_DMA_MAX_ITEMS         65535   // NDTR is 16 bits
+
 // Application interface to hardware
 
 void BspSPI1Init();
 void SPI_SendBuffer(SPI_TypeDef *spi, uint8_t *buffer, uint16_t bufLength);
 void SPI_GetBuffer(SPI_TypeDef *spi, uint8_t *buffer, uint16_t bufLength);
 void SPI_SetDataRate(SPI_TypeDef *spi, uint16_t value);
+void SPI_SendRepeated(SPI_TypeDef *spi, uint16_t value, uint32_t count);
+void SPI_DmaStart16(SPI_TypeDef *spi, const uint16_t *src, uint16_t count, BOOLEAN increment);
+void SPI_DmaWait(SPI_TypeDef *spi);
+
+// Referenced by the vector table in startup.s so needs C linkage
+#ifdef __cplusplus
+extern "C" {
+#endif
+void DMA2Stream3IrqHandler(void);
+#ifdef __cplusplus
+}
+#endif
 
 #endif /* __SPI_H */
\ No newline at end of file
@@ -113,6 +113,25 @@ __vector_table
       DCD     UnusedIrqHandler              ; USART2
       DCD     0
       DCD     EXTI10Thru15IrqHandler        ; EXTI Lines 10 -> 15
+      DCD     UnusedIrqHandler              ; RTC Alarm through EXTI Line
+      DCD     UnusedIrqHandler              ; USB OTG FS Wakeup through EXTI line
+      DCD     0
+      DCD     0
+      DCD     0
+      DCD     0
+      DCD     UnusedIrqHandler              ; DMA1 Stream 7
+      DCD     0
+      DCD     UnusedIrqHandler              ; SDIO
+      DCD     UnusedIrqHandler              ; TIM5
+      DCD     UnusedIrqHandler              ; SPI3
+      DCD     0
+      DCD     0
+      DCD     0
+      DCD     0
+      DCD     UnusedIrqHandler              ; DMA2 Stream 0
+      DCD     UnusedIrqHandler              ; DMA2 Stream 1
+      DCD     UnusedIrqHandler              ; DMA2 Stream 2
+      DCD     DMA2Stream3IrqHandler         ; DMA2 Stream 3 (SPI1 TX)
      
       ; There are more IRQs that are not added here......
       
@@ -136,6 +155,7 @@ __vector_table
       PUBWEAK  EXTI4IrqHandler 
       PUBWEAK  EXTI5Thru9IrqHandler
       PUBWEAK  EXTI10Thru15IrqHandler
+      PUBWEAK  DMA2Stream3IrqHandler
       
 NMIIrqHandler 
 MemManageIrqHandler      
@@ -151,6 +171,7 @@ EXTI3IrqHandler
 EXTI4IrqHandler
 EXTI5Thru9IrqHandler
 EXTI10Thru15IrqHandler
+DMA2Stream3IrqHandler
 
 UnusedIrqHandler           
       B         UnusedIrqHandler      ; Loop forever
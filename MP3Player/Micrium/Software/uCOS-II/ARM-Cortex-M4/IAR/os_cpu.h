@@ -93,6 +93,21 @@
 
 #define  OS_CPU_CFG_SYSTICK_PRIO           0u
 
+/*
+*********************************************************************************************************
+*                                            TICKLESS IDLE
+*
+* Note(s) : (1) OS_CPU_CFG_TICKLESS_MIN_TICKS is the shortest idle period, in ticks, for which the tick is
+*               stopped.  Shorter periods keep the periodic tick since reprogramming SysTick costs more
+*               than it saves.
+*
+*           (2) The one-shot is limited by the 24-bit SysTick reload register: at 16 MHz and 1000 ticks
+*               per second the longest sleep is 1048 ticks.  The idle task wakes at least that often.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_CFG_TICKLESS_MIN_TICKS     2u
+
 /*
 *********************************************************************************************************
 *                                              DATA TYPES
@@ -184,6 +199,7 @@ void  OSStartHighRdy         (void);
                                                   /* See OS_CPU_C.C                                    */
 void  OS_CPU_SysTickHandler  (void);
 void  OS_CPU_SysTickInit     (INT32U ticksPerSec);
+void  OS_CPU_TicklessIdle    (void);
 
 #if (OS_CPU_ARM_FP_EN > 0u)
 void  OS_CPU_FP_Reg_Push     (OS_STK   *stkPtr);
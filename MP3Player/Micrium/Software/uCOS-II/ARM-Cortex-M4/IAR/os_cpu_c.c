@@ -59,6 +59,8 @@
 static  INT16U  OSTmrCtr;
 #endif
 
+static  INT32U  OS_CPU_TickReload;                              /* SysTick cycles per tick, 0 until SysTick is started  */
+
 
 
 /*
@@ -179,6 +181,9 @@ void  OSTaskDelHook (OS_TCB *ptcb)
 #if OS_CPU_HOOKS_EN > 0u
 void  OSTaskIdleHook (void)
 {
+#if OS_TICKLESS_EN > 0u
+    OS_CPU_TicklessIdle();                                      /* Sleep with the tick stopped until the next wakeup    */
+#endif
 #if OS_APP_HOOKS_EN > 0u
     App_TaskIdleHook();
 #endif
@@ -444,6 +449,8 @@ void  OSTaskSwHook (void)
     }
 #endif
     
+    OS_TRACE_TASK_SW();
+
 #if OS_APP_HOOKS_EN > 0u
     App_TaskSwHook();
 #endif
@@ -522,7 +529,14 @@ void  OS_CPU_SysTickHandler (void)
 
 
     OS_ENTER_CRITICAL();                                        /* Tell uC/OS-II that we are starting an ISR            */
+#if OS_TICKLESS_EN > 0u
+    if (SysTick->LOAD != OS_CPU_TickReload - 1u) {              /* End of a partial tick after an early wakeup ...      */
+        SysTick->LOAD = OS_CPU_TickReload - 1u;                 /* ... restore the periodic reload                      */
+        SysTick->VAL  = 0u;
+    }
+#endif
     OSIntNesting++;
+    OS_TRACE_INT_ENTER();
     OS_EXIT_CRITICAL();
 
     OSTimeTick();                                               /* Call uC/OS-II's OSTimeTick()                         */
@@ -548,6 +562,100 @@ void OS_CPU_SysTickInit(INT32U ticksPerSec)
 
     RCC_GetClocksFreq(&RCC_ClocksStatus);
     
-    SysTick_Config(RCC_ClocksStatus.HCLK_Frequency / OS_TICKS_PER_SEC);
+    OS_CPU_TickReload = RCC_ClocksStatus.HCLK_Frequency / OS_TICKS_PER_SEC;
+    SysTick_Config(OS_CPU_TickReload);
 }
 
+
+/*
+*********************************************************************************************************
+*                                            TICKLESS IDLE
+*
+* Description: Called by the idle task to stop the periodic tick while every task is waiting.  SysTick is
+*              reprogrammed as a one-shot that expires on the tick at which the first delay or timeout
+*              in the tick delta list ends, and the CPU sleeps in WFI until then or until another
+*              interrupt arrives.  On wakeup OSTime and the delta list are advanced by the number of
+*              whole ticks that elapsed and the periodic tick is restarted in phase with the old one.
+*
+* Arguments  : none
+*
+* Note(s)    : 1) Interrupts are disabled (PRIMASK) across WFI.  A pending interrupt still wakes the core
+*                 and is serviced once OS_EXIT_CRITICAL() re-enables interrupts, after the kernel time
+*                 has been corrected.
+*
+*              2) When the one-shot expires its SysTick interrupt stays pending, so the last tick of the
+*                 sleep is processed by OS_CPU_SysTickHandler() and OSTimeTick() readies the tasks as
+*                 usual.  OSTimeDly() semantics are unchanged.
+*
+*              3) The few cycles between the one-shot expiring and SysTick being reloaded are lost, so
+*                 OSTime drifts by that amount per sleep relative to an always-running tick.
+*
+*              4) The statistics task measures CPU usage by counting idle loops; time spent asleep is not
+*                 counted, so OSCPUUsage reads high in tickless mode.
+*********************************************************************************************************
+*/
+
+#if OS_TICKLESS_EN > 0u
+void  OS_CPU_TicklessIdle (void)
+{
+    OS_CPU_SR  cpu_sr;
+    INT32U     reload;
+    INT32U     ticks;
+    INT32U     max_ticks;
+    INT32U     cycles;
+    INT32U     elapsed;
+
+
+    reload = OS_CPU_TickReload;
+    if (reload == 0u) {                                         /* Tick not started yet                                 */
+        return;
+    }
+    max_ticks = (SysTick_LOAD_RELOAD_Msk + 1u) / reload;
+
+    OS_ENTER_CRITICAL();
+    ticks = OS_TickListNext();                                  /* Ticks until the first delay expires                  */
+    if ((ticks == 0u) || (ticks > max_ticks)) {                 /* Nothing delayed or too far away for SysTick          */
+        ticks = max_ticks;
+    }
+    if ((ticks < OS_CPU_CFG_TICKLESS_MIN_TICKS) ||              /* Not worth stopping the tick ...                      */
+        ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u)) {         /* ... or a tick is already pending                     */
+        OS_EXIT_CRITICAL();
+        return;
+    }
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;                  /* Stop the tick                                        */
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u) {           /* The tick expired while stopping it, let it run       */
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        OS_EXIT_CRITICAL();
+        return;
+    }
+    cycles = (reload - 1u) - SysTick->VAL;                      /* Cycles already spent in the current tick             */
+
+    SysTick->LOAD  = (ticks * reload) - cycles - 1u;            /* One-shot to the tick on which the delay expires      */
+    SysTick->VAL   = 0u;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    __DSB();
+    __WFI();                                                    /* Sleep until the one-shot or another interrupt        */
+    __ISB();
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u) {           /* One-shot expired: the whole sleep elapsed            */
+        OSTimeTickSkip(ticks - 1u);                             /* The pending SysTick processes the last tick          */
+        SysTick->LOAD = reload - 1u;
+        SysTick->VAL  = 0u;
+    } else {                                                    /* Woken early by another interrupt                     */
+        elapsed = (SysTick->LOAD - SysTick->VAL) + cycles;      /* Cycles since the last processed tick                 */
+        OSTimeTickSkip(elapsed / reload);                       /* Whole ticks that went by while asleep                */
+        cycles = reload - (elapsed % reload);                   /* Cycles left in the current tick                      */
+        if (cycles < 2u) {                                      /* SysTick does not count with a reload of 0            */
+            cycles = 2u;
+        }
+        SysTick->LOAD = cycles - 1u;                            /* Finish the current tick, the handler restores LOAD   */
+        SysTick->VAL  = 0u;
+    }
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    OS_EXIT_CRITICAL();
+}
+#endif
+
@@ -472,6 +472,7 @@ INT16U  OSEventPendMulti (OS_EVENT  **pevents_pend,
                                OS_STAT_MULTI;           /* ... pend on multiple events                 */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;                 /* Store pend timeout in TCB                   */
+    OS_TICK_LIST_INSERT(OSTCBCur, timeout);
     OS_EventTaskWaitMulti(pevents_pend);                /* Suspend task until events or timeout occurs */
 
     OS_EXIT_CRITICAL();
@@ -638,6 +639,7 @@ void  OSIntEnter (void)
         if (OSIntNesting < 255u) {
             OSIntNesting++;                      /* Increment ISR nesting level                        */
         }
+        OS_TRACE_INT_ENTER();
     }
 }
 /*$PAGE*/
@@ -670,6 +672,7 @@ void  OSIntExit (void)
 
     if (OSRunning == OS_TRUE) {
         OS_ENTER_CRITICAL();
+        OS_TRACE_INT_EXIT();
         if (OSIntNesting > 0u) {                           /* Prevent OSIntNesting from wrapping       */
             OSIntNesting--;
         }
@@ -931,6 +934,36 @@ void  OSTimeTick (void)
             return;
         }
 #endif
+#if OS_TICK_LIST_EN > 0u
+        OS_ENTER_CRITICAL();
+        ptcb = OSTickList;                                 /* Only the head of the delta list counts down  */
+        if (ptcb != (OS_TCB *)0) {
+            ptcb->OSTCBTickDelta--;
+            while ((ptcb != (OS_TCB *)0) &&                /* Ready every TCB that has now expired         */
+                   (ptcb->OSTCBTickDelta == 0u)) {
+                OSTickList = ptcb->OSTCBTickNext;
+                if (OSTickList != (OS_TCB *)0) {
+                    OSTickList->OSTCBTickPrev = (OS_TCB *)0;
+                }
+                ptcb->OSTCBTickNext = (OS_TCB *)0;
+                ptcb->OSTCBDly      = 0u;                  /* Delay or timeout has expired                 */
+
+                if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
+                    ptcb->OSTCBStat  &= (INT8U)~(INT8U)OS_STAT_PEND_ANY;          /* Yes, Clear status flag   */
+                    ptcb->OSTCBStatPend = OS_STAT_PEND_TO;                 /* Indicate PEND timeout    */
+                } else {
+                    ptcb->OSTCBStatPend = OS_STAT_PEND_OK;
+                }
+
+                if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {  /* Is task suspended?       */
+                    OSRdyGrp               |= ptcb->OSTCBBitY;             /* No,  Make ready          */
+                    OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+                }
+                ptcb = OSTickList;
+            }
+        }
+        OS_EXIT_CRITICAL();
+#else
         ptcb = OSTCBList;                                  /* Point at first TCB in TCB list               */
         while (ptcb->OSTCBPrio != OS_TASK_IDLE_PRIO) {     /* Go through all TCBs in TCB list              */
             OS_ENTER_CRITICAL();
@@ -954,6 +987,7 @@ void  OSTimeTick (void)
             ptcb = ptcb->OSTCBNext;                        /* Point at next TCB in TCB list                */
             OS_EXIT_CRITICAL();
         }
+#endif
     }
 }
 
@@ -1060,6 +1094,7 @@ INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
 
     ptcb                  =  OSTCBPrioTbl[prio];        /* Point to this task's OS_TCB                 */
     ptcb->OSTCBDly        =  0u;                        /* Prevent OSTimeTick() from readying task     */
+    OS_TICK_LIST_REMOVE(ptcb);
 #if ((OS_Q_EN > 0u) && (OS_MAX_QS > 0u)) || (OS_MBOX_EN > 0u)
     ptcb->OSTCBMsg        =  pmsg;                      /* Send message directly to waiting task       */
 #else
@@ -1545,6 +1580,9 @@ static  void  OS_InitTCBList (void)
 #endif
     OSTCBList               = (OS_TCB *)0;                       /* TCB lists initializations          */
     OSTCBFreeList           = &OSTCBTbl[0];
+#if OS_TICK_LIST_EN > 0u
+    OSTickList              = (OS_TCB *)0;                       /* No task delayed yet                */
+#endif
 }
 /*$PAGE*/
 /*
@@ -1873,6 +1911,134 @@ void  OS_TaskStatStkChk (void)
 /*$PAGE*/
 /*
 *********************************************************************************************************
+*                                   INSERT A TASK IN THE TICK DELTA LIST
+*
+* Description: This function links a delayed task into the tick delta list.  The list is sorted by expiry
+*              and each TCB holds the number of ticks between its own expiry and that of the TCB before
+*              it, so OSTimeTick() only has to decrement the head of the list and remove the TCBs whose
+*              delta has reached 0.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the task to delay.
+*
+*              ticks         is the number of ticks to delay the task.  0 means no timeout and the task is
+*                            not placed in the list.
+*
+* Returns    : none
+*
+* Note       : 1) This function assumes that interrupts are disabled.
+*              2) Insertion walks the list, so its cost grows with the number of delayed tasks.  The walk
+*                 happens at task level instead of in the tick ISR.
+*              3) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+#if OS_TICK_LIST_EN > 0u
+void  OS_TickListInsert (OS_TCB  *ptcb,
+                         INT32U   ticks)
+{
+    OS_TCB  *pprev;
+    OS_TCB  *pnext;
+
+
+    OS_TickListRemove(ptcb);                           /* Make sure the TCB is not linked twice        */
+    if (ticks == 0u) {                                 /* 0 means wait forever                         */
+        return;
+    }
+    pprev = (OS_TCB *)0;
+    pnext = OSTickList;
+    while ((pnext != (OS_TCB *)0) &&                   /* Find the first TCB expiring after this one   */
+           (pnext->OSTCBTickDelta <= ticks)) {
+        ticks -= pnext->OSTCBTickDelta;
+        pprev  = pnext;
+        pnext  = pnext->OSTCBTickNext;
+    }
+    ptcb->OSTCBTickDelta = ticks;
+    ptcb->OSTCBTickPrev  = pprev;
+    ptcb->OSTCBTickNext  = pnext;
+    if (pnext != (OS_TCB *)0) {                        /* Following TCB now expires relative to us     */
+        pnext->OSTCBTickDelta -= ticks;
+        pnext->OSTCBTickPrev   = ptcb;
+    }
+    if (pprev != (OS_TCB *)0) {
+        pprev->OSTCBTickNext = ptcb;
+    } else {
+        OSTickList           = ptcb;                   /* New head of the list                         */
+    }
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                  REMOVE A TASK FROM THE TICK DELTA LIST
+*
+* Description: This function unlinks a task from the tick delta list when its delay is cancelled before
+*              it expires (event posted, OSTimeDlyResume(), OSTaskDel(), ...).  The remaining ticks of the
+*              task are handed to the TCB following it so that the expiry of later tasks is unchanged.
+*
+* Arguments  : ptcb          is a pointer to the TCB of the task.  Nothing is done if the task is not in
+*                            the list.
+*
+* Returns    : none
+*
+* Note       : 1) This function assumes that interrupts are disabled.
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+void  OS_TickListRemove (OS_TCB  *ptcb)
+{
+    OS_TCB  *pprev;
+    OS_TCB  *pnext;
+
+
+    pprev = ptcb->OSTCBTickPrev;
+    pnext = ptcb->OSTCBTickNext;
+    if ((pprev == (OS_TCB *)0) && (OSTickList != ptcb)) {
+        return;                                        /* Not in the list                              */
+    }
+    if (pnext != (OS_TCB *)0) {
+        pnext->OSTCBTickDelta += ptcb->OSTCBTickDelta;
+        pnext->OSTCBTickPrev   = pprev;
+    }
+    if (pprev != (OS_TCB *)0) {
+        pprev->OSTCBTickNext = pnext;
+    } else {
+        OSTickList           = pnext;
+    }
+    ptcb->OSTCBTickNext  = (OS_TCB *)0;
+    ptcb->OSTCBTickPrev  = (OS_TCB *)0;
+    ptcb->OSTCBTickDelta = 0u;
+}
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                   GET THE NUMBER OF TICKS TO THE NEXT EXPIRY
+*
+* Description: This function returns the number of ticks until the first delay or pend timeout in the
+*              tick delta list expires.  The tickless idle code uses it to decide how long the tick can be
+*              stopped.
+*
+* Arguments  : none
+*
+* Returns    : the number of ticks to the next expiry, or 0 if no task is delayed.
+*
+* Note       : 1) This function assumes that interrupts are disabled.
+*              2) This function is INTERNAL to uC/OS-II and your application should not call it.
+*********************************************************************************************************
+*/
+
+INT32U  OS_TickListNext (void)
+{
+    if (OSTickList == (OS_TCB *)0) {
+        return (0u);
+    }
+    return (OSTickList->OSTCBTickDelta);
+}
+#endif
+/*$PAGE*/
+/*
+*********************************************************************************************************
 *                                            INITIALIZE TCB
 *
 * Description: This function is internal to uC/OS-II and is used to initialize a Task Control Block when
@@ -1941,6 +2107,11 @@ INT8U  OS_TCBInit (INT8U    prio,
         ptcb->OSTCBStat          = OS_STAT_RDY;            /* Task is ready to run                     */
         ptcb->OSTCBStatPend      = OS_STAT_PEND_OK;        /* Clear pend status                        */
         ptcb->OSTCBDly           = 0u;                     /* Task is not delayed                      */
+#if OS_TICK_LIST_EN > 0u
+        ptcb->OSTCBTickNext      = (OS_TCB *)0;            /* Task is not in the tick delta list       */
+        ptcb->OSTCBTickPrev      = (OS_TCB *)0;
+        ptcb->OSTCBTickDelta     = 0u;
+#endif
 
 #if OS_TASK_CREATE_EXT_EN > 0u
         ptcb->OSTCBExtPtr        = pext;                   /* Store pointer to TCB extension           */
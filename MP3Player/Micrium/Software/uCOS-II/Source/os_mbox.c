@@ -325,6 +325,8 @@ void  *OSMboxPend (OS_EVENT  *pevent,
     OSTCBCur->OSTCBStat     |= OS_STAT_MBOX;          /* Message not available, task will pend         */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;               /* Load timeout in TCB                           */
+    OS_TICK_LIST_INSERT(OSTCBCur, timeout);
+    OS_TRACE_PEND(OS_TRACE_TYPE_MBOX_PEND, pevent);
     OS_EventTaskWait(pevent);                         /* Suspend task until event or timeout occurs    */
     OS_EXIT_CRITICAL();
     OS_Sched();                                       /* Find next highest priority task ready to run  */
@@ -354,6 +356,7 @@ void  *OSMboxPend (OS_EVENT  *pevent,
     OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
 #endif
     OSTCBCur->OSTCBMsg           = (void      *)0;    /* Clear  received message                       */
+    OS_TRACE_PEND_DONE(OS_TRACE_TYPE_MBOX_PEND, pevent);
     OS_EXIT_CRITICAL();
     return (pmsg);                                    /* Return received message                       */
 }
@@ -491,6 +494,7 @@ INT8U  OSMboxPost (OS_EVENT  *pevent,
         return (OS_ERR_EVENT_TYPE);
     }
     OS_ENTER_CRITICAL();
+    OS_TRACE_POST(OS_TRACE_TYPE_MBOX_POST, pevent);
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on mailbox            */
                                                       /* Ready HPT waiting on event                    */
         (void)OS_EventTaskRdy(pevent, pmsg, OS_STAT_MBOX, OS_STAT_PEND_OK);
@@ -564,6 +568,7 @@ INT8U  OSMboxPostOpt (OS_EVENT  *pevent,
         return (OS_ERR_EVENT_TYPE);
     }
     OS_ENTER_CRITICAL();
+    OS_TRACE_POST(OS_TRACE_TYPE_MBOX_POST, pevent);
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on mailbox            */
         if ((opt & OS_POST_OPT_BROADCAST) != 0x00u) { /* Do we need to post msg to ALL waiting tasks ? */
             while (pevent->OSEventGrp != 0u) {        /* Yes, Post to ALL tasks waiting on mailbox     */
@@ -449,6 +449,8 @@ void  *OSQPend (OS_EVENT  *pevent,
     OSTCBCur->OSTCBStat     |= OS_STAT_Q;        /* Task will have to pend for a message to be posted  */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;          /* Load timeout into TCB                              */
+    OS_TICK_LIST_INSERT(OSTCBCur, timeout);
+    OS_TRACE_PEND(OS_TRACE_TYPE_Q_PEND, pevent);
     OS_EventTaskWait(pevent);                    /* Suspend task until event or timeout occurs         */
     OS_EXIT_CRITICAL();
     OS_Sched();                                  /* Find next highest priority task ready to run       */
@@ -478,6 +480,7 @@ void  *OSQPend (OS_EVENT  *pevent,
     OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
 #endif
     OSTCBCur->OSTCBMsg           = (void      *)0;    /* Clear  received message                       */
+    OS_TRACE_PEND_DONE(OS_TRACE_TYPE_Q_PEND, pevent);
     OS_EXIT_CRITICAL();
     return (pmsg);                                    /* Return received message                       */
 }
@@ -610,6 +613,7 @@ INT8U  OSQPost (OS_EVENT  *pevent,
         return (OS_ERR_EVENT_TYPE);
     }
     OS_ENTER_CRITICAL();
+    OS_TRACE_POST(OS_TRACE_TYPE_Q_POST, pevent);
     if (pevent->OSEventGrp != 0u) {                    /* See if any task pending on queue             */
                                                        /* Ready highest priority task waiting on event */
         (void)OS_EventTaskRdy(pevent, pmsg, OS_STAT_Q, OS_STAT_PEND_OK);
@@ -673,6 +677,7 @@ INT8U  OSQPostFront (OS_EVENT  *pevent,
         return (OS_ERR_EVENT_TYPE);
     }
     OS_ENTER_CRITICAL();
+    OS_TRACE_POST(OS_TRACE_TYPE_Q_POST, pevent);
     if (pevent->OSEventGrp != 0u) {                   /* See if any task pending on queue              */
                                                       /* Ready highest priority task waiting on event  */
         (void)OS_EventTaskRdy(pevent, pmsg, OS_STAT_Q, OS_STAT_PEND_OK);
@@ -746,6 +751,7 @@ INT8U  OSQPostOpt (OS_EVENT  *pevent,
         return (OS_ERR_EVENT_TYPE);
     }
     OS_ENTER_CRITICAL();
+    OS_TRACE_POST(OS_TRACE_TYPE_Q_POST, pevent);
     if (pevent->OSEventGrp != 0x00u) {                /* See if any task pending on queue              */
         if ((opt & OS_POST_OPT_BROADCAST) != 0x00u) { /* Do we need to post msg to ALL waiting tasks ? */
             while (pevent->OSEventGrp != 0u) {        /* Yes, Post to ALL tasks waiting on queue       */
@@ -331,6 +331,8 @@ void  OSSemPend (OS_EVENT  *pevent,
     OSTCBCur->OSTCBStat     |= OS_STAT_SEM;           /* Resource not available, pend on semaphore     */
     OSTCBCur->OSTCBStatPend  = OS_STAT_PEND_OK;
     OSTCBCur->OSTCBDly       = timeout;               /* Store pend timeout in TCB                     */
+    OS_TICK_LIST_INSERT(OSTCBCur, timeout);
+    OS_TRACE_PEND(OS_TRACE_TYPE_SEM_PEND, pevent);
     OS_EventTaskWait(pevent);                         /* Suspend task until event or timeout occurs    */
     OS_EXIT_CRITICAL();
     OS_Sched();                                       /* Find next highest priority task ready         */
@@ -356,6 +358,7 @@ void  OSSemPend (OS_EVENT  *pevent,
 #if (OS_EVENT_MULTI_EN > 0u)
     OSTCBCur->OSTCBEventMultiPtr = (OS_EVENT **)0;
 #endif
+    OS_TRACE_PEND_DONE(OS_TRACE_TYPE_SEM_PEND, pevent);
     OS_EXIT_CRITICAL();
 }
 
@@ -485,6 +488,7 @@ INT8U  OSSemPost (OS_EVENT *pevent)
         return (OS_ERR_EVENT_TYPE);
     }
     OS_ENTER_CRITICAL();
+    OS_TRACE_POST(OS_TRACE_TYPE_SEM_POST, pevent);
     if (pevent->OSEventGrp != 0u) {                   /* See if any task waiting for semaphore         */
                                                       /* Ready HPT waiting on event                    */
         (void)OS_EventTaskRdy(pevent, (void *)0, OS_STAT_SEM, OS_STAT_PEND_OK);
@@ -489,6 +489,7 @@ INT8U  OSTaskDel (INT8U prio)
 #endif
 
     ptcb->OSTCBDly      = 0u;                           /* Prevent OSTimeTick() from updating          */
+    OS_TICK_LIST_REMOVE(ptcb);
     ptcb->OSTCBStat     = OS_STAT_RDY;                  /* Prevent task from being resumed             */
     ptcb->OSTCBStatPend = OS_STAT_PEND_OK;
     if (OSLockNesting < 255u) {                         /* Make sure we don't context switch           */
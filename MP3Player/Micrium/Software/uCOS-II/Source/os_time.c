@@ -64,6 +64,7 @@ void  OSTimeDly (INT32U ticks)
             OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
         }
         OSTCBCur->OSTCBDly = ticks;              /* Load ticks in TCB                                  */
+        OS_TICK_LIST_INSERT(OSTCBCur, ticks);
         OS_EXIT_CRITICAL();
         OS_Sched();                              /* Find next task to run!                             */
     }
@@ -187,6 +188,7 @@ INT8U  OSTimeDlyResume (INT8U prio)
     }
 
     ptcb->OSTCBDly = 0u;                                       /* Clear the time delay                 */
+    OS_TICK_LIST_REMOVE(ptcb);
     if ((ptcb->OSTCBStat & OS_STAT_PEND_ANY) != OS_STAT_RDY) {
         ptcb->OSTCBStat     &= ~OS_STAT_PEND_ANY;              /* Yes, Clear status flag               */
         ptcb->OSTCBStatPend  =  OS_STAT_PEND_TO;               /* Indicate PEND timeout                */
@@ -260,5 +262,40 @@ void  OSTimeSet (INT32U ticks)
     OSTime = ticks;
     OS_EXIT_CRITICAL();
 }
+#endif
+
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                         ACCOUNT FOR SKIPPED TICKS
+*
+* Description: This function is called by the tickless idle code of the port when the tick interrupt was
+*              stopped for one or more tick periods.  It advances OSTime and the tick delta list as if
+*              OSTimeTick() had been called 'ticks' times.
+*
+* Arguments  : ticks      is the number of tick periods that elapsed without a tick interrupt.  It MUST be
+*                         lower than the value returned by OS_TickListNext() before the tick was stopped so
+*                         that no delay expires here; the final tick is always processed by OSTimeTick().
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function assumes that interrupts are disabled.
+*              2) OSTimeTickHook() is not called for the skipped ticks.
+*********************************************************************************************************
+*/
+
+#if OS_TICKLESS_EN > 0u
+void  OSTimeTickSkip (INT32U ticks)
+{
+    if (ticks == 0u) {
+        return;
+    }
+#if OS_TIME_GET_SET_EN > 0u
+    OSTime += ticks;                             /* Update the 32-bit tick counter                     */
+#endif
+    if (OSTickList != (OS_TCB *)0) {             /* Head of delta list counts down for every tick      */
+        OSTickList->OSTCBTickDelta -= ticks;
+    }
+}
 #endif
 	 	   	  		 			 	    		   		 		 	 	 			 	    		   	 			 	  	 		 				 		  			 		 					 	  	  		      		  	   		      		  	 		 	      		   		 		  	 		 	      		  		  		  
@@ -565,6 +565,11 @@ typedef struct os_tcb {
 #endif
 
     INT32U           OSTCBDly;              /* Nbr ticks to delay task or, timeout waiting for event   */
+#if OS_TICK_LIST_EN > 0u                    /* With the delta list OSTCBDly is only cleared on expiry  */
+    struct os_tcb   *OSTCBTickNext;         /* Pointer to next     TCB in the tick delta list          */
+    struct os_tcb   *OSTCBTickPrev;         /* Pointer to previous TCB in the tick delta list          */
+    INT32U           OSTCBTickDelta;        /* Nbr ticks after the previous TCB in the delta list      */
+#endif
     INT8U            OSTCBStat;             /* Task      status                                        */
     INT8U            OSTCBStatPend;         /* Task PEND status                                        */
     INT8U            OSTCBPrio;             /* Task priority (0 == highest)                            */
@@ -688,6 +693,9 @@ OS_EXT  OS_TCB           *OSTCBCur;                        /* Pointer to current
 OS_EXT  OS_TCB           *OSTCBFreeList;                   /* Pointer to list of free TCBs             */
 OS_EXT  OS_TCB           *OSTCBHighRdy;                    /* Pointer to highest priority TCB R-to-R   */
 OS_EXT  OS_TCB           *OSTCBList;                       /* Pointer to doubly linked list of TCBs    */
+#if OS_TICK_LIST_EN > 0u
+OS_EXT  OS_TCB           *OSTickList;                      /* Delta list of delayed TCBs, soonest first*/
+#endif
 OS_EXT  OS_TCB           *OSTCBPrioTbl[OS_LOWEST_PRIO + 1u];    /* Table of pointers to created TCBs   */
 OS_EXT  OS_TCB            OSTCBTbl[OS_MAX_TASKS + OS_N_SYS_TASKS];   /* Table of TCBs                  */
 
@@ -1135,6 +1143,10 @@ void          OSTimeSet               (INT32U           ticks);
 
 void          OSTimeTick              (void);
 
+#if OS_TICKLESS_EN > 0u
+void          OSTimeTickSkip          (INT32U           ticks);
+#endif
+
 /*
 *********************************************************************************************************
 *                                            TIMER MANAGEMENT
@@ -1256,6 +1268,21 @@ void          OS_QInit                (void);
 
 void          OS_Sched                (void);
 
+#if OS_TICK_LIST_EN > 0u
+void          OS_TickListInsert       (OS_TCB          *ptcb,
+                                       INT32U           ticks);
+
+void          OS_TickListRemove       (OS_TCB          *ptcb);
+
+INT32U        OS_TickListNext         (void);
+
+#define  OS_TICK_LIST_INSERT(ptcb, ticks)  OS_TickListInsert((ptcb), (ticks))
+#define  OS_TICK_LIST_REMOVE(ptcb)         OS_TickListRemove((ptcb))
+#else
+#define  OS_TICK_LIST_INSERT(ptcb, ticks)
+#define  OS_TICK_LIST_REMOVE(ptcb)
+#endif
+
 #if (OS_EVENT_NAME_EN > 0u) || (OS_FLAG_NAME_EN > 0u) || (OS_MEM_NAME_EN > 0u) || (OS_TASK_NAME_EN > 0u)
 INT8U         OS_StrLen               (INT8U           *psrc);
 #endif
@@ -1356,6 +1383,49 @@ void          App_TimeTickHook        (void);
 #endif
 #endif
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                            EVENT TRACE HOOKS
+*
+* Note(s) : 1) OS_TraceRecord() is implemented by the trace recorder (see Util/trace.c).  It stores one
+*              compact, timestamped record per call in a RAM ring buffer.
+*           2) Event records carry the index of the ECB in OSEventTbl[] so the host decoder can name them.
+*********************************************************************************************************
+*/
+
+#define  OS_TRACE_TYPE_TASK_SW       0x01u              /* Context switch, arg = prio switched in      */
+#define  OS_TRACE_TYPE_INT_ENTER     0x02u              /* ISR entry,      arg = exception number      */
+#define  OS_TRACE_TYPE_INT_EXIT      0x03u              /* ISR exit,       arg = exception number      */
+#define  OS_TRACE_TYPE_SEM_POST      0x10u              /* Event records,  arg = index in OSEventTbl[] */
+#define  OS_TRACE_TYPE_SEM_PEND      0x11u
+#define  OS_TRACE_TYPE_MBOX_POST     0x12u
+#define  OS_TRACE_TYPE_MBOX_PEND     0x13u
+#define  OS_TRACE_TYPE_Q_POST        0x14u
+#define  OS_TRACE_TYPE_Q_PEND        0x15u
+#define  OS_TRACE_TYPE_PEND_DONE     0x80u              /* OR'ed with a PEND type when the task resumes */
+#define  OS_TRACE_TYPE_USER          0x40u              /* Application markers 0x40..0x7F              */
+
+#if OS_TRACE_EN > 0u
+void          OS_TraceRecord          (INT8U            type,
+                                       INT16U           arg);
+
+#define  OS_TRACE_TASK_SW()                OS_TraceRecord(OS_TRACE_TYPE_TASK_SW, (INT16U)OSPrioHighRdy)
+#define  OS_TRACE_INT_ENTER()              OS_TraceRecord(OS_TRACE_TYPE_INT_ENTER, 0u)
+#define  OS_TRACE_INT_EXIT()               OS_TraceRecord(OS_TRACE_TYPE_INT_EXIT, 0u)
+#define  OS_TRACE_POST(type, pevent)       OS_TraceRecord((type), (INT16U)((pevent) - OSEventTbl))
+#define  OS_TRACE_PEND(type, pevent)       OS_TraceRecord((type), (INT16U)((pevent) - OSEventTbl))
+#define  OS_TRACE_PEND_DONE(type, pevent)  OS_TraceRecord((INT8U)((type) | OS_TRACE_TYPE_PEND_DONE), \
+                                                          (INT16U)((pevent) - OSEventTbl))
+#else
+#define  OS_TRACE_TASK_SW()
+#define  OS_TRACE_INT_ENTER()
+#define  OS_TRACE_INT_EXIT()
+#define  OS_TRACE_POST(type, pevent)
+#define  OS_TRACE_PEND(type, pevent)
+#define  OS_TRACE_PEND_DONE(type, pevent)
+#endif
+
 /*
 *********************************************************************************************************
 *                                          FUNCTION PROTOTYPES
@@ -1805,6 +1875,25 @@ void          OSCtxSw                 (void);
 #error  "OS_CFG.H, Missing OS_TIME_TICK_HOOK_EN: Allows you to include the code for OSTimeTickHook() or not"
 #endif
 
+
+#ifndef OS_TICK_LIST_EN
+#define OS_TICK_LIST_EN           0u                    /* Default to the original scan of all TCBs    */
+#endif
+
+
+#ifndef OS_TICKLESS_EN
+#define OS_TICKLESS_EN            0u                    /* Tickless idle is optional, default to off   */
+#endif
+
+#if    (OS_TICKLESS_EN > 0u) && (OS_TICK_LIST_EN == 0u)
+#error  "OS_CFG.H, OS_TICKLESS_EN requires OS_TICK_LIST_EN to find the next wakeup"
+#endif
+
+
+#ifndef OS_TRACE_EN
+#define OS_TRACE_EN               0u                    /* Trace recorder is optional, default to off  */
+#endif
+
 /*
 *********************************************************************************************************
 *                                         SAFETY CRITICAL USE
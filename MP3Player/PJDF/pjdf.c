@@ -205,6 +205,7 @@ PjdfErrCode Ioctl(HANDLE handle, INT8U request, void* pArgs, INT32U* pSize)
 PjdfErrCode InitPjdf()
 {
     PjdfErrCode retval = PJDF_ERR_NONE;
+    INT8U osErr;
     for (int i = 0; i < MAXDEVICES; i++)
     {
         retval = driversInternal[i].Init(&driversInternal[i], DeviceDriverIDs[i]);
@@ -212,6 +213,9 @@ PjdfErrCode InitPjdf()
         {
             while (1); // a driver Init() function failed
         }
+        
+        // Name the device lock after the device so it can be identified in traces
+        OSEventNameSet(driversInternal[i].sem, (INT8U*)driversInternal[i].pName, &osErr);
     }
     
     return retval;
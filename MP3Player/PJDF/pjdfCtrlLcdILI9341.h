@@ -19,4 +19,25 @@
 
 #define PJDF_CTRL_LCD_SET_SPI_HANDLE 0x3  // Passes the required SPI handle to the LCD driver to enable it to talk to the ILI9341
 
+#define PJDF_CTRL_LCD_FILL 0x4            // Send a LcdFillArgs color count times as data, e.g. to fill the address window
+
+// Asynchronous pixel block. START locks the SPI bus and returns while the block goes out by DMA;
+// WAIT must follow before any other LCD request and releases the bus again.
+#define PJDF_CTRL_LCD_WRITE_PIXELS_START 0x5  // Start sending the LcdPixelsArgs block as data
+#define PJDF_CTRL_LCD_WRITE_PIXELS_WAIT 0x6   // Wait for the block to finish
+
+// Argument for PJDF_CTRL_LCD_FILL
+typedef struct _LcdFillArgs
+{
+    INT16U color;   // RGB565
+    INT32U count;   // pixels
+} LcdFillArgs;
+
+// Argument for PJDF_CTRL_LCD_WRITE_PIXELS_START
+typedef struct _LcdPixelsArgs
+{
+    const INT16U *pPixels;  // RGB565 in native byte order; must not change until the wait
+    INT32U count;           // pixels, at most 65535
+} LcdPixelsArgs;
+
 #endif
\ No newline at end of file
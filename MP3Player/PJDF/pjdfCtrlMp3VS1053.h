@@ -19,4 +19,14 @@
 
 #define PJDF_CTRL_MP3_SET_SPI_HANDLE 0x3  // Passes the required SPI handle to the MP3 driver to enable it to talk to the VS1053
 
+#define PJDF_CTRL_MP3_SET_DREQ_FLAG 0x4   // Pass a Mp3DreqFlag: the flags are set from an interrupt each time DREQ rises
+#define PJDF_CTRL_MP3_IS_READY 0x5        // Returns in a BOOLEAN whether DREQ is high, i.e. a write will not have to wait
+
+// Argument for PJDF_CTRL_MP3_SET_DREQ_FLAG
+typedef struct _Mp3DreqFlag
+{
+    OS_FLAG_GRP *pFlagGrp;  // group to post to
+    OS_FLAGS flags;         // bits to set
+} Mp3DreqFlag;
+
 #endif
\ No newline at end of file
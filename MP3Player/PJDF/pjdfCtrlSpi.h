@@ -16,5 +16,22 @@
 #define PJDF_CTRL_SPI_WAIT_FOR_LOCK  0x01   // Wait for exclusive access to SPI, then lock it
 #define PJDF_CTRL_SPI_RELEASE_LOCK   0x02   // Release exclusive SPI lock
 #define PJDF_CTRL_SPI_SET_DATARATE   0x03   // Set transmission rate of the SPI interface
+#define PJDF_CTRL_SPI_WRITE_REPEATED 0x04   // Send a SpiRepeatArgs value count times, by DMA where available
+#define PJDF_CTRL_SPI_WRITE_BLOCK_START 0x05 // Start sending SpiBlockArgs 16 bit values by DMA and return at once
+#define PJDF_CTRL_SPI_WRITE_BLOCK_WAIT 0x06 // Wait for the block started above to finish
+
+// Argument for PJDF_CTRL_SPI_WRITE_REPEATED
+typedef struct _SpiRepeatArgs
+{
+    INT16U value;   // sent high byte first
+    INT32U count;   // number of times to send it
+} SpiRepeatArgs;
+
+// Argument for PJDF_CTRL_SPI_WRITE_BLOCK_START
+typedef struct _SpiBlockArgs
+{
+    const INT16U *pValues;  // each sent high byte first; must not change until the wait
+    INT16U count;           // number of values
+} SpiBlockArgs;
 
 #endif
\ No newline at end of file
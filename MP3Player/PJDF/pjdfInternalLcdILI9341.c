@@ -17,6 +17,7 @@
 typedef struct _PjdfContextLcdILI9341
 {
     HANDLE spiHandle; // SPI communication link to ILI9341
+    BOOLEAN pixelsBusy; // PJDF_CTRL_LCD_WRITE_PIXELS_START holds the SPI lock
 } PjdfContextLcdILI9341;
 
 static PjdfContextLcdILI9341 ili9341Context = { 0 };
@@ -24,6 +25,10 @@ static PjdfContextLcdILI9341 ili9341Context = { 0 };
 static const INT16U LcdSpiDataRate = LCD_SPI_DATARATE;
 static const INT32U SizeofLcdSpiDataRate = sizeof(LcdSpiDataRate);
 
+// Pixels sent per hold of the SPI lock by a fill, about 8 ms at the LCD data
+// rate, so the MP3 decoder sharing the bus is not starved during a full screen fill
+#define LCD_FILL_CHUNK_PIXELS 4096
+
 
 // OpenLCD
 // Nothing to do.
@@ -112,6 +117,81 @@ static PjdfErrCode WriteLCD(DriverInternal *pDriver, void* pBuffer, INT32U* pCou
     return retval;
 }
 
+// FillLCD
+// Sends the color count times with DC as currently selected, normally data.
+// The SPI driver does the repetition (by DMA on SPI1) so the CPU is free.
+static PjdfErrCode FillLCD(PjdfContextLcdILI9341 *pContext, INT16U color, INT32U count)
+{
+    PjdfErrCode retval;
+    HANDLE hSPI = pContext->spiHandle;
+    SpiRepeatArgs repeat;
+    INT32U size = sizeof(repeat);
+
+    repeat.value = color;
+    while (count > 0)
+    {
+        repeat.count = count < LCD_FILL_CHUNK_PIXELS ? count : LCD_FILL_CHUNK_PIXELS;
+        count -= repeat.count;
+
+        retval = Ioctl(hSPI, PJDF_CTRL_SPI_WAIT_FOR_LOCK, 0, 0);  // wait for exclusive access
+        if (retval != PJDF_ERR_NONE) while(1);
+
+        retval = Ioctl(hSPI, PJDF_CTRL_SPI_SET_DATARATE, (void*)&LcdSpiDataRate, (INT32U*)&SizeofLcdSpiDataRate); 
+        if (retval != PJDF_ERR_NONE) while(1);
+
+        LCD_ILI9341_CS_ASSERT(); // assert LCD SPI
+        retval = Ioctl(hSPI, PJDF_CTRL_SPI_WRITE_REPEATED, &repeat, &size);
+        LCD_ILI9341_CS_DEASSERT(); // de-assert LCD SPI
+
+        retval = Ioctl(hSPI, PJDF_CTRL_SPI_RELEASE_LOCK, 0, 0);
+        if (retval != PJDF_ERR_NONE) while(1);
+    }
+    return PJDF_ERR_NONE;
+}
+
+// StartPixelsLCD
+// Takes the SPI lock, selects the LCD and starts the block going out by DMA.
+// The lock is held until WaitPixelsLCD().
+static PjdfErrCode StartPixelsLCD(PjdfContextLcdILI9341 *pContext, const INT16U *pPixels, INT32U count)
+{
+    PjdfErrCode retval;
+    HANDLE hSPI = pContext->spiHandle;
+    SpiBlockArgs block;
+    INT32U size = sizeof(block);
+
+    if (count > SPI_DMA_MAX_ITEMS || pContext->pixelsBusy) return PJDF_ERR_ARG;
+
+    retval = Ioctl(hSPI, PJDF_CTRL_SPI_WAIT_FOR_LOCK, 0, 0);  // wait for exclusive access
+    if (retval != PJDF_ERR_NONE) while(1);
+
+    retval = Ioctl(hSPI, PJDF_CTRL_SPI_SET_DATARATE, (void*)&LcdSpiDataRate, (INT32U*)&SizeofLcdSpiDataRate); 
+    if (retval != PJDF_ERR_NONE) while(1);
+
+    block.pValues = pPixels;
+    block.count = (INT16U)count;
+    LCD_ILI9341_CS_ASSERT(); // assert LCD SPI
+    pContext->pixelsBusy = OS_TRUE;
+    return Ioctl(hSPI, PJDF_CTRL_SPI_WRITE_BLOCK_START, &block, &size);
+}
+
+// WaitPixelsLCD
+// Waits for the block started by StartPixelsLCD() and releases the SPI lock.
+static PjdfErrCode WaitPixelsLCD(PjdfContextLcdILI9341 *pContext)
+{
+    PjdfErrCode retval;
+    HANDLE hSPI = pContext->spiHandle;
+
+    if (!pContext->pixelsBusy) return PJDF_ERR_NONE;
+
+    Ioctl(hSPI, PJDF_CTRL_SPI_WRITE_BLOCK_WAIT, 0, 0);
+    LCD_ILI9341_CS_DEASSERT(); // de-assert LCD SPI
+    pContext->pixelsBusy = OS_FALSE;
+
+    retval = Ioctl(hSPI, PJDF_CTRL_SPI_RELEASE_LOCK, 0, 0);
+    if (retval != PJDF_ERR_NONE) while(1);
+    return retval;
+}
+
 // IoctlLCD
 // pDriver: pointer to an initialized ILI9341 LCD driver
 // request: a request code chosen from those in pjdfCtrlLcdILI9341.h
@@ -143,6 +223,23 @@ static PjdfErrCode IoctlLCD(DriverInternal *pDriver, INT8U request, void* pArgs,
         }
         pContext->spiHandle = handle;
         break;
+    case PJDF_CTRL_LCD_FILL:
+        if (*pSize < sizeof(LcdFillArgs))
+        {
+            return PJDF_ERR_ARG;
+        }
+        retval = FillLCD(pContext, ((LcdFillArgs*)pArgs)->color, ((LcdFillArgs*)pArgs)->count);
+        break;
+    case PJDF_CTRL_LCD_WRITE_PIXELS_START:
+        if (*pSize < sizeof(LcdPixelsArgs))
+        {
+            return PJDF_ERR_ARG;
+        }
+        retval = StartPixelsLCD(pContext, ((LcdPixelsArgs*)pArgs)->pPixels, ((LcdPixelsArgs*)pArgs)->count);
+        break;
+    case PJDF_CTRL_LCD_WRITE_PIXELS_WAIT:
+        retval = WaitPixelsLCD(pContext);
+        break;
     default:
         retval = PJDF_ERR_UNKNOWN_CTRL_REQUEST;
         break;
@@ -177,6 +177,20 @@ static PjdfErrCode IoctlMP3(DriverInternal *pDriver, INT8U request, void* pArgs,
         }
         pContext->spiHandle = handle;
         break;
+    case PJDF_CTRL_MP3_SET_DREQ_FLAG:
+        if (*pSize < sizeof(Mp3DreqFlag))
+        {
+            return PJDF_ERR_ARG;
+        }
+        BspMp3DreqIntEnable(((Mp3DreqFlag*)pArgs)->pFlagGrp, ((Mp3DreqFlag*)pArgs)->flags);
+        break;
+    case PJDF_CTRL_MP3_IS_READY:
+        if (*pSize < sizeof(BOOLEAN))
+        {
+            return PJDF_ERR_ARG;
+        }
+        *((BOOLEAN*)pArgs) = BspMp3IsReady();
+        break;
     default:
         retval = PJDF_ERR_UNKNOWN_CTRL_REQUEST;
         break;
@@ -92,6 +92,17 @@ static PjdfErrCode IoctlSPI(DriverInternal *pDriver, INT8U request, void* pArgs,
         if (*pSize != sizeof(INT16U)) while (1);
         SPI_SetDataRate(pContext->spiMemMap, *(INT16U*)pArgs);
         break;
+    case PJDF_CTRL_SPI_WRITE_REPEATED: // caller holds the lock and has selected the slave
+        if (*pSize != sizeof(SpiRepeatArgs)) while (1);
+        SPI_SendRepeated(pContext->spiMemMap, ((SpiRepeatArgs*)pArgs)->value, ((SpiRepeatArgs*)pArgs)->count);
+        break;
+    case PJDF_CTRL_SPI_WRITE_BLOCK_START: // caller holds the lock and has selected the slave
+        if (*pSize != sizeof(SpiBlockArgs)) while (1);
+        SPI_DmaStart16(pContext->spiMemMap, ((SpiBlockArgs*)pArgs)->pValues, ((SpiBlockArgs*)pArgs)->count, OS_TRUE);
+        break;
+    case PJDF_CTRL_SPI_WRITE_BLOCK_WAIT:
+        SPI_DmaWait(pContext->spiMemMap);
+        break;
     default:
         while(1);
         break;
@@ -0,0 +1,318 @@
+/*
+    fontGen.cpp
+    Host tool: converts a TrueType or BDF font into a run length encoded
+    proportional font for Adafruit_GFX::setFont() (see runfont.h).
+
+    Build:  g++ -O2 -o fontGen fontGen.cpp $(pkg-config --cflags --libs freetype2)
+    Usage:  fontGen [-p] <font.ttf|font.bdf> <pixel height> <name> [first last]
+            Writes <name>.c and <name>.h to the current directory. first and
+            last are the character codes to include, 0x20 to 0x7E by default.
+            -p prints every glyph as it will be drawn, for checking.
+
+    Encoding:
+        Glyphs are rendered in monochrome and trimmed to their bounding box.
+        The box is read as one stream of pixels, row after row, and stored
+        as a sequence of bytes: high nibble a run of background pixels and
+        low nibble the run of foreground pixels that follows it, up to 15
+        each. Runs continue from the end of one row onto the next and the
+        glyph ends when they add up to width * height. Longer runs are
+        split across bytes with a zero length for the other color.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#define RUN_MAX 15
+
+struct Glyph
+{
+    unsigned offset;
+    int width;
+    int height;
+    int xAdvance;
+    int xOffset;
+    int yOffset;        // from the baseline to the top of the box, up is negative
+    std::vector<uint8_t> pixels;  // width * height, 1 = foreground
+};
+
+// Appends the runs for a glyph's pixels to out
+static void EncodeGlyph(const std::vector<uint8_t> &pixels, std::vector<uint8_t> &out)
+{
+    int count = (int)pixels.size();
+    int x = 0;
+    while (x < count)
+    {
+        int bg = 0;
+        int fg = 0;
+        while (x + bg < count && !pixels[x + bg]) bg++;
+        x += bg;
+        while (x + fg < count && pixels[x + fg]) fg++;
+        x += fg;
+
+        while (bg > RUN_MAX)
+        {
+            out.push_back(RUN_MAX << 4);
+            bg -= RUN_MAX;
+        }
+        int n = fg > RUN_MAX ? RUN_MAX : fg;
+        out.push_back((uint8_t)((bg << 4) | n));
+        fg -= n;
+        while (fg > 0)
+        {
+            n = fg > RUN_MAX ? RUN_MAX : fg;
+            out.push_back((uint8_t)n);
+            fg -= n;
+        }
+    }
+}
+
+// Decodes a glyph the way the renderer does and checks it against the source
+static bool CheckGlyph(const Glyph &g, const std::vector<uint8_t> &runs)
+{
+    const uint8_t *p = &runs[g.offset];
+    int count = g.width * g.height;
+    int x = 0;
+    while (x < count)
+    {
+        int bg = *p >> 4;
+        int fg = *p & 0xF;
+        p++;
+        for (int i = 0; i < bg; i++, x++) if (x >= count || g.pixels[x]) return false;
+        for (int i = 0; i < fg; i++, x++) if (x >= count || !g.pixels[x]) return false;
+    }
+    return true;
+}
+
+// Renders character c and trims it to its bounding box
+static bool RenderGlyph(FT_Face face, unsigned c, Glyph &g)
+{
+    if (FT_Load_Char(face, c, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO) != 0) return false;
+
+    FT_GlyphSlot slot = face->glyph;
+    FT_Bitmap &bm = slot->bitmap;
+    int minX = bm.width, maxX = -1, minY = bm.rows, maxY = -1;
+
+    for (int y = 0; y < (int)bm.rows; y++)
+    {
+        for (int x = 0; x < (int)bm.width; x++)
+        {
+            if (bm.buffer[y * bm.pitch + (x >> 3)] & (0x80 >> (x & 7)))
+            {
+                if (x < minX) minX = x;
+                if (x > maxX) maxX = x;
+                if (y < minY) minY = y;
+                if (y > maxY) maxY = y;
+            }
+        }
+    }
+
+    g.xAdvance = (int)((slot->advance.x + 32) >> 6);
+    if (maxX < 0)
+    {
+        // blank glyph, e.g. space
+        g.width = g.height = g.xOffset = g.yOffset = 0;
+        g.pixels.clear();
+        return true;
+    }
+
+    g.width = maxX - minX + 1;
+    g.height = maxY - minY + 1;
+    g.xOffset = slot->bitmap_left + minX;
+    g.yOffset = minY - slot->bitmap_top;
+    g.pixels.assign(g.width * g.height, 0);
+    for (int y = 0; y < g.height; y++)
+    {
+        for (int x = 0; x < g.width; x++)
+        {
+            int sx = x + minX;
+            int sy = y + minY;
+            g.pixels[y * g.width + x] = (bm.buffer[sy * bm.pitch + (sx >> 3)] & (0x80 >> (sx & 7))) ? 1 : 0;
+        }
+    }
+    return true;
+}
+
+static void PrintGlyph(unsigned c, const Glyph &g, int ascent, int yAdvance)
+{
+    fprintf(stderr, "'%c' 0x%02x advance %d box %dx%d at %d,%d\n",
+        c, c, g.xAdvance, g.width, g.height, g.xOffset, g.yOffset);
+    for (int y = 0; y < yAdvance; y++)
+    {
+        fputc('|', stderr);
+        for (int x = 0; x < g.xAdvance; x++)
+        {
+            int gx = x - g.xOffset;
+            int gy = y - ascent - g.yOffset;
+            bool on = gx >= 0 && gx < g.width && gy >= 0 && gy < g.height && g.pixels[gy * g.width + gx];
+            fputc(on ? '#' : (y == ascent ? '_' : '.'), stderr);
+        }
+        fputs("|\n", stderr);
+    }
+}
+
+static bool WriteHeader(const std::string &name, int height)
+{
+    std::string path = name + ".h";
+    FILE *out = fopen(path.c_str(), "w");
+    if (out == NULL) return false;
+
+    fprintf(out, "/*\n    %s.h\n    %d pixel run length font generated by Tools/fontGen.cpp.\n\n", name.c_str(), height);
+    fprintf(out, "    Developed for University of Washington embedded systems programming certificate\n*/\n\n");
+    std::string guard;
+    for (size_t i = 0; i < name.size(); i++) guard += (char)toupper((unsigned char)name[i]);
+    fprintf(out, "#ifndef __%s_H__\n#define __%s_H__\n\n", guard.c_str(), guard.c_str());
+    fprintf(out, "#include \"runfont.h\"\n\nextern const RunFont %s;\n\n#endif\n", name.c_str());
+    fclose(out);
+    return true;
+}
+
+static bool WriteSource(const std::string &name, const char *fontName, int height, unsigned first, unsigned last,
+    int ascent, int yAdvance, const std::vector<Glyph> &glyphs, const std::vector<uint8_t> &runs)
+{
+    std::string path = name + ".c";
+    FILE *out = fopen(path.c_str(), "w");
+    if (out == NULL) return false;
+
+    fprintf(out, "/*\n    %s.c\n    %s at %d pixels, characters 0x%02x to 0x%02x.\n",
+        name.c_str(), fontName, height, first, last);
+    fprintf(out, "    Generated by Tools/fontGen.cpp, do not edit.\n\n");
+    fprintf(out, "    Developed for University of Washington embedded systems programming certificate\n*/\n\n");
+    fprintf(out, "#include \"%s.h\"\n\n", name.c_str());
+
+    fprintf(out, "static const uint8_t %sRuns[%u] = {", name.c_str(), (unsigned)runs.size());
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        fprintf(out, "%s0x%02x%s", (i % 16) == 0 ? "\n    " : "", runs[i], i + 1 < runs.size() ? ", " : "");
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "static const RunGlyph %sGlyphs[%u] = {\n", name.c_str(), (unsigned)glyphs.size());
+    fprintf(out, "    // offset, width, height, xAdvance, xOffset, yOffset\n");
+    for (size_t i = 0; i < glyphs.size(); i++)
+    {
+        const Glyph &g = glyphs[i];
+        unsigned c = first + (unsigned)i;
+        fprintf(out, "    { %5u, %2d, %2d, %2d, %2d, %3d }%s // 0x%02x", g.offset, g.width, g.height,
+            g.xAdvance, g.xOffset, g.yOffset, i + 1 < glyphs.size() ? "," : " ", c);
+        if (c >= 0x20 && c < 0x7F) fprintf(out, " '%c'", c);
+        fputc('\n', out);
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const RunFont %s = {\n    %sRuns,\n    %sGlyphs,\n    0x%02x, 0x%02x, %d, %d\n};\n",
+        name.c_str(), name.c_str(), name.c_str(), first, last, yAdvance, ascent);
+    fclose(out);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    bool preview = false;
+    int arg = 1;
+    if (arg < argc && strcmp(argv[arg], "-p") == 0)
+    {
+        preview = true;
+        arg++;
+    }
+    if (argc - arg != 3 && argc - arg != 5)
+    {
+        fprintf(stderr, "usage: %s [-p] <font.ttf|font.bdf> <pixel height> <name> [first last]\n", argv[0]);
+        return 2;
+    }
+
+    const char *fontPath = argv[arg];
+    int height = atoi(argv[arg + 1]);
+    std::string name = argv[arg + 2];
+    unsigned first = argc - arg == 5 ? strtoul(argv[arg + 3], NULL, 0) : 0x20;
+    unsigned last = argc - arg == 5 ? strtoul(argv[arg + 4], NULL, 0) : 0x7E;
+    if (height <= 0 || first > last || last > 0xFF)
+    {
+        fprintf(stderr, "bad pixel height or character range\n");
+        return 2;
+    }
+
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) != 0 || FT_New_Face(library, fontPath, 0, &face) != 0)
+    {
+        fprintf(stderr, "cannot open %s\n", fontPath);
+        return 1;
+    }
+    // Scalable fonts are sized by pixel height, bitmap (BDF) fonts use the nearest strike
+    if (FT_Set_Pixel_Sizes(face, 0, height) != 0 && face->num_fixed_sizes > 0)
+    {
+        FT_Select_Size(face, 0);
+    }
+
+    std::vector<Glyph> glyphs(last - first + 1);
+    std::vector<uint8_t> runs;
+    int ascent = 0;
+    int descent = 0;
+
+    for (unsigned c = first; c <= last; c++)
+    {
+        Glyph &g = glyphs[c - first];
+        if (!RenderGlyph(face, c, g))
+        {
+            fprintf(stderr, "no glyph for 0x%02x, left blank\n", c);
+            g = Glyph();
+        }
+        if (g.height > 0)
+        {
+            if (-g.yOffset > ascent) ascent = -g.yOffset;
+            if (g.height + g.yOffset > descent) descent = g.height + g.yOffset;
+        }
+        if (g.width > 255 || g.xAdvance > 255 || g.xOffset < -128 || g.xOffset > 127 || g.yOffset < -128)
+        {
+            fprintf(stderr, "glyph 0x%02x too large for the RunGlyph fields\n", c);
+            return 1;
+        }
+        g.offset = (unsigned)runs.size();
+        EncodeGlyph(g.pixels, runs);
+        if (!CheckGlyph(g, runs))
+        {
+            fprintf(stderr, "glyph 0x%02x did not decode back to its bitmap\n", c);
+            return 1;
+        }
+    }
+    if (runs.size() > 0xFFFF)
+    {
+        fprintf(stderr, "%u bytes of runs, more than a RunGlyph offset can address\n", (unsigned)runs.size());
+        return 1;
+    }
+
+    int yAdvance = ascent + descent;
+    if (preview)
+    {
+        for (unsigned c = first; c <= last; c++) PrintGlyph(c, glyphs[c - first], ascent, yAdvance);
+    }
+
+    std::string fontName = std::string(face->family_name ? face->family_name : "?") + " " +
+        (face->style_name ? face->style_name : "");
+    if (!WriteHeader(name, height) ||
+        !WriteSource(name, fontName.c_str(), height, first, last, ascent, yAdvance, glyphs, runs))
+    {
+        fprintf(stderr, "cannot write %s.c/.h\n", name.c_str());
+        return 1;
+    }
+
+    size_t bitmapBytes = 0;
+    for (size_t i = 0; i < glyphs.size(); i++) bitmapBytes += (glyphs[i].width * glyphs[i].height + 7) / 8;
+    fprintf(stderr, "%u glyphs, line %d (ascent %d): %u bytes of runs + %u of glyph table (1bpp boxes: %u bytes)\n",
+        (unsigned)glyphs.size(), yAdvance, ascent, (unsigned)runs.size(),
+        (unsigned)(glyphs.size() * 8), (unsigned)bitmapBytes);
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
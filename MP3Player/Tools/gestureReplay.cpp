@@ -0,0 +1,149 @@
+/*
+    gestureReplay.cpp
+    Host tool: runs the gesture engine (Util/gesture.c) over recorded touch
+    traces and checks the events it recognizes.
+
+    A trace is the UART log of TouchTask with APP_CFG_TOUCH_LOG_EN set, one
+    line per sample:
+        TOUCH <tick> <x> <y>    touched at screen position x, y
+        TOUCH <tick> -          not touched
+    Other lines are ignored, so a raw log can be replayed as it is. A line
+        EXPECT <event> ...
+    added to a trace lists the events it should give, by the names of
+    GestureName(); the trace is then checked against it. A run of DRAG
+    events counts as one, as their number depends on the sampling.
+    Tools/touchTraces has a trace of each gesture.
+
+    Build:  g++ -O2 -Ihost -I../Util -o gestureReplay gestureReplay.cpp ../Util/gesture.c
+    Usage:  gestureReplay [-v] <trace> ...
+            -v  print every event with its position and movement
+
+    Output, one line per trace:
+        name  samples  events  ok, or the expected and recognized events
+    Exits with 1 if any trace gives other events than it expects.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "gesture.h"
+
+typedef std::vector<std::string> Names;
+
+// Adds an event name to the list checked, a run of DRAG as one
+static void Add(Names &names, GestureType type)
+{
+    if (type == GESTURE_DRAG && !names.empty() && names.back() == GestureName(type)) return;
+    names.push_back(GestureName(type));
+}
+
+static std::string Join(const Names &names)
+{
+    std::string s;
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        if (i > 0) s += " ";
+        s += names[i];
+    }
+    return s;
+}
+
+// Replays one trace, returns false if it gave other events than expected
+static bool Replay(const char *path, bool verbose)
+{
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "gestureReplay: can't open %s\n", path);
+        return false;
+    }
+
+    Gesture g;
+    GestureEvent event;
+    Names expected, events;
+    bool checked = false;
+    unsigned long samples = 0;
+    unsigned long count = 0;
+    unsigned long time = 0;
+    char line[256];
+
+    GestureInit(&g);
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        const char *p;
+        if ((p = strstr(line, "EXPECT")) != NULL)
+        {
+            char name[32];
+            int n;
+            checked = true;
+            for (p += 6; sscanf(p, "%31s%n", name, &n) == 1; p += n) expected.push_back(name);
+            continue;
+        }
+        if ((p = strstr(line, "TOUCH ")) == NULL) continue;
+
+        int x = 0, y = 0;
+        char c;
+        bool touched;
+        if (sscanf(p + 6, "%lu %d %d", &time, &x, &y) == 3) touched = true;
+        else if (sscanf(p + 6, "%lu %c", &time, &c) == 2 && c == '-') touched = false;
+        else continue;
+
+        samples++;
+        if (!GestureUpdate(&g, (INT32U)time, touched, (int16_t)x, (int16_t)y, &event)) continue;
+        Add(events, event.type);
+        count++;
+        if (verbose)
+        {
+            printf("  %6lu %-11s at %3d,%3d from %3d,%3d moved %4d,%4d\n", time, GestureName(event.type),
+                event.x, event.y, event.startX, event.startY, event.dx, event.dy);
+        }
+    }
+    fclose(f);
+
+    // A trace that stops mid touch is finished by a release
+    for (unsigned long t = time + 1; GestureIsActive(&g); t++)
+    {
+        if (GestureUpdate(&g, (INT32U)t, OS_FALSE, 0, 0, &event))
+        {
+            Add(events, event.type);
+            count++;
+        }
+    }
+
+    const char *name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+    bool ok = !checked || events == expected;
+    printf("%-20s %5lu samples %3lu events  ", name, samples, count);
+    if (!checked) printf("%s\n", Join(events).c_str());
+    else if (ok) printf("ok\n");
+    else printf("MISMATCH\n    expected: %s\n    got:      %s\n", Join(expected).c_str(), Join(events).c_str());
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    bool verbose = false;
+    bool ok = true;
+    int i = 1;
+
+    if (i < argc && strcmp(argv[i], "-v") == 0)
+    {
+        verbose = true;
+        i++;
+    }
+    if (i >= argc)
+    {
+        fprintf(stderr, "usage: gestureReplay [-v] <trace> ...\n");
+        return 2;
+    }
+    for ( ; i < argc; i++)
+    {
+        if (!Replay(argv[i], verbose)) ok = false;
+    }
+    return ok ? 0 : 1;
+}
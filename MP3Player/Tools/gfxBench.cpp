@@ -0,0 +1,129 @@
+/*
+    gfxBench.cpp
+    Host tool: times Adafruit_GFX rendering into a frame buffer (see
+    gfxFramebuffer.h) and prints what each benchmark draws, so rendering
+    changes can be measured and checked pixel for pixel on a PC.
+
+    Build:  g++ -O2 -I../Adafruit/Adafruit-GFX -I../App -o gfxBench gfxBench.cpp gfxFramebuffer.cpp gfxScenes.cpp
+                ../Adafruit/Adafruit-GFX/Adafruit_GFX.cpp ../Adafruit/Adafruit-GFX/dejaVuSansBold16.c
+                ../App/playerIcons.c
+    Usage:  gfxBench [-n iterations] [-o dir] [-c reference] [benchmark...]
+            -n  frames to time each benchmark over, 200 by default
+            -o  write the last frame of each benchmark to dir/<name>.png
+            -c  compare the checksums with the output of an earlier run
+                and exit with 1 if any frame changed
+            Benchmarks are named on the command line, all run otherwise.
+
+    Output, one line per benchmark:
+        name  microseconds per frame  primitive calls  pixels written  checksum
+    Calls and pixels are per frame and count what the LCD driver would be
+    asked to draw. The checksum is of the finished frame.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "gfxFramebuffer.h"
+#include "gfxScenes.h"
+
+// Checksums from an earlier run's output, by benchmark name
+static std::map<std::string, uint32_t> ReadReference(const char *path)
+{
+    std::map<std::string, uint32_t> ref;
+    char line[256], name[64];
+    double us;
+    unsigned long calls, pixels;
+    unsigned int sum;
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", path);
+        exit(2);
+    }
+    while (fgets(line, sizeof(line), f))
+    {
+        if (sscanf(line, "%63s %lf %lu %lu %x", name, &us, &calls, &pixels, &sum) == 5)
+            ref[name] = sum;
+    }
+    fclose(f);
+    return ref;
+}
+
+static bool Selected(const char *name, int argc, char **argv, int first)
+{
+    if (first >= argc) return true;
+    for (int i = first; i < argc; i++)
+    {
+        if (strcmp(argv[i], name) == 0) return true;
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 200;
+    const char *outDir = NULL;
+    const char *refPath = NULL;
+    int arg = 1;
+
+    for (; arg < argc && argv[arg][0] == '-'; arg++)
+    {
+        if (arg + 1 >= argc) break;
+        if (strcmp(argv[arg], "-n") == 0) iterations = atoi(argv[++arg]);
+        else if (strcmp(argv[arg], "-o") == 0) outDir = argv[++arg];
+        else if (strcmp(argv[arg], "-c") == 0) refPath = argv[++arg];
+        else break;
+    }
+    if ((arg < argc && argv[arg][0] == '-') || iterations < 1)
+    {
+        fprintf(stderr, "usage: gfxBench [-n iterations] [-o dir] [-c reference] [benchmark...]\n");
+        return 2;
+    }
+
+    std::map<std::string, uint32_t> ref;
+    if (refPath != NULL) ref = ReadReference(refPath);
+    int changed = 0;
+
+    printf("%-12s %10s %8s %9s %8s\n", "#name", "us/frame", "calls", "pixels", "checksum");
+    for (int b = 0; b < gfxSceneCount; b++)
+    {
+        const GfxScene &bench = gfxScenes[b];
+        if (!Selected(bench.name, argc, argv, arg)) continue;
+
+        // One counted frame on a cleared screen, then the timed ones
+        GfxFramebuffer fb(SCENE_WIDTH, SCENE_HEIGHT);
+        bench.draw(fb);
+        GfxStats stats = fb.stats();
+        unsigned long calls = fb.totalCalls();
+        uint32_t sum = fb.checksum();
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) bench.draw(fb);
+        double us = std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - start).count() / iterations;
+
+        printf("%-12s %10.1f %8lu %9lu %08x", bench.name, us, calls, stats.pixels, sum);
+        if (refPath != NULL)
+        {
+            std::map<std::string, uint32_t>::const_iterator it = ref.find(bench.name);
+            if (it == ref.end()) printf("  new");
+            else if (it->second != sum) { printf("  CHANGED"); changed++; }
+        }
+        printf("\n");
+
+        if (outDir != NULL)
+        {
+            std::string path = std::string(outDir) + "/" + bench.name + ".png";
+            if (!fb.savePng(path.c_str())) fprintf(stderr, "can't write %s\n", path.c_str());
+        }
+    }
+
+    return changed ? 1 : 0;
+}
@@ -0,0 +1,288 @@
+/*
+    gfxFramebuffer.cpp
+    Host only: an Adafruit_GFX display in memory, see gfxFramebuffer.h.
+
+    The buffer is kept in the current rotation, so saved images show the
+    screen the way the drawing code sees it.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "gfxFramebuffer.h"
+
+GfxFramebuffer::GfxFramebuffer(int16_t w, int16_t h)
+    : Adafruit_GFX(w, h), fb((size_t)w * h, 0)
+{
+    depth = 0;
+    resetStats();
+}
+
+// Count a call made by the drawing code, not by another primitive
+void GfxFramebuffer::count(GfxPrimitive primitive)
+{
+    if (depth == 0) counters.calls[primitive]++;
+}
+
+// Fill a rectangle clipped to the screen
+void GfxFramebuffer::fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    int x0 = x, y0 = y, x1 = x + w, y1 = y + h;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > _width) x1 = _width;
+    if (y1 > _height) y1 = _height;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int row = y0; row < y1; row++)
+    {
+        uint16_t *p = &fb[(size_t)row * _width + x0];
+        for (int col = x0; col < x1; col++) *p++ = color;
+    }
+    counters.pixels += (unsigned long)(x1 - x0) * (y1 - y0);
+}
+
+void GfxFramebuffer::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    count(GFX_PIXEL);
+    fill(x, y, 1, 1, color);
+}
+
+void GfxFramebuffer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    count(GFX_VLINE);
+    fill(x, y, 1, h, color);
+}
+
+void GfxFramebuffer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    count(GFX_HLINE);
+    fill(x, y, w, 1, color);
+}
+
+void GfxFramebuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    count(GFX_FILLRECT);
+    fill(x, y, w, h, color);
+}
+
+void GfxFramebuffer::fillScreen(uint16_t color)
+{
+    count(GFX_FILLSCREEN);
+    fill(0, 0, _width, _height, color);
+}
+
+// Characters are drawn by the generic code, counted as one call
+void GfxFramebuffer::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+    uint16_t bg, uint8_t size)
+{
+    count(GFX_CHAR);
+    depth++;
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size);
+    depth--;
+}
+
+void GfxFramebuffer::drawRunChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+    uint16_t bg)
+{
+    count(GFX_RUNCHAR);
+    depth++;
+    Adafruit_GFX::drawRunChar(x, y, c, color, bg);
+    depth--;
+}
+
+void GfxFramebuffer::drawSprite(int16_t x, int16_t y, const RunSprite *sprite)
+{
+    count(GFX_SPRITE);
+    depth++;
+    Adafruit_GFX::drawSprite(x, y, sprite);
+    depth--;
+}
+
+// Color at x,y, or 0 off the screen
+uint16_t GfxFramebuffer::pixel(int16_t x, int16_t y) const
+{
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+    return fb[(size_t)y * _width + x];
+}
+
+// width() * height() pixels, row after row
+const uint16_t *GfxFramebuffer::pixels(void) const
+{
+    return &fb[0];
+}
+
+void GfxFramebuffer::resetStats(void)
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+const GfxStats &GfxFramebuffer::stats(void) const
+{
+    return counters;
+}
+
+unsigned long GfxFramebuffer::totalCalls(void) const
+{
+    unsigned long total = 0;
+    for (int i = 0; i < GFX_PRIMITIVES; i++) total += counters.calls[i];
+    return total;
+}
+
+// FNV-1a hash of the screen, to compare renderings without keeping images
+uint32_t GfxFramebuffer::checksum(void) const
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < fb.size(); i++)
+    {
+        hash = (hash ^ (fb[i] & 0xFF)) * 16777619u;
+        hash = (hash ^ (fb[i] >> 8)) * 16777619u;
+    }
+    return hash;
+}
+
+// Number of pixels that differ from other, or every pixel if the sizes differ
+unsigned long GfxFramebuffer::differences(const GfxFramebuffer &other) const
+{
+    if (other._width != _width || other._height != _height) return fb.size();
+
+    unsigned long n = 0;
+    for (size_t i = 0; i < fb.size(); i++)
+    {
+        if (fb[i] != other.fb[i]) n++;
+    }
+    return n;
+}
+
+// RGB565 to 8 bit channels, replicating the high bits into the low ones
+static void ToRgb888(uint16_t c, uint8_t *rgb)
+{
+    uint8_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Binary PPM (P6)
+bool GfxFramebuffer::savePpm(const char *path) const
+{
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) return false;
+
+    fprintf(f, "P6\n%d %d\n255\n", _width, _height);
+    for (size_t i = 0; i < fb.size(); i++)
+    {
+        uint8_t rgb[3];
+        ToRgb888(fb[i], rgb);
+        fwrite(rgb, 1, 3, f);
+    }
+    return fclose(f) == 0;
+}
+
+
+/************************************************************************************
+
+   PNG output without zlib: the image data is stored in uncompressed
+   deflate blocks, which every PNG reader accepts.
+
+************************************************************************************/
+
+static uint32_t crcTable[256];
+
+static uint32_t Crc32(uint32_t crc, const uint8_t *data, size_t len)
+{
+    if (crcTable[1] == 0)
+    {
+        for (uint32_t n = 0; n < 256; n++)
+        {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            crcTable[n] = c;
+        }
+    }
+    crc ^= 0xFFFFFFFFu;
+    while (len--) crc = crcTable[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+static void PutBe32(std::vector<uint8_t> &out, uint32_t v)
+{
+    out.push_back(v >> 24);
+    out.push_back(v >> 16);
+    out.push_back(v >> 8);
+    out.push_back(v);
+}
+
+static void PutChunk(FILE *f, const char *type, const std::vector<uint8_t> &data)
+{
+    std::vector<uint8_t> chunk;
+    PutBe32(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    PutBe32(chunk, Crc32(0, &chunk[4], chunk.size() - 4));
+    fwrite(&chunk[0], 1, chunk.size(), f);
+}
+
+bool GfxFramebuffer::savePng(const char *path) const
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    // Scanlines: filter type 0 then RGB
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)_height * (1 + _width * 3));
+    for (int y = 0; y < _height; y++)
+    {
+        raw.push_back(0);
+        for (int x = 0; x < _width; x++)
+        {
+            uint8_t rgb[3];
+            ToRgb888(fb[(size_t)y * _width + x], rgb);
+            raw.insert(raw.end(), rgb, rgb + 3);
+        }
+    }
+
+    // zlib stream of stored blocks
+    std::vector<uint8_t> z;
+    uint32_t a = 1, b = 0;
+    z.push_back(0x78);
+    z.push_back(0x01);
+    for (size_t pos = 0; pos < raw.size() || pos == 0; )
+    {
+        size_t n = raw.size() - pos;
+        if (n > 65535) n = 65535;
+        z.push_back(pos + n == raw.size() ? 1 : 0);
+        z.push_back(n & 0xFF);
+        z.push_back(n >> 8);
+        z.push_back(~n & 0xFF);
+        z.push_back((~n >> 8) & 0xFF);
+        for (size_t i = pos; i < pos + n; i++)
+        {
+            a = (a + raw[i]) % 65521;
+            b = (b + a) % 65521;
+        }
+        z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+        pos += n;
+        if (n == 0) break;
+    }
+    PutBe32(z, (b << 16) | a);
+
+    std::vector<uint8_t> header;
+    PutBe32(header, _width);
+    PutBe32(header, _height);
+    header.push_back(8);    // bits per channel
+    header.push_back(2);    // RGB
+    header.push_back(0);
+    header.push_back(0);
+    header.push_back(0);
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) return false;
+    fwrite(signature, 1, sizeof(signature), f);
+    PutChunk(f, "IHDR", header);
+    PutChunk(f, "IDAT", z);
+    PutChunk(f, "IEND", std::vector<uint8_t>());
+    return fclose(f) == 0;
+}
@@ -0,0 +1,80 @@
+/*
+    gfxFramebuffer.h
+    Host only: an Adafruit_GFX display that draws into an RGB565 frame
+    buffer in memory, so rendering can be run, timed and checked on a PC.
+
+    It overrides the same primitives as Adafruit_ILI9341, and counts each
+    call the way the LCD driver would see it: a character drawn by
+    drawChar() is one GFX_CHAR call however many rectangles it is made of.
+    Every pixel written is counted, including pixels drawn over again.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __GFXFRAMEBUFFER_H__
+#define __GFXFRAMEBUFFER_H__
+
+// Standard headers first, Adafruit_GFX.h defines a swap() macro
+#include <stdint.h>
+#include <vector>
+
+#include "Adafruit_GFX.h"
+
+typedef enum
+{
+    GFX_PIXEL,
+    GFX_HLINE,
+    GFX_VLINE,
+    GFX_FILLRECT,
+    GFX_FILLSCREEN,
+    GFX_CHAR,
+    GFX_RUNCHAR,
+    GFX_SPRITE,
+    GFX_PRIMITIVES
+} GfxPrimitive;
+
+typedef struct
+{
+    unsigned long calls[GFX_PRIMITIVES];  // top level calls of each primitive
+    unsigned long pixels;                 // pixels written, clipped to the screen
+} GfxStats;
+
+class GfxFramebuffer : public Adafruit_GFX
+{
+public:
+    GfxFramebuffer(int16_t w, int16_t h);
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void fillScreen(uint16_t color);
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+        uint16_t bg, uint8_t size);
+    void drawRunChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+        uint16_t bg);
+    void drawSprite(int16_t x, int16_t y, const RunSprite *sprite);
+
+    uint16_t pixel(int16_t x, int16_t y) const;
+    const uint16_t *pixels(void) const;
+
+    void resetStats(void);
+    const GfxStats &stats(void) const;
+    unsigned long totalCalls(void) const;
+
+    uint32_t checksum(void) const;
+    unsigned long differences(const GfxFramebuffer &other) const;
+
+    bool savePpm(const char *path) const;
+    bool savePng(const char *path) const;
+
+private:
+    void count(GfxPrimitive primitive);
+    void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    std::vector<uint16_t> fb;
+    GfxStats counters;
+    int depth;      // > 0 while a counted primitive draws through others
+};
+
+#endif /* __GFXFRAMEBUFFER_H__ */
@@ -0,0 +1,182 @@
+/*
+    gfxScenes.cpp
+    Host only: the screens drawn by the rendering benchmarks, see gfxScenes.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "gfxScenes.h"
+#include "dejaVuSansBold16.h"
+#include "playerIcons.h"
+
+// RGB565 colors, as in Adafruit_ILI9341.h
+#define BLACK   0x0000
+#define BLUE    0x001F
+#define RED     0xF800
+#define GREEN   0x07E0
+#define WHITE   0xFFFF
+#define NAVY    0x000F
+
+static const char *text = "The quick brown fox jumps over the lazy dog 0123456789";
+
+static void Print(Adafruit_GFX &gfx, const char *s)
+{
+    while (*s != 0) gfx.write(*s++);
+}
+
+static void SceneFillScreen(Adafruit_GFX &gfx)
+{
+    gfx.fillScreen(NAVY);
+}
+
+// 16 x 16 tiles over the whole screen
+static void SceneFillRects(Adafruit_GFX &gfx)
+{
+    for (int16_t y = 0; y < SCENE_HEIGHT; y += 16)
+    {
+        for (int16_t x = 0; x < SCENE_WIDTH; x += 16)
+        {
+            gfx.fillRect(x, y, 16, 16, ((x ^ y) & 16) ? WHITE : BLUE);
+        }
+    }
+}
+
+// Transparent 5x7 text, the way the player draws labels
+static void SceneText(Adafruit_GFX &gfx, uint8_t size)
+{
+    gfx.fillScreen(BLACK);
+    gfx.setFont(NULL);
+    gfx.setTextColor(WHITE);
+    gfx.setTextSize(size);
+    gfx.setTextWrap(true);
+    gfx.setCursor(0, 0);
+    while (gfx.getCursorY() < SCENE_HEIGHT - 8 * size) Print(gfx, text);
+}
+
+static void SceneText1(Adafruit_GFX &gfx) { SceneText(gfx, 1); }
+static void SceneText2(Adafruit_GFX &gfx) { SceneText(gfx, 2); }
+
+// Opaque 5x7 text, every pixel of every cell written
+static void SceneTextOpaque(Adafruit_GFX &gfx)
+{
+    gfx.setFont(NULL);
+    gfx.setTextColor(WHITE, BLUE);
+    gfx.setTextSize(2);
+    gfx.setTextWrap(true);
+    gfx.setCursor(0, 0);
+    while (gfx.getCursorY() < SCENE_HEIGHT - 16) Print(gfx, text);
+    gfx.setTextColor(WHITE);
+}
+
+static void SceneTextRun16(Adafruit_GFX &gfx)
+{
+    gfx.fillScreen(BLACK);
+    gfx.setFont(&dejaVuSansBold16);
+    gfx.setTextColor(WHITE);
+    gfx.setTextWrap(true);
+    gfx.setCursor(0, 0);
+    while (gfx.getCursorY() < SCENE_HEIGHT - dejaVuSansBold16.yAdvance) Print(gfx, text);
+    gfx.setFont(NULL);
+}
+
+static void SceneShapes(Adafruit_GFX &gfx)
+{
+    gfx.fillScreen(BLACK);
+    for (int16_t i = 0; i < SCENE_WIDTH; i += 12)
+    {
+        gfx.drawLine(0, 0, i, SCENE_HEIGHT - 1, GREEN);
+        gfx.drawLine(SCENE_WIDTH - 1, 0, i, SCENE_HEIGHT - 1, RED);
+    }
+    for (int16_t r = 10; r < 110; r += 10) gfx.drawCircle(120, 160, r, WHITE);
+    gfx.fillCircle(120, 160, 20, BLUE);
+    gfx.drawRoundRect(10, 10, 220, 300, 20, WHITE);
+    gfx.fillTriangle(20, 300, 120, 200, 220, 300, RED);
+}
+
+// The player's four buttons, laid out as in App/tasks.c
+static void DrawButtons(Adafruit_GFX &gfx)
+{
+    Adafruit_GFX_Button play, stop, next, prev;
+
+    play.initButton(&gfx, 70, 150, 75, 75, WHITE, GREEN, WHITE, (char *)"play", 2);
+    stop.initButton(&gfx, 170, 150, 75, 75, WHITE, RED, WHITE, (char *)"stop", 2);
+    next.initButton(&gfx, 170, 250, 75, 75, WHITE, BLUE, WHITE, (char *)"next", 2);
+    prev.initButton(&gfx, 70, 250, 75, 75, WHITE, BLUE, WHITE, (char *)"prev", 2);
+    play.drawButton();
+    stop.drawButton();
+    next.drawButton();
+    prev.drawButton();
+}
+
+static void SceneButtons(Adafruit_GFX &gfx)
+{
+    gfx.fillScreen(BLACK);
+    DrawButtons(gfx);
+}
+
+// The same buttons as sprites, as App/tasks.c now draws them
+static void SceneIconButtons(Adafruit_GFX &gfx)
+{
+    gfx.fillScreen(BLACK);
+    gfx.drawSprite(33, 113, &playerIconsPlay);
+    gfx.drawSprite(133, 113, &playerIconsStop);
+    gfx.drawSprite(133, 213, &playerIconsNext);
+    gfx.drawSprite(33, 213, &playerIconsPrev);
+}
+
+// Feedback for one touch: the play button redrawn pressed, as a label
+// button and as a sprite
+static void ScenePressLabel(Adafruit_GFX &gfx)
+{
+    Adafruit_GFX_Button play;
+
+    play.initButton(&gfx, 70, 150, 75, 75, WHITE, GREEN, WHITE, (char *)"play", 2);
+    play.drawButton(true);
+}
+
+static void ScenePressIcon(Adafruit_GFX &gfx)
+{
+    gfx.drawSprite(33, 113, &playerIconsPlayPressed);
+}
+
+// The whole player screen while a song plays: title, status, progress
+// bar half full and the buttons
+static void ScenePlayer(Adafruit_GFX &gfx)
+{
+    gfx.fillScreen(BLACK);
+
+    gfx.setFont(&dejaVuSansBold16);
+    gfx.setTextColor(WHITE);
+    gfx.setCursor(40, 60);
+    Print(gfx, "Cold Cold Heart");
+    gfx.setFont(NULL);
+
+    gfx.setTextSize(2);
+    gfx.setTextWrap(false);
+    gfx.setCursor(40, 80);
+    Print(gfx, "playing...");
+    gfx.setTextWrap(true);
+
+    gfx.drawRect(40, 102, 160, 6, WHITE);
+    gfx.fillRect(41, 103, 79, 4, GREEN);
+
+    DrawButtons(gfx);
+}
+
+const GfxScene gfxScenes[] =
+{
+    { "fillScreen",  SceneFillScreen },
+    { "fillRects",   SceneFillRects },
+    { "text1",       SceneText1 },
+    { "text2",       SceneText2 },
+    { "textOpaque",  SceneTextOpaque },
+    { "textRun16",   SceneTextRun16 },
+    { "shapes",      SceneShapes },
+    { "buttons",     SceneButtons },
+    { "player",      ScenePlayer },
+    { "iconButtons", SceneIconButtons },
+    { "pressLabel",  ScenePressLabel },
+    { "pressIcon",   ScenePressIcon },
+};
+
+const int gfxSceneCount = sizeof(gfxScenes) / sizeof(gfxScenes[0]);
@@ -0,0 +1,29 @@
+/*
+    gfxScenes.h
+    Host only: the screens drawn by the rendering benchmarks, on any
+    Adafruit_GFX of SCENE_WIDTH x SCENE_HEIGHT: text, fills, shapes, the
+    player's buttons drawn as shapes and as sprites, a button press and
+    the whole player screen. Each scene draws the same frame every time
+    it is called.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __GFXSCENES_H__
+#define __GFXSCENES_H__
+
+#include "Adafruit_GFX.h"
+
+#define SCENE_WIDTH     240     // ILI9341_TFTWIDTH
+#define SCENE_HEIGHT    320     // ILI9341_TFTHEIGHT
+
+typedef struct
+{
+    const char *name;
+    void (*draw)(Adafruit_GFX &gfx);
+} GfxScene;
+
+extern const GfxScene gfxScenes[];
+extern const int gfxSceneCount;
+
+#endif /* __GFXSCENES_H__ */
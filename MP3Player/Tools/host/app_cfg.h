@@ -0,0 +1,14 @@
+/*
+    app_cfg.h
+    Host only: stands in for App/uCOS/app_cfg.h, with the features the
+    host tools check turned on.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef  APP_CFG_MODULE_PRESENT
+#define  APP_CFG_MODULE_PRESENT
+
+#define APP_CFG_SPECTRUM_EN     1u
+
+#endif
@@ -0,0 +1,46 @@
+/*
+    bsp.h
+    Host only: stands in for BSP/bsp.h so that the LCD code can be built
+    on a PC, with the uC/OS-II types, the few kernel calls it uses and
+    the Cortex-M4 intrinsics. There is one task, so critical sections
+    are empty.
+    Put this directory before the firmware's on the include path.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __BSP_H
+#define __BSP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "core_cmSimd.h"
+
+typedef unsigned char  BOOLEAN;
+typedef unsigned char  INT8U;
+typedef signed   char  INT8S;
+typedef unsigned short INT16U;
+typedef signed   short INT16S;
+typedef unsigned int   INT32U;
+typedef signed   int   INT32S;
+
+typedef INT16U         OS_FLAGS;
+typedef struct os_flag_grp OS_FLAG_GRP;
+typedef unsigned int   OS_CPU_SR;
+
+#define OS_FALSE            0u
+#define OS_TRUE             1u
+#define OS_TICKS_PER_SEC    1000
+
+#define OS_ENTER_CRITICAL() ((void)cpu_sr)
+#define OS_EXIT_CRITICAL()
+
+// Defined by the device model in use, see ili9341Model.cpp
+extern BOOLEAN OSRunning;
+extern uint32_t SystemCoreClock;
+void OSTimeDly(INT32U ticks);
+INT32U OSTimeGet(void);
+
+#endif
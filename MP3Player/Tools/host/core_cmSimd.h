@@ -0,0 +1,58 @@
+/*
+    core_cmSimd.h
+    Host only: stands in for the Cortex-M4 core header and the CMSIS SIMD
+    and instruction intrinsics, so that code using the DSP instructions can
+    be built and checked on a PC. Each intrinsic is the instruction's
+    effect, written in C; see the ARMv7-M Architecture Reference Manual.
+    The DWT cycle counter is a plain variable a tool may advance.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __CORE_CMSIMD_H
+#define __CORE_CMSIMD_H
+
+#include <stdint.h>
+
+#define __CORTEX_M      (0x04)
+
+// Unsigned saturating add of each of the four bytes
+static inline uint32_t __UQADD8(uint32_t op1, uint32_t op2)
+{
+    uint32_t result = 0;
+    for (int i = 0; i < 32; i += 8)
+    {
+        uint32_t sum = ((op1 >> i) & 0xFF) + ((op2 >> i) & 0xFF);
+        result |= (sum > 0xFF ? 0xFF : sum) << i;
+    }
+    return result;
+}
+
+// Reverse the bytes of each halfword
+static inline uint32_t __REV16(uint32_t value)
+{
+    return ((value & 0x00FF00FF) << 8) | ((value >> 8) & 0x00FF00FF);
+}
+
+// The DWT cycle counter and the debug register that enables it, defined
+// by the tool that uses them
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type hostDwt;
+extern CoreDebug_Type hostCoreDebug;
+
+#define DWT                         (&hostDwt)
+#define CoreDebug                   (&hostCoreDebug)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+
+#endif /* __CORE_CMSIMD_H */
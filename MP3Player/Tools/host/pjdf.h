@@ -0,0 +1,32 @@
+/*
+    pjdf.h
+    Host only: stands in for PJDF/pjdf.h with just the LCD and MP3 parts
+    of the driver interface. Write(), Read() and Ioctl() go to a device
+    model instead of a driver, see ili9341Model.h and spectrumTest.cpp.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __PJDF_H__
+#define __PJDF_H__
+
+#include "bsp.h"
+#include "pjdfCtrlLcdILI9341.h"
+#include "pjdfCtrlMp3VS1053.h"
+
+typedef INT8S HANDLE;
+
+#define PJDF_IS_VALID_HANDLE(x)  (x > 0)
+
+#define PJDF_IS_ERROR(x) (x < 0)
+typedef INT8S PjdfErrCode;
+#define PJDF_ERR_NONE  0
+#define PJDF_ERR_INVALID_HANDLE -4
+#define PJDF_ERR_ARG -5
+#define PJDF_ERR_UNKNOWN_CTRL_REQUEST -6
+
+PjdfErrCode Write(HANDLE handle, void* pBuffer, INT32U* pLength);
+PjdfErrCode Read(HANDLE handle, void* pBuffer, INT32U* pLength);
+PjdfErrCode Ioctl(HANDLE handle, INT8U request, void* pArgs, INT32U* pSize);
+
+#endif
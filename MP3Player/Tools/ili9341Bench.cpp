@@ -0,0 +1,446 @@
+/*
+    ili9341Bench.cpp
+    Host tool: runs the real Adafruit_ILI9341 drawing code against a model
+    of the panel (see ili9341Model.h) and reports what each screen costs on
+    the SPI bus, checking the picture the panel ends up with against the
+    same screen drawn into a frame buffer.
+
+    Build:  g++ -O2 -Ihost -I../PJDF -I../Adafruit/Adafruit-GFX -I../Adafruit/Adafruit_ILI9341 -I../Util -I../App
+                -o ili9341Bench ili9341Bench.cpp ili9341Model.cpp gfxFramebuffer.cpp gfxScenes.cpp
+                ../Adafruit/Adafruit-GFX/Adafruit_GFX.cpp ../Adafruit/Adafruit-GFX/dejaVuSansBold16.c ../App/playerIcons.c
+                ../Adafruit/Adafruit_ILI9341/Adafruit_ILI9341.cpp
+                ../Adafruit/Adafruit_ILI9341/Adafruit_ILI9341_Strip.cpp
+                ../Adafruit/Adafruit_ILI9341/Adafruit_ILI9341_Scroll.cpp ../Util/pixelKernels.c
+                ../App/uiScrollList.c ../App/uiWidgets.c
+    Usage:  ili9341Bench [-o dir] [-c reference] [scene...]
+            -o  write what the panel shows after each scene to dir/<name>.png
+            -c  compare with the output of an earlier run and exit with 1 if
+                any scene now sends more bytes or transactions, or if any
+                picture is wrong
+            Scenes are named on the command line, all run otherwise.
+
+    Every scene of gfxScenes.h is drawn twice: "direct" through
+    Adafruit_ILI9341 and "strip" through Adafruit_ILI9341_Strip, the way
+    the player redraws. The columns are per frame:
+        bytes   every byte on the wire
+        cmd     bytes sent as commands
+        pixel   RAMWR bytes
+        xfers   driver transfers, fills and DMA blocks
+        dc      DC line changes
+        win     address windows (RAMWR commands)
+        diff    pixels that differ from the frame buffer rendering
+        err     bytes the panel would misread
+    A scene is flagged if the driver's own bus counts disagree with the
+    model, or if diff or err is not zero.
+
+    The widgets scenes paint the player's widgets through UiScreen, then
+    change them one at a time. A change must redraw only the rectangles
+    it should: the label characters that changed, the progress bar
+    columns between the old and new fill, a pressed sprite button by
+    itself straight to the LCD, in each spectrum bar the rows between its
+    old and new top. Nearby changes must be merged into one
+    rectangle. A line starting with # gives the rectangles and pixel
+    bytes of each change, and the scene is flagged if they are not the
+    expected ones.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+
+#include "gfxFramebuffer.h"
+#include "gfxScenes.h"
+#include "ili9341Model.h"
+#include "Adafruit_ILI9341.h"
+#include "Adafruit_ILI9341_Strip.h"
+#include "Adafruit_ILI9341_Scroll.h"
+#include "dejaVuSansBold16.h"
+#include "uiScrollList.h"
+#include "uiWidgets.h"
+#include "playerIcons.h"
+
+static Ili9341Model panel;
+static Adafruit_ILI9341 lcd;
+static Adafruit_ILI9341_Strip strip(&lcd);
+static Adafruit_ILI9341_Scroll scroller(&lcd, &strip);
+
+typedef struct
+{
+    uint32_t bytes;
+    uint32_t transactions;
+} Cost;
+
+static std::map<std::string, Cost> reference;
+static int failures = 0;
+
+static unsigned long Differences(const GfxFramebuffer &expected)
+{
+    unsigned long n = 0;
+    for (int16_t y = 0; y < SCENE_HEIGHT; y++)
+    {
+        for (int16_t x = 0; x < SCENE_WIDTH; x++)
+        {
+            if (panel.pixel(x, y) != expected.pixel(x, y)) n++;
+        }
+    }
+    return n;
+}
+
+static void SavePicture(const char *dir, const std::string &name)
+{
+    GfxFramebuffer shown(SCENE_WIDTH, SCENE_HEIGHT);
+    for (int16_t y = 0; y < SCENE_HEIGHT; y++)
+    {
+        for (int16_t x = 0; x < SCENE_WIDTH; x++) shown.drawPixel(x, y, panel.pixel(x, y));
+    }
+    std::string path = std::string(dir) + "/" + name + ".png";
+    if (!shown.savePng(path.c_str())) fprintf(stderr, "can't write %s\n", path.c_str());
+}
+
+// Print the cost of what was drawn since the stats were reset and check it
+static void Report(const std::string &name, const GfxFramebuffer *expected, const char *outDir)
+{
+    Ili9341BusStats bus;
+    lcd.getBusStats(&bus);
+    const Ili9341WireStats &wire = panel.stats();
+    unsigned long diff = expected != NULL ? Differences(*expected) : 0;
+
+    printf("%-18s %8u %6u %8u %6u %5u %5u %6lu %4u", name.c_str(), wire.bytes,
+        wire.commandBytes, wire.pixelBytes, wire.transactions, wire.dcChanges,
+        wire.windows, diff, wire.errors);
+
+    if (bus.bytes != wire.bytes || bus.transfers != wire.transactions || bus.dcChanges != wire.dcChanges)
+    {
+        printf("  DRIVER COUNTS %u/%u/%u", bus.bytes, bus.transfers, bus.dcChanges);
+        failures++;
+    }
+    if (diff != 0 || wire.errors != 0)
+    {
+        if (wire.errors != 0) printf("  %s", panel.lastError());
+        else printf("  WRONG PICTURE");
+        failures++;
+    }
+    std::map<std::string, Cost>::const_iterator it = reference.find(name);
+    if (it != reference.end())
+    {
+        if (wire.bytes > it->second.bytes || wire.transactions > it->second.transactions)
+        {
+            printf("  WORSE (was %u bytes, %u xfers)", it->second.bytes, it->second.transactions);
+            failures++;
+        }
+        else if (wire.bytes < it->second.bytes || wire.transactions < it->second.transactions)
+        {
+            printf("  better (was %u bytes, %u xfers)", it->second.bytes, it->second.transactions);
+        }
+    }
+    printf("\n");
+
+    if (outDir != NULL) SavePicture(outDir, name);
+}
+
+static void StartFrame(void)
+{
+    lcd.resetBusStats();
+    panel.resetStats();
+}
+
+static void RunScene(const GfxScene &scene, const char *outDir)
+{
+    GfxFramebuffer expected(SCENE_WIDTH, SCENE_HEIGHT);
+    scene.draw(expected);
+
+    // Start each scene from the same frame memory as the frame buffer
+    lcd.fillScreen(0);
+    StartFrame();
+    scene.draw(lcd);
+    Report(std::string(scene.name) + ".direct", &expected, outDir);
+
+    lcd.fillScreen(0);
+    StartFrame();
+    strip.begin(0, 0, SCENE_WIDTH, SCENE_HEIGHT, 0);
+    do {
+        scene.draw(strip);
+    } while (strip.nextStrip());
+    Report(std::string(scene.name) + ".strip", &expected, outDir);
+}
+
+// Title band of the player, as in App/tasks.c: content line e * 20 starts
+// title e, and rolling the next title in takes 20 one line scrolls
+static const char *titles[2] = { "First Title", "Second Title" };
+
+static void DrawTitles(Adafruit_GFX *gfx, int16_t y, int32_t firstLine, int16_t count, void *arg)
+{
+    for (int32_t entry = firstLine / 20; entry * 20 < firstLine + count; entry++)
+    {
+        gfx->setCursor(40, y + (int16_t)(entry * 20 - firstLine));
+        gfx->setTextColor(0xFFFF);
+        gfx->setFont(&dejaVuSansBold16);
+        for (const char *p = titles[entry & 1]; *p != 0; p++) gfx->write(*p);
+        gfx->setFont(NULL);
+    }
+}
+
+static void RunScroll(const char *outDir)
+{
+    GfxFramebuffer expected(SCENE_WIDTH, SCENE_HEIGHT);
+    expected.setCursor(40, 60);
+    expected.setTextColor(0xFFFF);
+    expected.setFont(&dejaVuSansBold16);
+    for (const char *p = titles[1]; *p != 0; p++) expected.write(*p);
+
+    lcd.fillScreen(0);
+    scroller.begin(60, 20, 0);
+    scroller.redraw(DrawTitles, NULL);
+    StartFrame();
+    for (int i = 0; i < 20; i++) scroller.scroll(1, DrawTitles, NULL);
+    Report("titleRoll.scroll", &expected, outDir);
+    scroller.end();
+}
+
+static BOOLEAN FetchTrack(INT32U index, char *text, INT16U size, void *arg)
+{
+    snprintf(text, size, "TRACK%04u.MP3", index);
+    return 1;
+}
+
+// The list as it should look with row first at the top of the band
+static void DrawTrackRows(GfxFramebuffer &fb, INT32U first, INT32U count)
+{
+    char text[UI_SCROLL_LIST_TEXT];
+    fb.setTextColor(0xFFFF);
+    fb.setTextWrap(false);
+    fb.setFont(&dejaVuSansBold16);
+    for (INT32U row = first; row < first + 12 && row < count; row++)
+    {
+        FetchTrack(row, text, sizeof(text), NULL);
+        fb.setCursor(4, 80 + (int16_t)(row - first) * 20 + 4);
+        for (const char *p = text; *p != 0; p++) fb.write(*p);
+    }
+    fb.setFont(NULL);
+}
+
+// A list in rows 80-319 scrolled a line at a time, then a page at once.
+// The cost per line must not depend on how long the list is.
+static void RunTrackList(const char *outDir, INT32U count)
+{
+    char name[32];
+    UiScrollListStats stats;
+    UiScrollList trackList(&scroller, 20, 0xFFFF, &dejaVuSansBold16);
+
+    lcd.fillScreen(0);
+    trackList.begin(80, 240, 0, count, FetchTrack, NULL);
+
+    GfxFramebuffer line(SCENE_WIDTH, SCENE_HEIGHT);
+    DrawTrackRows(line, 1, count);
+    StartFrame();
+    for (int i = 0; i < 20; i++) trackList.scrollBy(1);
+    snprintf(name, sizeof(name), "trackList%u.line", count);
+    Report(name, &line, outDir);
+
+    GfxFramebuffer page(SCENE_WIDTH, SCENE_HEIGHT);
+    DrawTrackRows(page, 13, count);
+    StartFrame();
+    trackList.scrollBy(240);
+    snprintf(name, sizeof(name), "trackList%u.page", count);
+    Report(name, &page, outDir);
+
+    trackList.getStats(&stats);
+    printf("#%-17s %u rows fetched, %u cached, %u lines drawn\n", name, stats.fetches, stats.hits, stats.lines);
+    trackList.end();
+}
+
+// The player's screen, as laid out in App/tasks.c
+#define WIDGET_PROGRESS_MAX 1000
+
+static UiScreen uiScreen(&lcd, &strip, 0);
+static UiLabel statusLabel(40, 80, 125, 20, 0xFFFF, NULL, 2);
+static UiLabel timeLabel(170, 80, 60, 16, 0xFFFF, NULL, 2);
+static UiProgressBar progressBar(40, 102, 160, 6, 0xFFFF, 0x07E0, WIDGET_PROGRESS_MAX);
+static UiButton playButton(33, 113, &playerIconsPlay, &playerIconsPlayPressed);
+static UiButton stopButton(133, 113, &playerIconsStop, &playerIconsStopPressed);
+static UiSpectrum spectrumBars(33, 291, 175, 20, 0x07E0, 0xFFFF, 63);
+static UiWidget * const widgets[] = { &statusLabel, &timeLabel, &progressBar, &playButton, &stopButton, &spectrumBars };
+
+// Paints the changes made since the last paint and checks the picture, how
+// many rectangles were drawn, how many of them straight to the LCD and how
+// many pixel bytes they took
+static void PaintWidgets(const char *name, const char *outDir, INT32U rects, INT32U direct, uint32_t pixelBytes)
+{
+    UiStats before, after;
+    GfxFramebuffer expected(SCENE_WIDTH, SCENE_HEIGHT);
+    for (size_t i = 0; i < sizeof(widgets) / sizeof(widgets[0]); i++) widgets[i]->draw(&expected);
+
+    uiScreen.getStats(&before);
+    StartFrame();
+    uiScreen.paint();
+    uiScreen.getStats(&after);
+    Report(name, &expected, outDir);
+
+    INT32U painted = after.rects - before.rects;
+    INT32U straight = after.direct - before.direct;
+    printf("#%-17s %u rects, %u direct, %u pixel bytes", name, painted, straight, panel.stats().pixelBytes);
+    if (painted != rects || straight != direct || panel.stats().pixelBytes != pixelBytes)
+    {
+        printf("  EXPECTED %u rects, %u direct, %u pixel bytes", rects, direct, pixelBytes);
+        failures++;
+    }
+    printf("\n");
+}
+
+// Columns of the progress bar's fill at value, as UiProgressBar has them
+static uint32_t FillWidth(uint16_t value)
+{
+    return (uint32_t)(160 - 2) * value / WIDGET_PROGRESS_MAX;
+}
+
+static void RunWidgets(const char *outDir)
+{
+    const uint32_t cell = 12 * 16;      // a character of the size 2 labels
+    const uint32_t barRows = 6 - 2;     // inside the outline
+    const uint32_t sprite = (uint32_t)playerIconsPlay.width * playerIconsPlay.height;
+
+    lcd.fillScreen(0);
+    for (size_t i = 0; i < sizeof(widgets) / sizeof(widgets[0]); i++) uiScreen.add(widgets[i]);
+    statusLabel.setText("playing...");
+    timeLabel.setText("0:09");
+    progressBar.setValue(100);
+    uiScreen.invalidateAll();
+    PaintWidgets("widgets.full", outDir, 1, 0, SCENE_WIDTH * SCENE_HEIGHT * 2);
+
+    // A clock tick redraws the one digit that changed, a carry the two
+    timeLabel.setText("0:08");
+    PaintWidgets("widgets.clock", outDir, 1, 0, cell * 2);
+    timeLabel.setText("0:10");
+    PaintWidgets("widgets.carry", outDir, 1, 0, 2 * cell * 2);
+
+    // Only the columns between the old and new fill, growing or shrinking
+    progressBar.setValue(130);
+    PaintWidgets("widgets.bar", outDir, 1, 0, (FillWidth(130) - FillWidth(100)) * barRows * 2);
+    progressBar.setValue(50);
+    PaintWidgets("widgets.barBack", outDir, 1, 0, (FillWidth(130) - FillWidth(50)) * barRows * 2);
+
+    // Two steps of the bar before a paint touch and are drawn as one
+    progressBar.setValue(60);
+    progressBar.setValue(70);
+    PaintWidgets("widgets.merge", outDir, 1, 0, (FillWidth(70) - FillWidth(50)) * barRows * 2);
+
+    // A sprite button goes straight to the LCD, a far away label change
+    // is a rectangle of its own
+    playButton.setPressed(true);
+    timeLabel.setText("0:11");
+    PaintWidgets("widgets.press", outDir, 2, 1, (sprite + cell) * 2);
+    playButton.setPressed(false);
+    PaintWidgets("widgets.release", outDir, 1, 1, sprite * 2);
+
+    // From the first to the last character that differ, in the 20 rows
+    // of the status label
+    statusLabel.setText("paused... ");
+    PaintWidgets("widgets.status", outDir, 1, 0, 9 * 12 * 20 * 2);
+
+    // A shorter text clears the characters to the old end
+    statusLabel.setText("");
+    PaintWidgets("widgets.clear", outDir, 1, 0, 10 * 12 * 20 * 2);
+
+    // A new set of bands redraws the spectrum, a band that moved only the
+    // rows between its old and new bar tops
+    uint8_t levels[14], peaks[14];
+    for (int i = 0; i < 14; i++)
+    {
+        levels[i] = (uint8_t)(i * 4);
+        peaks[i] = (uint8_t)(i * 4 + 8);
+    }
+    spectrumBars.setLevels(levels, peaks, 14);
+    PaintWidgets("widgets.spectrum", outDir, 1, 0, 175 * 20 * 2);
+    levels[3] = 40;
+    spectrumBars.setLevels(levels, peaks, 14);
+    uint32_t band = (175 * 4 / 14) - (175 * 3 / 14) - 1;
+    uint32_t rows = (20 * 40 / 63) - (20 * 12 / 63);
+    PaintWidgets("widgets.band", outDir, 1, 0, band * rows * 2);
+    spectrumBars.setLevels(levels, peaks, 14);
+
+    // Nothing changed, nothing sent
+    StartFrame();
+    if (uiScreen.paint() != 0 || panel.stats().bytes != 0)
+    {
+        printf("widgets.idle sent %u bytes  EXPECTED none\n", panel.stats().bytes);
+        failures++;
+    }
+}
+
+static void ReadReference(const char *path)
+{
+    char line[256], name[64];
+    unsigned int bytes, cmd, pixel, xfers;
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "can't open %s\n", path);
+        exit(2);
+    }
+    while (fgets(line, sizeof(line), f))
+    {
+        if (sscanf(line, "%63s %u %u %u %u", name, &bytes, &cmd, &pixel, &xfers) == 5)
+        {
+            Cost cost = { bytes, xfers };
+            reference[name] = cost;
+        }
+    }
+    fclose(f);
+}
+
+static bool Selected(const char *name, int argc, char **argv, int first)
+{
+    if (first >= argc) return true;
+    for (int i = first; i < argc; i++)
+    {
+        if (strcmp(argv[i], name) == 0) return true;
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    const char *outDir = NULL;
+    int arg = 1;
+
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        if (strcmp(argv[arg], "-o") == 0) outDir = argv[arg + 1];
+        else if (strcmp(argv[arg], "-c") == 0) ReadReference(argv[arg + 1]);
+        else break;
+    }
+    if (arg < argc && argv[arg][0] == '-')
+    {
+        fprintf(stderr, "usage: ili9341Bench [-o dir] [-c reference] [scene...]\n");
+        return 2;
+    }
+
+    printf("%-18s %8s %6s %8s %6s %5s %5s %6s %4s\n", "#scene", "bytes", "cmd",
+        "pixel", "xfers", "dc", "win", "diff", "err");
+
+    lcd.setPjdfHandle(panel.attach());
+    StartFrame();
+    lcd.begin();
+    lcd.setRotation(0);
+    Report("init", NULL, NULL);
+    printf("%-18s %u ms of delays\n", "#init", panel.stats().delayMs);
+
+    for (int i = 0; i < gfxSceneCount; i++)
+    {
+        if (Selected(gfxScenes[i].name, argc, argv, arg)) RunScene(gfxScenes[i], outDir);
+    }
+    if (Selected("titleRoll", argc, argv, arg)) RunScroll(outDir);
+    if (Selected("trackList", argc, argv, arg))
+    {
+        RunTrackList(outDir, 50);
+        RunTrackList(outDir, 5000);
+    }
+    if (Selected("widgets", argc, argv, arg)) RunWidgets(outDir);
+
+    return failures ? 1 : 0;
+}
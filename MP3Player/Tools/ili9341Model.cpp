@@ -0,0 +1,383 @@
+/*
+    ili9341Model.cpp
+    Host only: a model of the ILI9341 panel behind the PJDF LCD driver,
+    see ili9341Model.h. Also the host Write(), Ioctl() and kernel calls
+    that Adafruit_ILI9341 makes.
+
+    Frame memory is kept as the panel stores it. On the Adafruit breakout
+    it is seen mirrored left to right, which is why rotation 0 sets MADCTL
+    MX; pixel() returns the picture the way it is seen, scrolling and
+    inversion included.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <string.h>
+
+#include "ili9341Model.h"
+
+// Commands the model acts on, as in Adafruit_ILI9341.h
+#define CMD_NOP         0x00
+#define CMD_SWRESET     0x01
+#define CMD_INVOFF      0x20
+#define CMD_INVON       0x21
+#define CMD_CASET       0x2A
+#define CMD_PASET       0x2B
+#define CMD_RAMWR       0x2C
+#define CMD_VSCRDEF     0x33
+#define CMD_MADCTL      0x36
+#define CMD_VSCRSADD    0x37
+
+#define MADCTL_MY       0x80
+#define MADCTL_MX       0x40
+#define MADCTL_MV       0x20
+
+Ili9341Model::Ili9341Model()
+    : gram((size_t)ILI9341_MODEL_WIDTH * ILI9341_MODEL_HEIGHT, 0)
+{
+    dcKnown = false;
+    dcData = false;
+    busy = false;
+    reset();
+    resetStats();
+}
+
+// Registers to their power on values. Frame memory is kept, as on the panel.
+void Ili9341Model::reset(void)
+{
+    cmd = CMD_NOP;
+    nParams = 0;
+    highByte = true;
+    pixelHigh = 0;
+    sc = 0;
+    ec = ILI9341_MODEL_WIDTH - 1;
+    sp = 0;
+    ep = ILI9341_MODEL_HEIGHT - 1;
+    col = sc;
+    page = sp;
+    madctl = 0;
+    inverted = false;
+    tfa = 0;
+    vsa = ILI9341_MODEL_HEIGHT;
+    bfa = 0;
+    vsp = 0;
+}
+
+void Ili9341Model::resetStats(void)
+{
+    memset(&counters, 0, sizeof(counters));
+    errorText = "";
+}
+
+const Ili9341WireStats &Ili9341Model::stats(void) const
+{
+    return counters;
+}
+
+// What the last error was
+const char *Ili9341Model::lastError(void) const
+{
+    return errorText;
+}
+
+void Ili9341Model::error(const char *what)
+{
+    counters.errors++;
+    errorText = what;
+}
+
+void Ili9341Model::setDc(bool data)
+{
+    // The driver counts its first select too, not knowing the line's level
+    if (!dcKnown || data != dcData) counters.dcChanges++;
+    dcKnown = true;
+    dcData = data;
+}
+
+// One SPI transfer through the driver's Write()
+void Ili9341Model::write(const uint8_t *bytes, uint32_t count)
+{
+    if (busy) error("write while a DMA block is in flight");
+    counters.transactions++;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        counters.bytes++;
+        if (dcData)
+        {
+            parameter(bytes[i]);
+        }
+        else
+        {
+            counters.commandBytes++;
+            command(bytes[i]);
+        }
+    }
+}
+
+// PJDF_CTRL_LCD_FILL: color sent count times as data
+void Ili9341Model::fill(uint16_t color, uint32_t count)
+{
+    if (busy) error("fill while a DMA block is in flight");
+    if (!dcData) error("fill with DC low");
+    counters.transactions++;
+    counters.bytes += count * 2;
+    while (count--)
+    {
+        parameter(color >> 8);
+        parameter(color & 0xFF);
+    }
+}
+
+// PJDF_CTRL_LCD_WRITE_PIXELS_START: pixels sent high byte first. The model
+// takes them at once; nothing else may reach it before waitPixels().
+void Ili9341Model::startPixels(const uint16_t *pixels, uint32_t count)
+{
+    if (busy) error("DMA block started while another is in flight");
+    if (!dcData) error("DMA block with DC low");
+    counters.transactions++;
+    counters.bytes += count * 2;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        parameter(pixels[i] >> 8);
+        parameter(pixels[i] & 0xFF);
+    }
+    busy = true;
+}
+
+void Ili9341Model::waitPixels(void)
+{
+    busy = false;
+}
+
+void Ili9341Model::sleep(uint32_t ms)
+{
+    counters.delayMs += ms;
+}
+
+void Ili9341Model::command(uint8_t c)
+{
+    if (cmd == CMD_RAMWR && !highByte) error("RAMWR ended half way through a pixel");
+
+    cmd = c;
+    nParams = 0;
+    switch (c)
+    {
+    case CMD_SWRESET:
+        reset();
+        break;
+    case CMD_INVOFF:
+        inverted = false;
+        break;
+    case CMD_INVON:
+        inverted = true;
+        break;
+    case CMD_CASET:
+    case CMD_PASET:
+        counters.windowSets++;
+        break;
+    case CMD_RAMWR:
+        counters.windows++;
+        col = sc;
+        page = sp;
+        highByte = true;
+        break;
+    }
+}
+
+void Ili9341Model::parameter(uint8_t b)
+{
+    if (cmd == CMD_RAMWR)
+    {
+        counters.pixelBytes++;
+        if (highByte)
+        {
+            pixelHigh = b;
+        }
+        else
+        {
+            storePixel((pixelHigh << 8) | b);
+        }
+        highByte = !highByte;
+        return;
+    }
+
+    if (cmd == CMD_NOP)
+    {
+        error("data without a command");
+        return;
+    }
+    if (nParams < sizeof(params)) params[nParams] = b;
+    nParams++;
+
+    switch (cmd)
+    {
+    case CMD_CASET:
+        if (nParams == 4)
+        {
+            sc = (params[0] << 8) | params[1];
+            ec = (params[2] << 8) | params[3];
+            if (sc > ec) error("CASET start after end");
+        }
+        break;
+    case CMD_PASET:
+        if (nParams == 4)
+        {
+            sp = (params[0] << 8) | params[1];
+            ep = (params[2] << 8) | params[3];
+            if (sp > ep) error("PASET start after end");
+        }
+        break;
+    case CMD_MADCTL:
+        if (nParams == 1) madctl = b;
+        break;
+    case CMD_VSCRDEF:
+        if (nParams == 6)
+        {
+            tfa = (params[0] << 8) | params[1];
+            vsa = (params[2] << 8) | params[3];
+            bfa = (params[4] << 8) | params[5];
+            if (tfa + vsa + bfa != ILI9341_MODEL_HEIGHT) error("VSCRDEF areas do not add up to 320");
+        }
+        break;
+    case CMD_VSCRSADD:
+        if (nParams == 2) vsp = (params[0] << 8) | params[1];
+        break;
+    }
+}
+
+// Store a pixel at the address counter and advance it, columns first
+void Ili9341Model::storePixel(uint16_t color)
+{
+    int x = col, y = page;
+    int maxCol = (madctl & MADCTL_MV) ? ILI9341_MODEL_HEIGHT : ILI9341_MODEL_WIDTH;
+    int maxPage = (madctl & MADCTL_MV) ? ILI9341_MODEL_WIDTH : ILI9341_MODEL_HEIGHT;
+
+    if (page > ep)
+    {
+        // The panel wraps to the start of the window, overwriting it
+        error("pixels past the end of the address window");
+        col = sc;
+        page = sp;
+        x = col;
+        y = page;
+    }
+
+    if (x >= maxCol || y >= maxPage)
+    {
+        error("pixel outside frame memory");
+    }
+    else
+    {
+        if (madctl & MADCTL_MV)
+        {
+            int t = x;
+            x = y;
+            y = t;
+        }
+        if (madctl & MADCTL_MX) x = ILI9341_MODEL_WIDTH - 1 - x;
+        if (madctl & MADCTL_MY) y = ILI9341_MODEL_HEIGHT - 1 - y;
+        gram[(size_t)y * ILI9341_MODEL_WIDTH + x] = color;
+        counters.pixels++;
+    }
+
+    if (++col > ec)
+    {
+        col = sc;
+        page++;
+    }
+}
+
+// Frame memory as stored, or 0 outside it
+uint16_t Ili9341Model::memory(int16_t column, int16_t row) const
+{
+    if (column < 0 || row < 0 || column >= ILI9341_MODEL_WIDTH || row >= ILI9341_MODEL_HEIGHT) return 0;
+    return gram[(size_t)row * ILI9341_MODEL_WIDTH + column];
+}
+
+// The pixel seen at x,y with the panel upright, 240 x 320
+uint16_t Ili9341Model::pixel(int16_t x, int16_t y) const
+{
+    int row = y;
+
+    if (vsa > 0 && row >= tfa && row < tfa + vsa)
+    {
+        int start = (vsp >= tfa && vsp < tfa + vsa) ? vsp - tfa : 0;
+        row = tfa + (row - tfa + start) % vsa;
+    }
+
+    uint16_t c = memory(ILI9341_MODEL_WIDTH - 1 - x, row);
+    return inverted ? ~c : c;
+}
+
+
+/************************************************************************************
+
+   Host versions of the PJDF and kernel calls the LCD code makes, all
+   going to the attached model
+
+************************************************************************************/
+
+static Ili9341Model *attached = NULL;
+
+BOOLEAN OSRunning = 1;
+uint32_t SystemCoreClock = 16000000;
+
+// Make this the model behind the LCD driver. Returns the handle to pass
+// to Adafruit_ILI9341::setPjdfHandle().
+HANDLE Ili9341Model::attach(void)
+{
+    attached = this;
+    return 1;
+}
+
+void OSTimeDly(INT32U ticks)
+{
+    if (attached != NULL) attached->sleep(ticks * 1000 / OS_TICKS_PER_SEC);
+}
+
+// Busy wait used before the kernel runs; OSRunning is always set here
+void delay(uint32_t time)
+{
+}
+
+PjdfErrCode Write(HANDLE handle, void* pBuffer, INT32U* pLength)
+{
+    if (handle != 1 || attached == NULL) return PJDF_ERR_INVALID_HANDLE;
+    attached->write((const uint8_t *)pBuffer, *pLength);
+    return PJDF_ERR_NONE;
+}
+
+PjdfErrCode Ioctl(HANDLE handle, INT8U request, void* pArgs, INT32U* pSize)
+{
+    if (handle != 1 || attached == NULL) return PJDF_ERR_INVALID_HANDLE;
+
+    switch (request)
+    {
+    case PJDF_CTRL_LCD_SELECT_DATA:
+        attached->setDc(true);
+        break;
+    case PJDF_CTRL_LCD_SELECT_COMMAND:
+        attached->setDc(false);
+        break;
+    case PJDF_CTRL_LCD_FILL:
+    {
+        if (pArgs == NULL || pSize == NULL || *pSize != sizeof(LcdFillArgs)) return PJDF_ERR_ARG;
+        LcdFillArgs *fill = (LcdFillArgs *)pArgs;
+        attached->fill(fill->color, fill->count);
+        break;
+    }
+    case PJDF_CTRL_LCD_WRITE_PIXELS_START:
+    {
+        if (pArgs == NULL || pSize == NULL || *pSize != sizeof(LcdPixelsArgs)) return PJDF_ERR_ARG;
+        LcdPixelsArgs *pixels = (LcdPixelsArgs *)pArgs;
+        attached->startPixels(pixels->pPixels, pixels->count);
+        break;
+    }
+    case PJDF_CTRL_LCD_WRITE_PIXELS_WAIT:
+        attached->waitPixels();
+        break;
+    default:
+        return PJDF_ERR_UNKNOWN_CTRL_REQUEST;
+    }
+    return PJDF_ERR_NONE;
+}
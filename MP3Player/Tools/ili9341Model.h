@@ -0,0 +1,102 @@
+/*
+    ili9341Model.h
+    Host only: a model of the ILI9341 panel behind the PJDF LCD driver.
+
+    Adafruit_ILI9341 built against Tools/host talks to the model through
+    the same Write() and Ioctl() calls it makes on the board. The model
+    decodes the byte stream the panel would see on its SPI and DC lines:
+    commands and their parameters, CASET/PASET address windows, RAMWR
+    pixel data, MADCTL rotation and vertical scrolling. It keeps the
+    panel's frame memory, so the picture can be checked, and counts what
+    each frame cost on the wire.
+
+        Ili9341Model panel;
+        Adafruit_ILI9341 lcd;
+        lcd.setPjdfHandle(panel.attach());
+        lcd.begin();
+        panel.resetStats();
+        ...draw...
+        panel.stats()   // bytes, transactions, windows of the drawing
+
+    Anything the panel would misread, such as data without a command,
+    pixels past the end of the window or a transfer started before the
+    last DMA block was waited for, is counted in errors.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __ILI9341MODEL_H__
+#define __ILI9341MODEL_H__
+
+#include <stdint.h>
+#include <vector>
+
+#include "pjdf.h"
+
+#define ILI9341_MODEL_WIDTH     240     // frame memory columns
+#define ILI9341_MODEL_HEIGHT    320     // frame memory rows
+
+typedef struct
+{
+    uint32_t bytes;         // every byte on the wire
+    uint32_t commandBytes;  // bytes sent with DC low
+    uint32_t pixelBytes;    // RAMWR data
+    uint32_t transactions;  // driver Write() calls, fills and DMA blocks
+    uint32_t dcChanges;     // times the DC line changed level
+    uint32_t windows;       // RAMWR commands, one per address window drawn
+    uint32_t windowSets;    // CASET and PASET commands
+    uint32_t pixels;        // pixels stored in frame memory
+    uint32_t errors;        // see lastError()
+    uint32_t delayMs;       // time the driver slept or waited
+} Ili9341WireStats;
+
+class Ili9341Model
+{
+public:
+    Ili9341Model();
+
+    HANDLE attach(void);
+    void reset(void);
+
+    // The driver side, called through the host Write() and Ioctl()
+    void setDc(bool data);
+    void write(const uint8_t *bytes, uint32_t count);
+    void fill(uint16_t color, uint32_t count);
+    void startPixels(const uint16_t *pixels, uint32_t count);
+    void waitPixels(void);
+    void sleep(uint32_t ms);
+
+    uint16_t pixel(int16_t x, int16_t y) const;
+    uint16_t memory(int16_t column, int16_t row) const;
+
+    void resetStats(void);
+    const Ili9341WireStats &stats(void) const;
+    const char *lastError(void) const;
+
+private:
+    void command(uint8_t c);
+    void parameter(uint8_t b);
+    void storePixel(uint16_t color);
+    void error(const char *what);
+
+    std::vector<uint16_t> gram;
+    Ili9341WireStats counters;
+    const char *errorText;
+
+    bool dcKnown;           // DC set at least once
+    bool dcData;            // DC high
+    bool busy;              // a DMA block is in flight
+    uint8_t cmd;            // last command, 0 (NOP) before any
+    uint8_t params[16];
+    uint8_t nParams;
+    bool highByte;          // RAMWR: next data byte starts a pixel
+    uint8_t pixelHigh;
+
+    uint16_t sc, ec, sp, ep;    // address window, column and page
+    uint16_t col, page;         // RAMWR address counter
+    uint8_t madctl;
+    bool inverted;
+    uint16_t tfa, vsa, bfa, vsp; // vertical scroll definition and start
+};
+
+#endif /* __ILI9341MODEL_H__ */
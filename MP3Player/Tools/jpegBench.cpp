@@ -0,0 +1,465 @@
+/*
+    jpegBench.cpp
+    Host tool: checks and times the album art decoder (Util/jpegDecode.c)
+    and ID3 picture finder (App/id3.c) on a PC.
+
+    Test pictures are drawn and compressed with libjpeg in the layouts the
+    decoder supports, each wrapped in an ID3v2 tag in front of some MP3
+    frames, as a song carries its album art. Each is then found and decoded
+    through the firmware code at every scale and compared with libjpeg's
+    own decode at the same scale. A part off the centre is then decoded by
+    itself, as album art too large for its thumbnail is cropped, and must
+    be the same pixels as that part of the whole picture.
+
+    Build:  g++ -O2 -Ihost -I../Util -I../App -o jpegBench jpegBench.cpp
+                ../Util/jpegDecode.c ../Util/pixelKernels.c ../App/id3.c -ljpeg
+    Usage:  jpegBench [-n iterations] [picture...]
+            -n  decodes to time each picture and scale over, 50 by default
+            Pictures are named on the command line, all run otherwise.
+
+    Output, one line per picture and scale:
+        name  tag  JPEG bytes  scale  size decoded  microseconds per decode
+        row buffer bytes  PSNR against libjpeg in dB
+    Exits with 1 if a picture isn't found or decoded, is decoded with a
+    PSNR under 30 dB, or if its part differs (CROP). The decoder's own RAM is printed first.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <jpeglib.h>
+
+#include "jpegDecode.h"
+#include "pixelKernels.h"
+#include "id3.h"
+
+#define MIN_PSNR        30.0
+
+typedef struct
+{
+    const char *name;
+    int width, height;
+    int components;     // 1 or 3
+    int h, v;           // luma sampling factors against chroma
+    int quality;
+    int restartRows;    // MCU rows per restart interval, 0 for none
+    int id3Version;     // tag the picture is wrapped in, 2 to 4
+} TestPicture;
+
+static const TestPicture pictures[] =
+{
+    { "cover420",     300, 300, 3, 2, 2, 75, 0, 3 },
+    { "cover420q95",  300, 300, 3, 2, 2, 95, 0, 4 },
+    { "large420",     600, 600, 3, 2, 2, 85, 0, 3 },
+    { "cover422",     300, 300, 3, 2, 1, 75, 0, 3 },
+    { "cover440",     300, 300, 3, 1, 2, 75, 0, 2 },
+    { "cover444",     200, 200, 3, 1, 1, 75, 0, 4 },
+    { "gray",         300, 300, 1, 1, 1, 75, 0, 3 },
+    { "restart420",   300, 300, 3, 2, 2, 75, 1, 3 },
+    { "odd420",       123,  77, 3, 2, 2, 80, 2, 2 },
+    { "thumb420",      56,  56, 3, 2, 2, 75, 0, 4 },
+};
+#define NUM_PICTURES (int)(sizeof(pictures) / sizeof(pictures[0]))
+
+// A picture with edges, gradients and flat areas, like cover art
+static void DrawPicture(const TestPicture &p, std::vector<uint8_t> &rgb)
+{
+    rgb.resize((size_t)p.width * p.height * 3);
+    for (int y = 0; y < p.height; y++)
+    {
+        for (int x = 0; x < p.width; x++)
+        {
+            uint8_t *px = &rgb[((size_t)y * p.width + x) * 3];
+            double fx = (double)x / p.width, fy = (double)y / p.height;
+            double dx = fx - 0.5, dy = fy - 0.45;
+            int r = (int)(255 * fx), g = (int)(255 * fy), b = 160;
+            if (dx * dx + dy * dy < 0.06) { r = 250; g = 200; b = 40; }
+            if (((x / 12) + (y / 12)) % 2 == 0 && fy > 0.8) { r = g = b = 20; }
+            if (fy > 0.1 && fy < 0.14) { r = g = b = 255; }
+            px[0] = (uint8_t)r;
+            px[1] = (uint8_t)g;
+            px[2] = (uint8_t)b;
+        }
+    }
+}
+
+static std::vector<uint8_t> Compress(const TestPicture &p, const std::vector<uint8_t> &rgb)
+{
+    jpeg_compress_struct cinfo;
+    jpeg_error_mgr jerr;
+    unsigned char *out = NULL;
+    unsigned long outSize = 0;
+    std::vector<uint8_t> gray;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    jpeg_mem_dest(&cinfo, &out, &outSize);
+    cinfo.image_width = p.width;
+    cinfo.image_height = p.height;
+    cinfo.input_components = p.components;
+    cinfo.in_color_space = p.components == 1 ? JCS_GRAYSCALE : JCS_RGB;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, p.quality, TRUE);
+    if (p.components == 3)
+    {
+        cinfo.comp_info[0].h_samp_factor = p.h;
+        cinfo.comp_info[0].v_samp_factor = p.v;
+    }
+    cinfo.restart_in_rows = p.restartRows;
+    jpeg_start_compress(&cinfo, TRUE);
+
+    if (p.components == 1)
+    {
+        gray.resize((size_t)p.width * p.height);
+        for (size_t i = 0; i < gray.size(); i++)
+            gray[i] = (uint8_t)((rgb[i * 3] * 77 + rgb[i * 3 + 1] * 150 + rgb[i * 3 + 2] * 29) >> 8);
+    }
+    while (cinfo.next_scanline < cinfo.image_height)
+    {
+        JSAMPROW row = p.components == 1 ? &gray[(size_t)cinfo.next_scanline * p.width] :
+            (JSAMPROW)&rgb[(size_t)cinfo.next_scanline * p.width * 3];
+        jpeg_write_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    jpeg_destroy_compress(&cinfo);
+
+    std::vector<uint8_t> jpeg(out, out + outSize);
+    free(out);
+    return jpeg;
+}
+
+// libjpeg's decode at 1 / (1 << scale), the way the firmware decoder
+// works: accurate integer IDCT, chroma replicated rather than interpolated
+static std::vector<uint8_t> Reference(const std::vector<uint8_t> &jpeg, int scale, int *pW, int *pH)
+{
+    jpeg_decompress_struct cinfo;
+    jpeg_error_mgr jerr;
+
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, (unsigned char *)&jpeg[0], jpeg.size());
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 1 << scale;
+    cinfo.dct_method = JDCT_ISLOW;
+    cinfo.do_fancy_upsampling = FALSE;
+    cinfo.out_color_space = JCS_RGB;
+    jpeg_start_decompress(&cinfo);
+
+    *pW = cinfo.output_width;
+    *pH = cinfo.output_height;
+    std::vector<uint8_t> rgb((size_t)*pW * *pH * 3);
+    while (cinfo.output_scanline < cinfo.output_height)
+    {
+        JSAMPROW row = &rgb[(size_t)cinfo.output_scanline * *pW * 3];
+        jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return rgb;
+}
+
+static void PutSize(std::vector<uint8_t> &out, uint32_t size, int bytes, bool syncsafe)
+{
+    for (int i = bytes - 1; i >= 0; i--)
+        out.push_back(syncsafe ? (size >> (7 * i)) & 0x7F : (size >> (8 * i)) & 0xFF);
+}
+
+static void PutFrame(std::vector<uint8_t> &out, int version, const char *id,
+    const std::vector<uint8_t> &body)
+{
+    if (version == 2)
+    {
+        out.insert(out.end(), id, id + 3);
+        PutSize(out, body.size(), 3, false);
+    }
+    else
+    {
+        out.insert(out.end(), id, id + 4);
+        PutSize(out, body.size(), 4, version == 4);
+        out.push_back(0);
+        out.push_back(0);
+    }
+    out.insert(out.end(), body.begin(), body.end());
+}
+
+// An MP3 with the picture as its album art: an ID3v2 tag holding a title
+// and the picture, padding, then a few silent MP3 frames
+static std::vector<uint8_t> WrapInId3(const std::vector<uint8_t> &jpeg, int version)
+{
+    static const char title[] = "Test Title";
+    std::vector<uint8_t> frames, text, picture;
+
+    text.push_back(0);
+    text.insert(text.end(), title, title + sizeof(title) - 1);
+    PutFrame(frames, version, version == 2 ? "TT2" : "TIT2", text);
+
+    if (version == 2)
+    {
+        picture.push_back(0);                   // Latin-1
+        picture.insert(picture.end(), "JPG", "JPG" + 3);
+        picture.push_back(ID3_PICTURE_FRONT_COVER);
+        picture.push_back(0);                   // no description
+    }
+    else
+    {
+        static const char mime[] = "image/jpeg";
+        static const uint8_t description[] = { 0xFF, 0xFE, 'C', 0, 'o', 0, 'v', 0, 0, 0 };
+        picture.push_back(1);                   // UTF-16 description
+        picture.insert(picture.end(), mime, mime + sizeof(mime));
+        picture.push_back(ID3_PICTURE_FRONT_COVER);
+        picture.insert(picture.end(), description, description + sizeof(description));
+    }
+    picture.insert(picture.end(), jpeg.begin(), jpeg.end());
+    PutFrame(frames, version, version == 2 ? "PIC" : "APIC", picture);
+    frames.resize(frames.size() + 64, 0);       // padding
+
+    std::vector<uint8_t> mp3;
+    mp3.push_back('I');
+    mp3.push_back('D');
+    mp3.push_back('3');
+    mp3.push_back((uint8_t)version);
+    mp3.push_back(0);
+    mp3.push_back(0);
+    PutSize(mp3, frames.size(), 4, true);
+    mp3.insert(mp3.end(), frames.begin(), frames.end());
+    for (int i = 0; i < 4; i++)
+    {
+        static const uint8_t header[] = { 0xFF, 0xFB, 0x90, 0x64 };
+        mp3.insert(mp3.end(), header, header + sizeof(header));
+        mp3.resize(mp3.size() + 413, 0);
+    }
+    return mp3;
+}
+
+// The MP3 as the firmware reads it from flash
+typedef struct
+{
+    const uint8_t *data;
+    INT32U left;
+} Stream;
+
+static INT32U ReadStream(void *ctx, INT8U *buf, INT32U len)
+{
+    Stream *s = (Stream *)ctx;
+    if (len > s->left) len = s->left;
+    memcpy(buf, s->data, len);
+    s->data += len;
+    s->left -= len;
+    return len;
+}
+
+// The picture's bytes only, as albumArt.c limits the decoder to them
+typedef struct
+{
+    Stream *mp3;
+    INT32U left;
+} Picture;
+
+static INT32U ReadPicture(void *ctx, INT8U *buf, INT32U len)
+{
+    Picture *p = (Picture *)ctx;
+    if (len > p->left) len = p->left;
+    len = ReadStream(p->mp3, buf, len);
+    p->left -= len;
+    return len;
+}
+
+typedef struct
+{
+    std::vector<uint16_t> image;
+    int width;
+    int nextY;          // rows must arrive in order
+    bool bad;
+} Output;
+
+static void PutRows(void *ctx, INT16U x, INT16U y, INT16U w, INT16U h, const INT16U *pixels)
+{
+    Output *o = (Output *)ctx;
+    if (x != 0 || y != o->nextY || w != o->width || (size_t)(y + h) * w > o->image.size())
+    {
+        o->bad = true;
+        return;
+    }
+    memcpy(&o->image[(size_t)y * w], pixels, (size_t)w * h * sizeof(uint16_t));
+    o->nextY = y + h;
+}
+
+// Find and decode the picture in an MP3 at a scale, the part at left, top
+// at most maxW x maxH of it
+static JpegErr Decode(const std::vector<uint8_t> &mp3, int scale, JpegDecoder *jpeg,
+    std::vector<uint16_t> &rows, Output *out, INT16U left = 0, INT16U top = 0,
+    INT16U maxW = 0xFFFF, INT16U maxH = 0xFFFF)
+{
+    Stream stream = { &mp3[0], (INT32U)mp3.size() };
+    Id3Picture found;
+    Id3Err id3Err = Id3FindPicture(ReadStream, &stream, &found);
+    if (ID3_IS_ERROR(id3Err))
+    {
+        fprintf(stderr, "no picture found (%d)\n", id3Err);
+        exit(1);
+    }
+
+    Picture picture = { &stream, found.size };
+    JpegErr err = JpegOpen(jpeg, ReadPicture, &picture);
+    if (JPEG_IS_ERROR(err)) return err;
+
+    INT16U w = JpegScaledWidth(jpeg, (INT8U)scale) - left;
+    INT16U h = JpegScaledHeight(jpeg, (INT8U)scale) - top;
+    if (w > maxW) w = maxW;
+    if (h > maxH) h = maxH;
+    rows.resize(JpegRowBufferPixels(jpeg, (INT8U)scale, w));
+    out->image.assign((size_t)w * h, 0);
+    out->width = w;
+    out->nextY = 0;
+    out->bad = false;
+    err = JpegDecode(jpeg, (INT8U)scale, &rows[0], left, top, w, h, PutRows, out);
+    if (!JPEG_IS_ERROR(err) && (out->bad || out->nextY != h)) err = JPEG_ERR_ARG;
+    return err;
+}
+
+// Decode the part of a third of the way in, half the size, which starts
+// and ends part way through MCUs, and compare it with the whole picture
+static bool CropMatches(const std::vector<uint8_t> &mp3, int scale, JpegDecoder *jpeg,
+    const Output &whole)
+{
+    std::vector<uint16_t> rows;
+    Output part;
+    int height = (int)(whole.image.size() / whole.width);
+    INT16U left = (INT16U)(whole.width / 3), top = (INT16U)(height / 3);
+    INT16U w = (INT16U)((whole.width + 1) / 2), h = (INT16U)((height + 1) / 2);
+
+    if (JPEG_IS_ERROR(Decode(mp3, scale, jpeg, rows, &part, left, top, w, h))) return false;
+    if (part.width != w || part.image.size() != (size_t)w * h) return false;
+    for (int y = 0; y < h; y++)
+    {
+        if (memcmp(&part.image[(size_t)y * w], &whole.image[(size_t)(top + y) * whole.width + left],
+            w * sizeof(uint16_t)) != 0) return false;
+    }
+    return true;
+}
+
+static uint8_t Expand5(uint16_t v) { return (uint8_t)((v << 3) | (v >> 2)); }
+static uint8_t Expand6(uint16_t v) { return (uint8_t)((v << 2) | (v >> 4)); }
+
+// PSNR of the decoded RGB565 picture against libjpeg's, rounded to RGB565
+// as the decoder does
+static double Psnr(const std::vector<uint16_t> &image, const std::vector<uint8_t> &ref)
+{
+    double sum = 0;
+    for (size_t i = 0; i < image.size(); i++)
+    {
+        const uint8_t *r = &ref[i * 3];
+        uint16_t mine = image[i];
+        uint16_t theirs;
+        PixelRgb888To565Ref(r, &theirs, 1);
+        int d[3] =
+        {
+            Expand5(mine >> 11) - Expand5(theirs >> 11),
+            Expand6((mine >> 5) & 0x3F) - Expand6((theirs >> 5) & 0x3F),
+            Expand5(mine & 0x1F) - Expand5(theirs & 0x1F)
+        };
+        sum += d[0] * d[0] + d[1] * d[1] + d[2] * d[2];
+    }
+    double mse = sum / (image.size() * 3.0);
+    return mse == 0 ? 99.0 : 10 * log10(255.0 * 255.0 / mse);
+}
+
+static bool Selected(const char *name, int argc, char **argv, int first)
+{
+    if (first >= argc) return true;
+    for (int i = first; i < argc; i++)
+    {
+        if (strcmp(argv[i], name) == 0) return true;
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 50;
+    int arg = 1;
+    int failures = 0;
+
+    for (; arg + 1 < argc && argv[arg][0] == '-'; arg += 2)
+    {
+        if (strcmp(argv[arg], "-n") == 0) iterations = atoi(argv[arg + 1]);
+        else break;
+    }
+    if ((arg < argc && argv[arg][0] == '-') || iterations < 1)
+    {
+        fprintf(stderr, "usage: jpegBench [-n iterations] [picture...]\n");
+        return 2;
+    }
+
+    static JpegDecoder jpeg;
+    printf("#JpegDecoder %u bytes, input buffer %u bytes\n",
+        (unsigned)sizeof(JpegDecoder), (unsigned)JPEG_IN_BUF_SIZE);
+    printf("%-12s %3s %6s %5s %9s %8s %6s %6s\n", "#picture", "tag", "bytes", "scale",
+        "size", "us", "rowbuf", "psnr");
+
+    for (int i = 0; i < NUM_PICTURES; i++)
+    {
+        const TestPicture &p = pictures[i];
+        if (!Selected(p.name, argc, argv, arg)) continue;
+
+        std::vector<uint8_t> rgb;
+        DrawPicture(p, rgb);
+        std::vector<uint8_t> compressed = Compress(p, rgb);
+        std::vector<uint8_t> mp3 = WrapInId3(compressed, p.id3Version);
+
+        for (int scale = JPEG_SCALE_1; scale <= JPEG_SCALE_1_8; scale++)
+        {
+            std::vector<uint16_t> rows;
+            Output out;
+            int refW, refH;
+
+            JpegErr err = Decode(mp3, scale, &jpeg, rows, &out);
+            printf("%-12s %3d %6u   1/%d", p.name, p.id3Version, (unsigned)compressed.size(), 1 << scale);
+            if (JPEG_IS_ERROR(err))
+            {
+                printf("  DECODE ERROR %d\n", err);
+                failures++;
+                continue;
+            }
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int n = 0; n < iterations; n++) Decode(mp3, scale, &jpeg, rows, &out);
+            double us = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - start).count() / iterations;
+
+            std::vector<uint8_t> ref = Reference(compressed, scale, &refW, &refH);
+            int height = (int)(out.image.size() / out.width);
+            char size[16];
+            snprintf(size, sizeof(size), "%dx%d", out.width, height);
+            printf(" %9s %8.1f %6u", size, us, (unsigned)(rows.size() * sizeof(uint16_t)));
+            if (refW != out.width || refH != height)
+            {
+                printf("  SIZE, libjpeg %dx%d\n", refW, refH);
+                failures++;
+                continue;
+            }
+            double psnr = Psnr(out.image, ref);
+            printf(" %6.1f", psnr);
+            if (psnr < MIN_PSNR)
+            {
+                printf("  LOW");
+                failures++;
+            }
+            if (!CropMatches(mp3, scale, &jpeg, out))
+            {
+                printf("  CROP");
+                failures++;
+            }
+            printf("\n");
+        }
+    }
+    return failures ? 1 : 0;
+}
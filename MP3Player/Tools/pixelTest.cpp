@@ -0,0 +1,231 @@
+/*
+    pixelTest.cpp
+    Host tool: checks that the fast pixel kernels (Util/pixelKernels.c) give
+    bit for bit what their reference versions do, and times both.
+
+    The Cortex-M4 DSP instructions are emulated (host/core_cmSimd.h), so
+    the kernels checked are the ones the board runs. The times are the
+    PC's, where the emulated instructions make the fast rgb888To565 the
+    slower one; App/pixelBench.c measures cycles on the board.
+
+    Build:  g++ -O2 -Ihost -I../Util -o pixelTest pixelTest.cpp ../Util/pixelKernels.c
+    Usage:  pixelTest [-n iterations]
+            -n  passes over a 240 pixel line to time each kernel over,
+                20000 by default
+
+    Output, one line per kernel:
+        name  pixels checked  mismatches  ns per pixel, reference and fast
+    Exits with 1 if any pixel differs.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "pixelKernels.h"
+
+#define LINE    240         // pixels, a row of the panel
+
+#if !PIXEL_SIMD_EN
+#error "pixelTest needs host/core_cmSimd.h ahead of the firmware headers"
+#endif
+
+static uint32_t seed = 1;
+
+static uint32_t Random(void)
+{
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+}
+
+typedef struct
+{
+    unsigned long checked;
+    unsigned long mismatches;
+} Check;
+
+static void Compare(Check *c, const void *ref, const void *fast, size_t bytes, size_t pixelSize)
+{
+    const uint8_t *a = (const uint8_t *)ref, *b = (const uint8_t *)fast;
+    for (size_t i = 0; i < bytes; i += pixelSize)
+    {
+        if (memcmp(a + i, b + i, pixelSize) != 0) c->mismatches++;
+        c->checked++;
+    }
+}
+
+// Every 24 bit color, from every byte alignment and with counts that
+// leave a tail after the four pixel steps
+static Check CheckRgb888(void)
+{
+    Check c = { 0, 0 };
+    std::vector<uint8_t> rgb(3 * 4099 + 3);
+    std::vector<uint16_t> ref(4099), fast(4099);
+    uint32_t color = 0;
+
+    for (int pass = 0; color < 0x1000000; pass++)
+    {
+        int offset = pass & 3;
+        int count = 4096 + (pass % 4);
+        for (int i = 0; i < count; i++, color++)
+        {
+            rgb[offset + i * 3] = color >> 16;
+            rgb[offset + i * 3 + 1] = color >> 8;
+            rgb[offset + i * 3 + 2] = color;
+        }
+        PixelRgb888To565Ref(&rgb[offset], &ref[0], count);
+        PixelRgb888To565(&rgb[offset], &fast[0], count);
+        Compare(&c, &ref[0], &fast[0], count * 2, 2);
+    }
+    return c;
+}
+
+// Every pixel value, to every byte alignment
+static Check CheckSwap(void)
+{
+    Check c = { 0, 0 };
+    std::vector<uint16_t> in(65537);
+    std::vector<uint8_t> ref(2 * 65537 + 3), fast(2 * 65537 + 3);
+
+    for (uint32_t i = 0; i < in.size(); i++) in[i] = (uint16_t)i;
+    for (int offset = 0; offset < 4; offset++)
+    {
+        int count = 65536 + (offset & 1);
+        PixelSwap565Ref(&in[0], &ref[offset], count);
+        PixelSwap565(&in[0], &fast[offset], count);
+        Compare(&c, &ref[offset], &fast[offset], count * 2, 2);
+    }
+    return c;
+}
+
+// Every alpha against random colors, including black and white, and
+// blending in place over bg
+static Check CheckBlend(bool oneColor)
+{
+    Check c = { 0, 0 };
+    std::vector<uint16_t> fg(LINE), bg(LINE), ref(LINE), fast(LINE);
+    std::vector<uint8_t> alpha(LINE);
+
+    for (int pass = 0; pass < 20000; pass++)
+    {
+        uint16_t color = pass < 2 ? (pass ? 0xFFFF : 0) : (uint16_t)Random();
+        for (int i = 0; i < LINE; i++)
+        {
+            fg[i] = (pass & 1) ? 0xFFFF - (uint16_t)Random() : (uint16_t)Random();
+            bg[i] = (pass % 3 == 0) ? (uint16_t)(pass & 1 ? 0 : 0xFFFF) : (uint16_t)Random();
+            alpha[i] = (uint8_t)(pass + i);
+        }
+        if (oneColor) PixelBlendColor565Ref(color, &bg[0], &alpha[0], &ref[0], LINE);
+        else PixelBlend565Ref(&fg[0], &bg[0], &alpha[0], &ref[0], LINE);
+
+        fast = bg;
+        if (oneColor) PixelBlendColor565(color, &fast[0], &alpha[0], &fast[0], LINE);
+        else PixelBlend565(&fg[0], &fast[0], &alpha[0], &fast[0], LINE);
+        Compare(&c, &ref[0], &fast[0], LINE * 2, 2);
+    }
+    return c;
+}
+
+// Random images, flat ones at the extremes, and a stride wider than the image
+static Check CheckDownscale(void)
+{
+    Check c = { 0, 0 };
+    const int w = LINE / 2, h = 8, stride = LINE + 3;
+    std::vector<uint16_t> in((size_t)stride * h * 2), ref(w * h), fast(w * h);
+
+    for (int pass = 0; pass < 4000; pass++)
+    {
+        for (size_t i = 0; i < in.size(); i++)
+        {
+            in[i] = pass == 0 ? 0xFFFF : (pass == 1 ? 0 : (uint16_t)Random());
+        }
+        // Odd passes start on an odd halfword, as a window into a larger image
+        const uint16_t *p = &in[pass & 1];
+        PixelDownscale565Ref(p, stride, &ref[0], w - (pass & 1), h);
+        PixelDownscale565(p, stride, &fast[0], w - (pass & 1), h);
+        Compare(&c, &ref[0], &fast[0], (w - (pass & 1)) * h * 2, 2);
+    }
+    return c;
+}
+
+typedef void (*Kernel)(void);
+
+static std::vector<uint8_t> lineRgb(LINE * 3), lineBytes(LINE * 2 + 1), lineAlpha(LINE);
+static std::vector<uint16_t> lineFg(LINE), lineBg(LINE), lineOut(LINE), box(LINE * 2);
+
+static void Rgb888Ref(void) { PixelRgb888To565Ref(&lineRgb[0], &lineOut[0], LINE); }
+static void Rgb888Fast(void) { PixelRgb888To565(&lineRgb[0], &lineOut[0], LINE); }
+static void SwapRef(void) { PixelSwap565Ref(&lineFg[0], &lineBytes[1], LINE); }
+static void SwapFast(void) { PixelSwap565(&lineFg[0], &lineBytes[1], LINE); }
+static void BlendRef(void) { PixelBlend565Ref(&lineFg[0], &lineBg[0], &lineAlpha[0], &lineOut[0], LINE); }
+static void BlendFast(void) { PixelBlend565(&lineFg[0], &lineBg[0], &lineAlpha[0], &lineOut[0], LINE); }
+static void ColorRef(void) { PixelBlendColor565Ref(0xFFE0, &lineBg[0], &lineAlpha[0], &lineOut[0], LINE); }
+static void ColorFast(void) { PixelBlendColor565(0xFFE0, &lineBg[0], &lineAlpha[0], &lineOut[0], LINE); }
+static void DownRef(void) { PixelDownscale565Ref(&box[0], LINE, &lineOut[0], LINE / 2, 1); }
+static void DownFast(void) { PixelDownscale565(&box[0], LINE, &lineOut[0], LINE / 2, 1); }
+
+// ns per pixel of a kernel run over a line
+static double Time(Kernel kernel, int iterations, int pixels)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) kernel();
+    return std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - start).count() / iterations / pixels;
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 20000;
+    int failures = 0;
+
+    if (argc == 3 && strcmp(argv[1], "-n") == 0) iterations = atoi(argv[2]);
+    if ((argc != 1 && argc != 3) || iterations < 1)
+    {
+        fprintf(stderr, "usage: pixelTest [-n iterations]\n");
+        return 2;
+    }
+
+    // Text-like alpha: mostly clear or solid, edges in between
+    for (int i = 0; i < LINE; i++)
+    {
+        lineRgb[i * 3] = (uint8_t)Random();
+        lineRgb[i * 3 + 1] = (uint8_t)Random();
+        lineRgb[i * 3 + 2] = (uint8_t)Random();
+        lineFg[i] = (uint16_t)Random();
+        lineBg[i] = (uint16_t)Random();
+        box[i] = (uint16_t)Random();
+        box[LINE + i] = (uint16_t)Random();
+        uint32_t r = Random() % 8;
+        lineAlpha[i] = r < 3 ? 0 : (r < 6 ? 255 : (uint8_t)Random());
+    }
+
+    struct
+    {
+        const char *name;
+        Check check;
+        Kernel ref, fast;
+        int pixels;
+    } kernels[] =
+    {
+        { "rgb888To565", CheckRgb888(), Rgb888Ref, Rgb888Fast, LINE },
+        { "swap565", CheckSwap(), SwapRef, SwapFast, LINE },
+        { "blend565", CheckBlend(false), BlendRef, BlendFast, LINE },
+        { "blendColor565", CheckBlend(true), ColorRef, ColorFast, LINE },
+        { "downscale565", CheckDownscale(), DownRef, DownFast, LINE / 2 },
+    };
+
+    printf("%-14s %9s %6s %7s %7s\n", "#kernel", "checked", "wrong", "ref ns", "fast ns");
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++)
+    {
+        double ref = Time(kernels[k].ref, iterations, kernels[k].pixels);
+        double fast = Time(kernels[k].fast, iterations, kernels[k].pixels);
+        printf("%-14s %9lu %6lu %7.2f %7.2f\n", kernels[k].name, kernels[k].check.checked,
+            kernels[k].check.mismatches, ref, fast);
+        if (kernels[k].check.mismatches != 0) failures++;
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,252 @@
+/*
+    spectrumTest.cpp
+    Host tool: runs the spectrum analyzer reader (App/spectrum.c) against a
+    model of the VS1053's SCI registers and checks what it publishes.
+
+    The model keeps the decoder's X memory behind SCI_WRAMADDR and
+    SCI_WRAM, so the analyzer's band count and values can be set as the
+    plugin would leave them, counts the SCI operations made and follows
+    the command and data chip selects. Each check feeds a set of values through SpectrumRead()
+    and looks at what SpectrumGet() gives:
+        load     the plugin image in the tree loads as SCI writes only,
+                 and reads fall due only if it is not the empty stand-in
+        read     levels and peaks of every band, one SCI op per band and
+                 three more, the driver left in data mode
+        repeat   no new sequence number without a read
+        bands    a band count past SPECTRUM_MAX_BANDS is cut to it
+        vu       the VU level is the RMS of the levels, rises at once and
+                 falls back SPECTRUM_VU_FALL a read
+    The UiSpectrum side, repainting only the rows of bars that moved, is
+    checked by ili9341Bench's widgets scenes.
+
+    Build:  g++ -O2 -Ihost -I../PJDF -I../App -o spectrumTest spectrumTest.cpp ../App/spectrum.c
+    Usage:  spectrumTest
+
+    Output, one line per check: name, then ok or what was wrong.
+    Exits with 1 if any check fails.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <map>
+
+#include "bsp.h"
+#include "pjdf.h"
+#include "spectrum.h"
+
+#define MP3_HANDLE      2
+
+// SCI instructions and registers, and the analyzer's memory, as in spectrum.c
+#define SCI_WRITE       0x02
+#define SCI_READ        0x03
+#define SCI_WRAM        0x06
+#define SCI_WRAMADDR    0x07
+#define SA_BANDS_ADDR   0x1802
+#define SA_VALUES_ADDR  0x1804
+
+DWT_Type hostDwt;
+CoreDebug_Type hostCoreDebug;
+uint32_t SystemCoreClock = 84000000;
+
+static INT32U ticks = 0;
+
+INT32U OSTimeGet(void)
+{
+    return ticks;
+}
+
+// The decoder as seen through the MP3 driver
+static struct
+{
+    bool command;                       // command chip select asserted
+    INT16U address;                     // next SCI_WRAM word
+    std::map<INT16U, INT16U> memory;
+    unsigned long writes, reads;        // SCI operations
+    unsigned long wramWrites;           // words written to memory
+    unsigned long badOps;               // SCI ops in data mode, unknown instructions
+} vs1053;
+
+PjdfErrCode Write(HANDLE handle, void* pBuffer, INT32U* pLength)
+{
+    const INT8U *cmd = (const INT8U *)pBuffer;
+    if (handle != MP3_HANDLE) return PJDF_ERR_INVALID_HANDLE;
+    if (!vs1053.command) return PJDF_ERR_NONE;  // MP3 data
+    if (*pLength != 4 || cmd[0] != SCI_WRITE)
+    {
+        vs1053.badOps++;
+        return PJDF_ERR_ARG;
+    }
+
+    INT16U value = (INT16U)((cmd[2] << 8) | cmd[3]);
+    vs1053.writes++;
+    if (cmd[1] == SCI_WRAMADDR) vs1053.address = value;
+    else if (cmd[1] == SCI_WRAM)
+    {
+        vs1053.memory[vs1053.address++] = value;
+        vs1053.wramWrites++;
+    }
+    return PJDF_ERR_NONE;
+}
+
+PjdfErrCode Read(HANDLE handle, void* pBuffer, INT32U* pLength)
+{
+    INT8U *cmd = (INT8U *)pBuffer;
+    if (handle != MP3_HANDLE) return PJDF_ERR_INVALID_HANDLE;
+    if (!vs1053.command || *pLength != 4 || cmd[0] != SCI_READ)
+    {
+        vs1053.badOps++;
+        return PJDF_ERR_ARG;
+    }
+
+    INT16U value = 0;
+    vs1053.reads++;
+    if (cmd[1] == SCI_WRAM) value = vs1053.memory[vs1053.address++];
+    cmd[2] = (INT8U)(value >> 8);
+    cmd[3] = (INT8U)value;
+    return PJDF_ERR_NONE;
+}
+
+PjdfErrCode Ioctl(HANDLE handle, INT8U request, void* pArgs, INT32U* pSize)
+{
+    if (handle != MP3_HANDLE) return PJDF_ERR_INVALID_HANDLE;
+    if (request == PJDF_CTRL_MP3_SELECT_COMMAND) vs1053.command = true;
+    else if (request == PJDF_CTRL_MP3_SELECT_DATA) vs1053.command = false;
+    else return PJDF_ERR_UNKNOWN_CTRL_REQUEST;
+    return PJDF_ERR_NONE;
+}
+
+static int failures = 0;
+
+static void Result(const char *name, bool ok, const char *format = "", ...)
+{
+    printf("%-8s ", name);
+    if (ok)
+    {
+        printf("ok\n");
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+    failures++;
+}
+
+// Sets the analyzer's count bands, the level and peak of each from the
+// functions, and reads them
+static INT32U ReadBands(INT16U count, INT8U (*level)(int), INT8U (*peak)(int), SpectrumLevels *levels)
+{
+    vs1053.memory[SA_BANDS_ADDR] = count;
+    for (int i = 0; i < count; i++)
+    {
+        vs1053.memory[SA_VALUES_ADDR + i] = (INT16U)((peak(i) << 6) | level(i));
+    }
+    vs1053.command = false;
+    SpectrumRead(MP3_HANDLE);
+    return SpectrumGet(levels);
+}
+
+static INT8U RampLevel(int i) { return (INT8U)(i * 4); }
+static INT8U RampPeak(int i) { return (INT8U)(i * 4 + 3); }
+static INT8U Loud(int i) { return 40; }
+static INT8U Mixed(int i) { return (i & 1) ? 40 : 30; }
+static INT8U Silent(int i) { return 0; }
+
+static void CheckLoad(void)
+{
+    vs1053.command = true;
+    SpectrumLoad(MP3_HANDLE);
+    ticks += SPECTRUM_PERIOD_TICKS;
+
+    bool due = SpectrumIsDue();
+    bool stub = vs1053.writes == 0;
+    printf("#plugin  %s, %lu SCI writes, %lu words of memory\n", stub ? "empty stand-in" : "loaded",
+        vs1053.writes, vs1053.wramWrites);
+    Result("load", due != stub && vs1053.badOps == 0, "reads %s due, %lu bad SCI ops",
+        due ? "fall" : "never fall", vs1053.badOps);
+}
+
+static void CheckRead(void)
+{
+    SpectrumLevels levels;
+    SpectrumStats before, after;
+    INT32U first = SpectrumGet(&levels);
+
+    SpectrumGetStats(&before);
+    INT32U seq = ReadBands(14, RampLevel, RampPeak, &levels);
+    SpectrumGetStats(&after);
+
+    bool values = levels.count == 14;
+    for (int i = 0; i < 14 && values; i++)
+    {
+        values = levels.level[i] == RampLevel(i) && levels.peak[i] == RampPeak(i);
+    }
+    INT32U ops = after.sciOps - before.sciOps;
+    Result("read", seq == first + 1 && values && ops == 3 + 14 && !vs1053.command && vs1053.badOps == 0,
+        "sequence %u after %u, %u bands %s, %u SCI ops, %s mode", seq, first, levels.count,
+        values ? "right" : "wrong", ops, vs1053.command ? "command" : "data");
+
+    SpectrumLevels again;
+    INT32U same = SpectrumGet(&again);
+    Result("repeat", same == seq && memcmp(&again, &levels, sizeof(levels)) == 0,
+        "sequence %u after %u", same, seq);
+}
+
+static void CheckBands(void)
+{
+    SpectrumLevels levels;
+    SpectrumStats before, after;
+
+    SpectrumGetStats(&before);
+    ReadBands(40, RampLevel, RampPeak, &levels);
+    SpectrumGetStats(&after);
+    INT32U ops = after.sciOps - before.sciOps;
+    Result("bands", levels.count == SPECTRUM_MAX_BANDS && ops == 3 + SPECTRUM_MAX_BANDS,
+        "%u bands, %u SCI ops", levels.count, ops);
+}
+
+static void CheckVu(void)
+{
+    SpectrumLevels levels;
+    char got[256] = "";
+    bool ok = true;
+
+    // From silence, up at once to the RMS of the levels
+    for (int i = 0; i < 64; i++) ReadBands(14, Silent, Loud, &levels);
+    ReadBands(14, Mixed, Loud, &levels);
+    ok = ok && levels.vu == 35;     // sqrt((30 * 30 + 40 * 40) / 2)
+    snprintf(got + strlen(got), sizeof(got) - strlen(got), "%u", levels.vu);
+    ReadBands(14, Loud, Loud, &levels);
+    ok = ok && levels.vu == 40;
+    snprintf(got + strlen(got), sizeof(got) - strlen(got), " %u", levels.vu);
+
+    // Then back down a step at a time
+    for (int expected = 40 - SPECTRUM_VU_FALL; ; expected -= SPECTRUM_VU_FALL)
+    {
+        if (expected < 0) expected = 0;
+        ReadBands(14, Silent, Loud, &levels);
+        ok = ok && levels.vu == expected;
+        snprintf(got + strlen(got), sizeof(got) - strlen(got), " %u", levels.vu);
+        if (expected == 0) break;
+    }
+    Result("vu", ok, "levels %s", got);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 1)
+    {
+        fprintf(stderr, "usage: spectrumTest\n");
+        return 2;
+    }
+
+    CheckLoad();
+    CheckRead();
+    CheckBands();
+    CheckVu();
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,278 @@
+/*
+    spriteGen.cpp
+    Host tool: packs PNG images into one atlas of run length encoded RGB565
+    sprites for Adafruit_GFX::drawSprite() (see runsprite.h).
+
+    Build:  g++ -O2 -I../Adafruit/Adafruit-GFX -o spriteGen spriteGen.cpp $(pkg-config --cflags --libs libpng)
+    Usage:  spriteGen [-b color] <name> <image.png>...
+            Writes <name>.c and <name>.h to the current directory, with one
+            RunSprite per image named after the atlas and the file:
+            play_pressed.png in atlas playerIcons is playerIconsPlayPressed.
+            -b  RGB565 color, in hex, that transparent parts of the images
+                are blended over; the screen background, 0x0000 by default
+
+    Encoding:
+        Channels are rounded to 5, 6 and 5 bits. Two or more pixels of one
+        color in a row are a run of that color and any pixels between such
+        runs are literal runs, both up to RUNSPRITE_RUN_MAX long. A run of
+        two costs 3 bytes against 4 as literals, and splitting a literal run
+        around it costs no more than the header byte it saves, so runs are
+        taken wherever they occur. Each sprite is decoded again and checked
+        against its image before it is written.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <png.h>
+
+#include "runsprite.h"
+
+struct Sprite
+{
+    std::string name;
+    int width;
+    int height;
+    unsigned offset;
+    std::vector<uint16_t> pixels;  // width * height, RGB565
+};
+
+static uint8_t Round(int c, int bits)
+{
+    c += 1 << (7 - bits);
+    return (c > 255 ? 255 : c) >> (8 - bits);
+}
+
+// Reads a PNG of any format as RGB565, blended over bg where it is not opaque
+static bool ReadImage(const char *path, uint16_t bg, Sprite &s)
+{
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&image, path)) return false;
+
+    image.format = PNG_FORMAT_RGBA;
+    std::vector<uint8_t> rgba(PNG_IMAGE_SIZE(image));
+    if (!png_image_finish_read(&image, NULL, &rgba[0], 0, NULL)) return false;
+
+    int bgR = ((bg >> 11) << 3) | (bg >> 13);
+    int bgG = (((bg >> 5) & 0x3F) << 2) | ((bg >> 9) & 0x3);
+    int bgB = ((bg & 0x1F) << 3) | ((bg >> 2) & 0x7);
+
+    s.width = image.width;
+    s.height = image.height;
+    s.pixels.resize((size_t)s.width * s.height);
+    for (size_t i = 0; i < s.pixels.size(); i++)
+    {
+        const uint8_t *p = &rgba[i * 4];
+        int a = p[3];
+        int r = (p[0] * a + bgR * (255 - a) + 127) / 255;
+        int g = (p[1] * a + bgG * (255 - a) + 127) / 255;
+        int b = (p[2] * a + bgB * (255 - a) + 127) / 255;
+        s.pixels[i] = (Round(r, 5) << 11) | (Round(g, 6) << 5) | Round(b, 5);
+    }
+    return true;
+}
+
+static void PutColor(uint16_t c, std::vector<uint8_t> &out)
+{
+    out.push_back(c >> 8);
+    out.push_back(c & 0xFF);
+}
+
+// Appends the runs for a sprite's pixels to out
+static void EncodeSprite(const std::vector<uint16_t> &pixels, std::vector<uint8_t> &out)
+{
+    size_t count = pixels.size();
+    size_t x = 0;
+    while (x < count)
+    {
+        size_t same = 1;
+        while (x + same < count && same < RUNSPRITE_RUN_MAX && pixels[x + same] == pixels[x]) same++;
+        if (same >= 2)
+        {
+            out.push_back((uint8_t)(same - 1));
+            PutColor(pixels[x], out);
+            x += same;
+            continue;
+        }
+
+        // Literal pixels up to the next two of a kind
+        size_t n = 1;
+        while (x + n < count && n < RUNSPRITE_RUN_MAX &&
+            !(x + n + 1 < count && pixels[x + n] == pixels[x + n + 1])) n++;
+        out.push_back((uint8_t)(RUNSPRITE_LITERAL | (n - 1)));
+        for (size_t i = 0; i < n; i++) PutColor(pixels[x + i], out);
+        x += n;
+    }
+}
+
+// Decodes a sprite the way the renderer does and checks it against the image
+static bool CheckSprite(const Sprite &s, const std::vector<uint8_t> &runs)
+{
+    const uint8_t *p = &runs[s.offset];
+    const uint8_t *end = &runs[0] + runs.size();
+    size_t count = s.pixels.size();
+    size_t x = 0;
+    while (x < count)
+    {
+        if (p >= end) return false;
+        int n = (*p & ~RUNSPRITE_LITERAL) + 1;
+        bool literal = (*p++ & RUNSPRITE_LITERAL) != 0;
+        for (int i = 0; i < n; i++, x++)
+        {
+            if (x >= count || p + 1 >= end) return false;
+            if (s.pixels[x] != ((p[0] << 8) | p[1])) return false;
+            if (literal) p += 2;
+        }
+        if (!literal) p += 2;
+    }
+    return true;
+}
+
+// play_pressed.png -> PlayPressed
+static std::string SpriteName(const char *path)
+{
+    const char *base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    std::string name;
+    bool upper = true;
+    for (const char *c = base; *c != 0 && *c != '.'; c++)
+    {
+        if (!isalnum((unsigned char)*c))
+        {
+            upper = true;
+            continue;
+        }
+        name += upper ? (char)toupper((unsigned char)*c) : *c;
+        upper = false;
+    }
+    return name;
+}
+
+static bool WriteHeader(const std::string &name, const std::vector<Sprite> &sprites)
+{
+    FILE *out = fopen((name + ".h").c_str(), "w");
+    if (out == NULL) return false;
+
+    std::string guard;
+    for (size_t i = 0; i < name.size(); i++) guard += (char)toupper((unsigned char)name[i]);
+
+    fprintf(out, "/*\n    %s.h\n    Run length RGB565 sprite atlas generated by Tools/spriteGen.cpp.\n\n", name.c_str());
+    fprintf(out, "    Developed for University of Washington embedded systems programming certificate\n*/\n\n");
+    fprintf(out, "#ifndef __%s_H__\n#define __%s_H__\n\n", guard.c_str(), guard.c_str());
+    fprintf(out, "#include \"runsprite.h\"\n\n");
+    for (size_t i = 0; i < sprites.size(); i++)
+    {
+        fprintf(out, "extern const RunSprite %s%s;\n", name.c_str(), sprites[i].name.c_str());
+    }
+    fprintf(out, "\n#endif\n");
+    return fclose(out) == 0;
+}
+
+static bool WriteSource(const std::string &name, uint16_t bg, const std::vector<Sprite> &sprites,
+    const std::vector<uint8_t> &runs)
+{
+    FILE *out = fopen((name + ".c").c_str(), "w");
+    if (out == NULL) return false;
+
+    fprintf(out, "/*\n    %s.c\n    %u sprites over background 0x%04x.\n",
+        name.c_str(), (unsigned)sprites.size(), bg);
+    fprintf(out, "    Generated by Tools/spriteGen.cpp, do not edit.\n\n");
+    fprintf(out, "    Developed for University of Washington embedded systems programming certificate\n*/\n\n");
+    fprintf(out, "#include \"%s.h\"\n\n", name.c_str());
+
+    fprintf(out, "static const uint8_t %sRuns[%u] = {", name.c_str(), (unsigned)runs.size());
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        fprintf(out, "%s0x%02x%s", (i % 16) == 0 ? "\n    " : "", runs[i], i + 1 < runs.size() ? ", " : "");
+    }
+    fprintf(out, "\n};\n\n");
+
+    for (size_t i = 0; i < sprites.size(); i++)
+    {
+        const Sprite &s = sprites[i];
+        fprintf(out, "const RunSprite %s%s = { %sRuns + %u, %d, %d };\n",
+            name.c_str(), s.name.c_str(), name.c_str(), s.offset, s.width, s.height);
+    }
+    return fclose(out) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    uint16_t bg = 0x0000;
+    int arg = 1;
+
+    if (arg + 1 < argc && strcmp(argv[arg], "-b") == 0)
+    {
+        bg = (uint16_t)strtoul(argv[arg + 1], NULL, 16);
+        arg += 2;
+    }
+    if (argc - arg < 2)
+    {
+        fprintf(stderr, "usage: %s [-b color] <name> <image.png>...\n", argv[0]);
+        return 1;
+    }
+
+    std::string name = argv[arg++];
+    std::vector<Sprite> sprites;
+    std::vector<uint8_t> runs;
+    size_t raw = 0;
+
+    for (; arg < argc; arg++)
+    {
+        Sprite s;
+        if (!ReadImage(argv[arg], bg, s))
+        {
+            fprintf(stderr, "cannot read %s\n", argv[arg]);
+            return 1;
+        }
+        if (s.width > 0xFFFF || s.height > 0xFFFF)
+        {
+            fprintf(stderr, "%s too large for the RunSprite fields\n", argv[arg]);
+            return 1;
+        }
+        s.name = SpriteName(argv[arg]);
+        for (size_t i = 0; i < sprites.size(); i++)
+        {
+            if (sprites[i].name == s.name)
+            {
+                fprintf(stderr, "%s: a sprite is already named %s\n", argv[arg], s.name.c_str());
+                return 1;
+            }
+        }
+        s.offset = (unsigned)runs.size();
+        EncodeSprite(s.pixels, runs);
+        sprites.push_back(s);
+    }
+
+    for (size_t i = 0; i < sprites.size(); i++)
+    {
+        const Sprite &s = sprites[i];
+        size_t end = i + 1 < sprites.size() ? sprites[i + 1].offset : runs.size();
+        if (!CheckSprite(s, runs))
+        {
+            fprintf(stderr, "sprite %s did not decode back to its image\n", s.name.c_str());
+            return 1;
+        }
+        fprintf(stderr, "%s%-14s %3dx%-3d %6u bytes of runs (%u raw)\n", name.c_str(), s.name.c_str(),
+            s.width, s.height, (unsigned)(end - s.offset), (unsigned)(s.pixels.size() * 2));
+        raw += s.pixels.size() * 2;
+    }
+
+    if (!WriteHeader(name, sprites) || !WriteSource(name, bg, sprites, runs))
+    {
+        fprintf(stderr, "cannot write %s.c/.h\n", name.c_str());
+        return 1;
+    }
+    fprintf(stderr, "%u sprites: %u bytes of runs (RGB565: %u bytes)\n",
+        (unsigned)sprites.size(), (unsigned)runs.size(), (unsigned)raw);
+    return 0;
+}
@@ -0,0 +1,389 @@
+/*
+    traceDecode.cpp
+    Host tool: converts a trace dump captured from the UART (see Util/trace.c)
+    into Chrome trace_event JSON for chrome://tracing or ui.perfetto.dev.
+
+    Build:  g++ -O2 -o traceDecode traceDecode.cpp
+    Usage:  traceDecode <uart log> [output.json]
+            Anything outside the TRACE BEGIN/TRACE END lines is ignored. If the
+            log holds several dumps the last one is converted.
+
+    Tracks:
+        one thread per task with its running slices and instant post events,
+        an "ISR" thread for interrupt service routines, and async slices for
+        the time each task spends blocked on a semaphore, mailbox or queue.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+
+// Record types, must match OS_TRACE_TYPE_xxx in ucos_ii.h
+#define TYPE_TASK_SW    0x01
+#define TYPE_INT_ENTER  0x02
+#define TYPE_INT_EXIT   0x03
+#define TYPE_SEM_POST   0x10
+#define TYPE_SEM_PEND   0x11
+#define TYPE_MBOX_POST  0x12
+#define TYPE_MBOX_PEND  0x13
+#define TYPE_Q_POST     0x14
+#define TYPE_Q_PEND     0x15
+#define TYPE_USER       0x40
+#define TYPE_PEND_DONE  0x80
+
+#define ISR_TID         1000
+
+// Marker names, must match TRACE_USER_xxx in trace.h
+static const char *userNames[] =
+{
+    "touch press",
+    "mp3 command",
+    "mp3 first data",
+    "display begin",
+    "display end",
+    "gesture",
+};
+
+struct Record
+{
+    uint32_t timestamp;
+    unsigned type;
+    unsigned prio;
+    unsigned arg;
+};
+
+struct Dump
+{
+    double hz;
+    unsigned long lost;
+    std::map<unsigned, std::string> tasks;
+    std::map<unsigned, std::string> events;
+    std::vector<Record> records;
+};
+
+static void Trim(char *line)
+{
+    size_t len = strlen(line);
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r' || line[len - 1] == ' '))
+    {
+        line[--len] = 0;
+    }
+}
+
+// Returns the text following the Nth space separated field of line, or "" if none
+static const char *Rest(const char *line, int fields)
+{
+    const char *p = line;
+    while (fields-- > 0)
+    {
+        p = strchr(p, ' ');
+        if (p == NULL) return "";
+        p++;
+    }
+    return p;
+}
+
+static bool ParseDump(FILE *in, Dump &dump)
+{
+    char line[512];
+    bool inDump = false;
+    bool found = false;
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        Trim(line);
+        if (strcmp(line, "TRACE BEGIN") == 0)
+        {
+            dump = Dump();
+            dump.hz = 16000000.0;
+            inDump = true;
+            continue;
+        }
+        if (!inDump) continue;
+        if (strcmp(line, "TRACE END") == 0)
+        {
+            inDump = false;
+            found = true;
+            continue;
+        }
+
+        unsigned a, b, c, d;
+        switch (line[0])
+        {
+        case 'H':
+            dump.hz = atof(line + 2);
+            break;
+        case 'L':
+            dump.lost = strtoul(line + 2, NULL, 16);
+            break;
+        case 'T':
+            if (sscanf(line + 2, "%x", &a) == 1) dump.tasks[a] = Rest(line, 2);
+            break;
+        case 'E':
+            if (sscanf(line + 2, "%x %x", &a, &b) == 2) dump.events[a] = Rest(line, 3);
+            break;
+        case 'R':
+            if (sscanf(line + 2, "%x %x %x %x", &a, &b, &c, &d) == 4)
+            {
+                Record rec = { a, b, c, d };
+                dump.records.push_back(rec);
+            }
+            break;
+        default:
+            break; // log noise interleaved with the dump
+        }
+    }
+    return found;
+}
+
+static std::string TaskName(const Dump &dump, unsigned prio)
+{
+    std::map<unsigned, std::string>::const_iterator it = dump.tasks.find(prio);
+    char buf[32];
+    if (it != dump.tasks.end() && !it->second.empty() && it->second != "?") return it->second;
+    snprintf(buf, sizeof(buf), "prio %u", prio);
+    return buf;
+}
+
+static std::string EventName(const Dump &dump, unsigned index)
+{
+    std::map<unsigned, std::string>::const_iterator it = dump.events.find(index);
+    char buf[32];
+    if (it != dump.events.end() && !it->second.empty() && it->second != "?") return it->second;
+    snprintf(buf, sizeof(buf), "event %u", index);
+    return buf;
+}
+
+static std::string IsrName(unsigned exception)
+{
+    char buf[32];
+    if (exception == 14) return "PendSV";
+    if (exception == 15) return "SysTick";
+    if (exception >= 16) snprintf(buf, sizeof(buf), "IRQ %u", exception - 16);
+    else snprintf(buf, sizeof(buf), "exception %u", exception);
+    return buf;
+}
+
+// Escapes a string for use inside JSON quotes
+static std::string Json(const std::string &s)
+{
+    std::string out;
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        char c = s[i];
+        if (c == '"' || c == '\\') out += '\\';
+        if ((unsigned char)c < 0x20) continue;
+        out += c;
+    }
+    return out;
+}
+
+class TraceWriter
+{
+public:
+    TraceWriter(FILE *out) : out(out), first(true)
+    {
+        fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    }
+
+    ~TraceWriter()
+    {
+        fprintf(out, "\n]}\n");
+    }
+
+    void Meta(unsigned tid, const std::string &name, unsigned sortIndex)
+    {
+        Begin();
+        fprintf(out, "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":\"%s\"}}",
+            tid, Json(name).c_str());
+        Begin();
+        fprintf(out, "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":%u}}",
+            tid, sortIndex);
+    }
+
+    void Slice(unsigned tid, const std::string &name, const char *cat, double ts, double dur)
+    {
+        Begin();
+        fprintf(out, "{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"name\":\"%s\",\"cat\":\"%s\",\"ts\":%.3f,\"dur\":%.3f}",
+            tid, Json(name).c_str(), cat, ts, dur);
+    }
+
+    void Instant(unsigned tid, const std::string &name, const char *cat, double ts, unsigned arg)
+    {
+        Begin();
+        fprintf(out, "{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"name\":\"%s\",\"cat\":\"%s\",\"ts\":%.3f,\"args\":{\"arg\":%u}}",
+            tid, Json(name).c_str(), cat, ts, arg);
+    }
+
+    void Async(char ph, unsigned tid, unsigned id, const std::string &name, double ts)
+    {
+        Begin();
+        fprintf(out, "{\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"id\":%u,\"name\":\"%s\",\"cat\":\"wait\",\"ts\":%.3f}",
+            ph, tid, id, Json(name).c_str(), ts);
+    }
+
+private:
+    void Begin()
+    {
+        if (!first) fprintf(out, ",\n");
+        first = false;
+    }
+
+    FILE *out;
+    bool first;
+};
+
+struct IsrFrame
+{
+    unsigned exception;
+    double start;
+};
+
+static void Convert(const Dump &dump, FILE *out)
+{
+    TraceWriter writer(out);
+    std::map<unsigned, bool> seenTasks;
+    std::vector<IsrFrame> isrStack;
+    std::map<unsigned, std::string> waiting; // prio -> name of the object it is blocked on
+    double usPerCycle = 1000000.0 / dump.hz;
+    uint64_t cycles = 0;
+    uint32_t lastTimestamp = 0;
+    bool running = false;
+    unsigned runPrio = 0;
+    double runStart = 0;
+
+    writer.Meta(ISR_TID, "ISR", 0);
+
+    for (size_t i = 0; i < dump.records.size(); i++)
+    {
+        const Record &rec = dump.records[i];
+
+        // Unwrap the 32 bit cycle counter
+        if (i > 0) cycles += (uint32_t)(rec.timestamp - lastTimestamp);
+        lastTimestamp = rec.timestamp;
+        double ts = cycles * usPerCycle;
+
+        unsigned tid = isrStack.empty() ? rec.prio : ISR_TID;
+        if (!seenTasks[rec.prio])
+        {
+            seenTasks[rec.prio] = true;
+            writer.Meta(rec.prio, TaskName(dump, rec.prio), rec.prio + 1);
+        }
+        if (!running)
+        {
+            running = true;
+            runPrio = rec.prio;
+            runStart = ts;
+        }
+
+        unsigned type = rec.type & ~TYPE_PEND_DONE;
+        bool pendDone = (rec.type & TYPE_PEND_DONE) != 0 && type < TYPE_USER;
+
+        if (rec.type == TYPE_TASK_SW)
+        {
+            writer.Slice(runPrio, TaskName(dump, runPrio), "run", runStart, ts - runStart);
+            runPrio = rec.arg;
+            runStart = ts;
+            if (!seenTasks[runPrio])
+            {
+                seenTasks[runPrio] = true;
+                writer.Meta(runPrio, TaskName(dump, runPrio), runPrio + 1);
+            }
+        }
+        else if (rec.type == TYPE_INT_ENTER)
+        {
+            IsrFrame frame = { rec.arg, ts };
+            isrStack.push_back(frame);
+        }
+        else if (rec.type == TYPE_INT_EXIT)
+        {
+            if (!isrStack.empty())
+            {
+                IsrFrame frame = isrStack.back();
+                isrStack.pop_back();
+                writer.Slice(ISR_TID, IsrName(frame.exception), "isr", frame.start, ts - frame.start);
+            }
+        }
+        else if (type >= TYPE_USER)
+        {
+            unsigned id = rec.type - TYPE_USER;
+            std::string name = id < sizeof(userNames) / sizeof(userNames[0]) ? userNames[id] : "user";
+            writer.Instant(tid, name, "user", ts, rec.arg);
+        }
+        else if (type == TYPE_SEM_POST || type == TYPE_MBOX_POST || type == TYPE_Q_POST)
+        {
+            writer.Instant(tid, "post " + EventName(dump, rec.arg), "post", ts, rec.arg);
+        }
+        else if (type == TYPE_SEM_PEND || type == TYPE_MBOX_PEND || type == TYPE_Q_PEND)
+        {
+            std::string name = "wait " + EventName(dump, rec.arg);
+            if (pendDone)
+            {
+                // Only close waits whose start is in the buffer
+                std::map<unsigned, std::string>::iterator it = waiting.find(rec.prio);
+                if (it != waiting.end())
+                {
+                    writer.Async('e', rec.prio, rec.prio, it->second, ts);
+                    waiting.erase(it);
+                }
+            }
+            else
+            {
+                waiting[rec.prio] = name;
+                writer.Async('b', rec.prio, rec.prio, name, ts);
+            }
+        }
+    }
+
+    if (running)
+    {
+        double end = cycles * usPerCycle;
+        writer.Slice(runPrio, TaskName(dump, runPrio), "run", runStart, end - runStart);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <uart log> [output.json]\n", argv[0]);
+        return 2;
+    }
+
+    FILE *in = fopen(argv[1], "r");
+    if (in == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    Dump dump;
+    bool found = ParseDump(in, dump);
+    fclose(in);
+    if (!found)
+    {
+        fprintf(stderr, "no complete TRACE BEGIN/TRACE END block in %s\n", argv[1]);
+        return 1;
+    }
+
+    FILE *out = argc > 2 ? fopen(argv[2], "w") : stdout;
+    if (out == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", argv[2]);
+        return 1;
+    }
+
+    Convert(dump, out);
+    if (out != stdout) fclose(out);
+
+    fprintf(stderr, "%u records, %lu lost, %.3f ms\n", (unsigned)dump.records.size(), dump.lost,
+        dump.records.empty() ? 0.0 :
+        (uint32_t)(dump.records.back().timestamp - dump.records.front().timestamp) * 1000.0 / dump.hz);
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+    gesture.c
+    Recognizes taps, long presses, swipes and drags in touch samples, see
+    gesture.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "gesture.h"
+
+// What the touch in progress has been recognized as so far
+#define GESTURE_STATE_IDLE      0   // no touch
+#define GESTURE_STATE_PRESS     1   // down, not yet a drag or a long press
+#define GESTURE_STATE_LONG      2   // long press reported
+#define GESTURE_STATE_DRAG      3   // left the slop, drag events reported
+
+#define FIX(v)      ((INT32S)(v) << GESTURE_FRAC_BITS)
+#define UNFIX(f)    ((int16_t)(((f) + (1 << (GESTURE_FRAC_BITS - 1))) >> GESTURE_FRAC_BITS))
+
+static const char * const gestureNames[NUM_GESTURES] =
+{
+    "NONE", "DOWN", "LONG_PRESS", "DRAG_START", "DRAG",
+    "TAP", "SWIPE_LEFT", "SWIPE_RIGHT", "DRAG_END", "UP"
+};
+
+static int16_t Abs16(int16_t v)
+{
+    return v < 0 ? -v : v;
+}
+
+// Fills in event at the filtered position, dx and dy from (fromX, fromY)
+static BOOLEAN Emit(Gesture *g, GestureEvent *event, GestureType type, int16_t fromX, int16_t fromY)
+{
+    event->type = type;
+    event->x = UNFIX(g->fx);
+    event->y = UNFIX(g->fy);
+    event->startX = g->startX;
+    event->startY = g->startY;
+    event->dx = event->x - fromX;
+    event->dy = event->y - fromY;
+    return OS_TRUE;
+}
+
+// Classifies a touch that has been released
+static BOOLEAN End(Gesture *g, GestureEvent *event)
+{
+    INT8U state = g->state;
+    INT32U duration = g->lastTime - g->downTime;
+    int16_t dx = UNFIX(g->fx) - g->startX;
+    int16_t dy = UNFIX(g->fy) - g->startY;
+    GestureType type = GESTURE_UP;
+
+    g->state = GESTURE_STATE_IDLE;
+    if (state == GESTURE_STATE_DRAG)
+    {
+        type = GESTURE_DRAG_END;
+        if (duration <= GESTURE_TICKS(GESTURE_SWIPE_MAX_MS) &&
+            Abs16(dx) >= GESTURE_SWIPE_MIN_DX && Abs16(dx) >= 2 * Abs16(dy))
+        {
+            type = dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+        }
+    }
+    else if (state == GESTURE_STATE_PRESS && duration >= GESTURE_TICKS(GESTURE_TAP_MIN_MS))
+    {
+        type = GESTURE_TAP;
+    }
+    return Emit(g, event, type, g->startX, g->startY);
+}
+
+void GestureInit(Gesture *g)
+{
+    memset(g, 0, sizeof(*g));
+    g->state = GESTURE_STATE_IDLE;
+}
+
+// GestureUpdate
+// Feeds one touch sample to the engine.
+// time: tick the sample was read
+// touched: OS_TRUE if the panel reported a touch, x and y are its position
+// event: receives the event the sample completed, if any
+// Returns: OS_TRUE if event was filled in
+BOOLEAN GestureUpdate(Gesture *g, INT32U time, BOOLEAN touched, int16_t x, int16_t y,
+    GestureEvent *event)
+{
+    if (g->state == GESTURE_STATE_IDLE)
+    {
+        if (!touched) return OS_FALSE;
+        g->state = GESTURE_STATE_PRESS;
+        g->downTime = g->lastTime = time;
+        g->startX = g->lastX = x;
+        g->startY = g->lastY = y;
+        g->fx = FIX(x);
+        g->fy = FIX(y);
+        return Emit(g, event, GESTURE_DOWN, x, y);
+    }
+
+    if (!touched)
+    {
+        if (time - g->lastTime < GESTURE_TICKS(GESTURE_RELEASE_MS)) return OS_FALSE;
+        return End(g, event);
+    }
+
+    g->lastTime = time;
+    g->fx += (FIX(x) - g->fx) >> GESTURE_FILTER_SHIFT;
+    g->fy += (FIX(y) - g->fy) >> GESTURE_FILTER_SHIFT;
+    int16_t fx = UNFIX(g->fx);
+    int16_t fy = UNFIX(g->fy);
+
+    switch (g->state)
+    {
+    case GESTURE_STATE_PRESS:
+        if (Abs16(fx - g->startX) > GESTURE_SLOP || Abs16(fy - g->startY) > GESTURE_SLOP)
+        {
+            g->state = GESTURE_STATE_DRAG;
+            g->lastX = fx;
+            g->lastY = fy;
+            return Emit(g, event, GESTURE_DRAG_START, g->startX, g->startY);
+        }
+        if (time - g->downTime >= GESTURE_TICKS(GESTURE_LONG_PRESS_MS))
+        {
+            g->state = GESTURE_STATE_LONG;
+            return Emit(g, event, GESTURE_LONG_PRESS, g->startX, g->startY);
+        }
+        break;
+    case GESTURE_STATE_DRAG:
+        if (fx != g->lastX || fy != g->lastY)
+        {
+            Emit(g, event, GESTURE_DRAG, g->lastX, g->lastY);
+            g->lastX = fx;
+            g->lastY = fy;
+            return OS_TRUE;
+        }
+        break;
+    default:
+        break;
+    }
+    return OS_FALSE;
+}
+
+// True while a touch is in progress, including the GESTURE_RELEASE_MS
+// after the last touched sample
+BOOLEAN GestureIsActive(const Gesture *g)
+{
+    return g->state != GESTURE_STATE_IDLE;
+}
+
+// True for the events that end a touch
+BOOLEAN GestureIsEnd(GestureType type)
+{
+    return type >= GESTURE_TAP && type <= GESTURE_UP;
+}
+
+const char *GestureName(GestureType type)
+{
+    return type < NUM_GESTURES ? gestureNames[type] : "?";
+}
@@ -0,0 +1,89 @@
+/*
+    gesture.h
+    Recognizes taps, long presses, swipes and drags in touch samples.
+
+    The engine is fed every sample TouchTask reads, touched or not, with
+    its tick, and returns at most one event per sample. Each touch gives:
+      GESTURE_DOWN          at its first sample, for press feedback
+      GESTURE_LONG_PRESS    held GESTURE_LONG_PRESS_MS within GESTURE_SLOP
+      GESTURE_DRAG_START    on leaving GESTURE_SLOP of where it went down,
+      GESTURE_DRAG          then each time the position moves
+    and ends with exactly one of:
+      GESTURE_TAP           released within GESTURE_SLOP before a long press
+      GESTURE_SWIPE_LEFT,   a drag released within GESTURE_SWIPE_MAX_MS
+      GESTURE_SWIPE_RIGHT   that moved mostly sideways by GESTURE_SWIPE_MIN_DX
+      GESTURE_DRAG_END      any other drag
+      GESTURE_UP            anything else: after a long press, or a touch
+                            shorter than GESTURE_TAP_MIN_MS, taken as noise
+
+    The position is smoothed by a fixed point exponential filter, so a drag
+    does not jitter and slop is measured from the smoothed position. A touch
+    only ends once no touch has been reported for GESTURE_RELEASE_MS, so
+    the controller dropping a sample or two does not split a drag in two;
+    keep feeding samples while GestureIsActive().
+
+    The engine has no OS dependencies. Tools/gestureReplay.cpp runs it on a
+    PC over touch traces logged by TouchTask (APP_CFG_TOUCH_LOG_EN).
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __GESTURE_H__
+#define __GESTURE_H__
+
+#include "bsp.h"
+
+#define GESTURE_RELEASE_MS      30      // untouched this long ends a touch
+#define GESTURE_TAP_MIN_MS      20      // shorter touches are noise
+#define GESTURE_LONG_PRESS_MS   600
+#define GESTURE_SWIPE_MAX_MS    400
+#define GESTURE_SWIPE_MIN_DX    60      // pixels
+#define GESTURE_SLOP            10      // pixels a press may wander and stay a press
+
+#define GESTURE_FRAC_BITS       4       // fraction bits of the filtered position
+#define GESTURE_FILTER_SHIFT    1       // each sample moves the position 1/2^shift of the way
+
+#define GESTURE_TICKS(ms)       ((INT32U)(ms) * OS_TICKS_PER_SEC / 1000)
+
+typedef enum
+{
+    GESTURE_NONE,
+    GESTURE_DOWN,
+    GESTURE_LONG_PRESS,
+    GESTURE_DRAG_START,
+    GESTURE_DRAG,
+    GESTURE_TAP,
+    GESTURE_SWIPE_LEFT,
+    GESTURE_SWIPE_RIGHT,
+    GESTURE_DRAG_END,
+    GESTURE_UP,
+    NUM_GESTURES
+} GestureType;
+
+typedef struct
+{
+    GestureType type;
+    int16_t x, y;               // filtered position now
+    int16_t startX, startY;     // where the touch went down
+    int16_t dx, dy;             // moved since the last drag event, or since
+                                // the touch went down for the other events
+} GestureEvent;
+
+typedef struct
+{
+    INT8U state;
+    INT32U downTime;            // tick of the first sample of the touch
+    INT32U lastTime;            // tick of the last touched sample
+    int16_t startX, startY;
+    int16_t lastX, lastY;       // position of the last drag event
+    INT32S fx, fy;              // filtered position, GESTURE_FRAC_BITS fraction bits
+} Gesture;
+
+void GestureInit(Gesture *g);
+BOOLEAN GestureUpdate(Gesture *g, INT32U time, BOOLEAN touched, int16_t x, int16_t y,
+    GestureEvent *event);
+BOOLEAN GestureIsActive(const Gesture *g);
+BOOLEAN GestureIsEnd(GestureType type);
+const char *GestureName(GestureType type);
+
+#endif /* __GESTURE_H__ */
@@ -0,0 +1,669 @@
+/*
+    jpegDecode.c
+    Streaming baseline JPEG decoder for small screens, see jpegDecode.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "pixelKernels.h"
+#include "jpegDecode.h"
+
+// Markers
+#define M_SOF0      0xC0
+#define M_SOF1      0xC1
+#define M_DHT       0xC4
+#define M_JPG       0xC8
+#define M_DAC       0xCC
+#define M_RST0      0xD0
+#define M_RST7      0xD7
+#define M_SOI       0xD8
+#define M_EOI       0xD9
+#define M_SOS       0xDA
+#define M_DQT       0xDB
+#define M_DRI       0xDD
+#define M_TEM       0x01
+
+// Natural order index of each zigzag position
+static const INT8U zigzag[64] =
+{
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+// Inverse DCT to n x n pixels from the low n x n coefficients:
+// f(x) = 1/8 sum(c(u) F(u) cos((2x + 1) u pi / 2n)), c(0) = 1, c(u) = sqrt(2).
+// Entry [x][u] of each table is c(u) cos((2x + 1) u pi / 2n) * 4096.
+static const INT16S idct8[8 * 8] =
+{
+    4096,  5681,  5352,  4816,  4096,  3218,  2217,  1130,
+    4096,  4816,  2217, -1130, -4096, -5681, -5352, -3218,
+    4096,  3218, -2217, -5681, -4096,  1130,  5352,  4816,
+    4096,  1130, -5352, -3218,  4096,  4816, -2217, -5681,
+    4096, -1130, -5352,  3218,  4096, -4816, -2217,  5681,
+    4096, -3218, -2217,  5681, -4096, -1130,  5352, -4816,
+    4096, -4816,  2217,  1130, -4096,  5681, -5352,  3218,
+    4096, -5681,  5352, -4816,  4096, -3218,  2217, -1130
+};
+
+static const INT16S idct4[4 * 4] =
+{
+    4096,  5352,  4096,  2217,
+    4096,  2217, -4096, -5352,
+    4096, -2217, -4096,  5352,
+    4096, -5352,  4096, -2217
+};
+
+static const INT16S idct2[2 * 2] =
+{
+    4096,  4096,
+    4096, -4096
+};
+
+static INT8U Clamp(INT32S v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : (INT8U)v);
+}
+
+
+/************************************************************************************
+
+   Input
+
+************************************************************************************/
+
+// Next byte of the input, or -1 at its end
+static INT16S ReadByte(JpegDecoder *d)
+{
+    if (d->inPos >= d->inLen)
+    {
+        d->inLen = (INT8U)d->read(d->readCtx, d->in, JPEG_IN_BUF_SIZE);
+        d->inPos = 0;
+        if (d->inLen == 0) return -1;
+    }
+    return d->in[d->inPos++];
+}
+
+static INT32S ReadWord(JpegDecoder *d)
+{
+    INT16S hi = ReadByte(d);
+    INT16S lo = ReadByte(d);
+    if (hi < 0 || lo < 0) return -1;
+    return (hi << 8) | lo;
+}
+
+static JpegErr Skip(JpegDecoder *d, INT32U n)
+{
+    while (n--)
+    {
+        if (ReadByte(d) < 0) return JPEG_ERR_READ;
+    }
+    return JPEG_ERR_NONE;
+}
+
+// Next marker code, skipping anything before it. -1 at the end of the input.
+static INT16S NextMarker(JpegDecoder *d)
+{
+    INT16S b;
+    do {
+        do {
+            b = ReadByte(d);
+        } while (b >= 0 && b != 0xFF);
+        do {
+            b = ReadByte(d);
+        } while (b == 0xFF);
+    } while (b == 0);
+    return b;
+}
+
+// Top up the bit buffer to at least 25 bits. After a marker, or at the
+// end of the input, zeros are fed in as libjpeg does for damaged files.
+static void FillBits(JpegDecoder *d)
+{
+    while (d->bitCount <= 24)
+    {
+        INT16S b = 0;
+        if (d->marker == 0)
+        {
+            b = ReadByte(d);
+            if (b == 0xFF)
+            {
+                INT16S next;
+                do {
+                    next = ReadByte(d);
+                } while (next == 0xFF);
+                if (next != 0)
+                {
+                    d->marker = next < 0 ? M_EOI : (INT8U)next;
+                    b = 0;
+                }
+            }
+            else if (b < 0)
+            {
+                d->marker = M_EOI;
+                b = 0;
+            }
+        }
+        d->bitBuf |= (INT32U)b << (24 - d->bitCount);
+        d->bitCount += 8;
+    }
+}
+
+static INT32S GetBits(JpegDecoder *d, INT8U n)
+{
+    INT32S v;
+    if (n == 0) return 0;
+    if (d->bitCount < n) FillBits(d);
+    v = d->bitBuf >> (32 - n);
+    d->bitBuf <<= n;
+    d->bitCount -= n;
+    return v;
+}
+
+// The n bit value v as a signed coefficient (F.2.2.1 EXTEND)
+static INT32S Extend(INT32S v, INT8U n)
+{
+    return (n > 0 && v < (1 << (n - 1))) ? v - (1 << n) + 1 : v;
+}
+
+// Next Huffman coded symbol, or -1 for a code not in the table
+static INT16S DecodeHuff(JpegDecoder *d, const JpegHuffTable *t)
+{
+    INT32S look;
+
+    if (d->bitCount < 16) FillBits(d);
+    look = d->bitBuf >> 16;
+    for (INT8U len = 1; len <= 16; len++)
+    {
+        INT32S code = look >> (16 - len);
+        if (code <= t->maxCode[len])
+        {
+            d->bitBuf <<= len;
+            d->bitCount -= len;
+            return t->vals[t->valPtr[len] + code - t->minCode[len]];
+        }
+    }
+    return -1;
+}
+
+
+/************************************************************************************
+
+   Headers
+
+************************************************************************************/
+
+static JpegErr ParseDqt(JpegDecoder *d)
+{
+    INT32S len = ReadWord(d) - 2;
+
+    while (len > 0)
+    {
+        INT16S pt = ReadByte(d);
+        if (pt < 0) return JPEG_ERR_READ;
+        if ((pt & 0x0F) > 3) return JPEG_ERR_FORMAT;
+
+        INT16U *q = d->quant[pt & 0x0F];
+        for (INT8U k = 0; k < 64; k++)
+        {
+            INT32S v = (pt >> 4) ? ReadWord(d) : ReadByte(d);
+            if (v < 0) return JPEG_ERR_READ;
+            q[k] = (INT16U)v;
+        }
+        len -= 1 + ((pt >> 4) ? 128 : 64);
+    }
+    return len == 0 ? JPEG_ERR_NONE : JPEG_ERR_FORMAT;
+}
+
+static JpegErr ParseDht(JpegDecoder *d)
+{
+    INT32S len = ReadWord(d) - 2;
+
+    while (len > 0)
+    {
+        INT16S tc = ReadByte(d);
+        INT16U total = 0;
+        if (tc < 0) return JPEG_ERR_READ;
+        if ((tc & 0x0F) > 1) return JPEG_ERR_UNSUPPORTED;  // baseline has two of each
+        if ((tc >> 4) > 1) return JPEG_ERR_FORMAT;
+
+        JpegHuffTable *t = (tc >> 4) ? &d->ac[tc & 0x0F] : &d->dc[tc & 0x0F];
+        t->bits[0] = 0;
+        for (INT8U i = 1; i <= 16; i++)
+        {
+            INT16S n = ReadByte(d);
+            if (n < 0) return JPEG_ERR_READ;
+            t->bits[i] = (INT8U)n;
+            total += n;
+        }
+        if (total > sizeof(t->vals)) return JPEG_ERR_FORMAT;
+        for (INT16U i = 0; i < total; i++)
+        {
+            INT16S v = ReadByte(d);
+            if (v < 0) return JPEG_ERR_READ;
+            t->vals[i] = (INT8U)v;
+        }
+
+        // Canonical codes, F.2.2.3
+        INT32S code = 0;
+        INT16U k = 0;
+        for (INT8U i = 1; i <= 16; i++)
+        {
+            t->valPtr[i] = k;
+            t->minCode[i] = (INT16U)code;
+            code += t->bits[i];
+            k += t->bits[i];
+            t->maxCode[i] = t->bits[i] ? code - 1 : -1;
+            code <<= 1;
+        }
+        len -= 17 + total;
+    }
+    return len == 0 ? JPEG_ERR_NONE : JPEG_ERR_FORMAT;
+}
+
+static JpegErr ParseSof(JpegDecoder *d)
+{
+    INT32S len = ReadWord(d);
+    INT16S precision = ReadByte(d);
+    INT32S height = ReadWord(d);
+    INT32S width = ReadWord(d);
+    INT16S n = ReadByte(d);
+
+    if (n < 0) return JPEG_ERR_READ;
+    if (precision != 8 || height == 0) return JPEG_ERR_UNSUPPORTED;
+    if (width == 0 || (n != 1 && n != 3) || len != 8 + 3 * n) return JPEG_ERR_FORMAT;
+
+    d->width = (INT16U)width;
+    d->height = (INT16U)height;
+    d->nComponents = (INT8U)n;
+    for (INT8U i = 0; i < n; i++)
+    {
+        INT16S id = ReadByte(d);
+        INT16S hv = ReadByte(d);
+        INT16S tq = ReadByte(d);
+        if (tq < 0) return JPEG_ERR_READ;
+        if (tq > 3) return JPEG_ERR_FORMAT;
+        d->comp[i].id = (INT8U)id;
+        d->comp[i].h = hv >> 4;
+        d->comp[i].v = hv & 0x0F;
+        d->comp[i].quant = (INT8U)tq;
+    }
+
+    // A lone component is coded one block at a time whatever its factors
+    if (n == 1) d->comp[0].h = d->comp[0].v = 1;
+    for (INT8U i = 1; i < n; i++)
+    {
+        if (d->comp[i].h != 1 || d->comp[i].v != 1) return JPEG_ERR_UNSUPPORTED;
+    }
+    if (d->comp[0].h < 1 || d->comp[0].h > 2 || d->comp[0].v < 1 || d->comp[0].v > 2)
+        return JPEG_ERR_UNSUPPORTED;
+    d->hMax = d->comp[0].h;
+    d->vMax = d->comp[0].v;
+    return JPEG_ERR_NONE;
+}
+
+static JpegErr ParseSos(JpegDecoder *d)
+{
+    INT32S len = ReadWord(d);
+    INT16S n = ReadByte(d);
+
+    if (n < 0) return JPEG_ERR_READ;
+    if (d->nComponents == 0 || len != 6 + 2 * n) return JPEG_ERR_FORMAT;
+    if (n != d->nComponents) return JPEG_ERR_UNSUPPORTED;   // one scan per component
+
+    for (INT8U i = 0; i < n; i++)
+    {
+        INT16S id = ReadByte(d);
+        INT16S tables = ReadByte(d);
+        if (tables < 0) return JPEG_ERR_READ;
+        if (id != d->comp[i].id) return JPEG_ERR_UNSUPPORTED;
+        if ((tables >> 4) > 1 || (tables & 0x0F) > 1) return JPEG_ERR_FORMAT;
+        d->comp[i].dcTable = tables >> 4;
+        d->comp[i].acTable = tables & 0x0F;
+    }
+    INT16S ss = ReadByte(d);
+    INT16S se = ReadByte(d);
+    INT16S a = ReadByte(d);
+    if (a < 0) return JPEG_ERR_READ;
+    if (ss != 0 || se != 63 || a != 0) return JPEG_ERR_UNSUPPORTED;
+    return JPEG_ERR_NONE;
+}
+
+// JpegOpen
+// Reads the headers of a JPEG, leaving the decoder at the start of the
+// image data.
+// d: the decoder
+// read: reads the JPEG, starting at its first byte
+// ctx: passed to read
+// Returns: JPEG_ERR_NONE, or the reason the image can't be decoded
+JpegErr JpegOpen(JpegDecoder *d, JpegReadFn read, void *ctx)
+{
+    JpegErr err;
+
+    memset(d, 0, sizeof(*d));
+    d->read = read;
+    d->readCtx = ctx;
+
+    if (ReadByte(d) != 0xFF || ReadByte(d) != M_SOI) return JPEG_ERR_FORMAT;
+
+    while (1)
+    {
+        INT16S m = NextMarker(d);
+        if (m < 0) return JPEG_ERR_READ;
+
+        switch (m)
+        {
+        case M_SOF0:
+        case M_SOF1:
+            err = ParseSof(d);
+            break;
+        case M_DHT:
+            err = ParseDht(d);
+            break;
+        case M_DQT:
+            err = ParseDqt(d);
+            break;
+        case M_DRI:
+        {
+            INT32S len = ReadWord(d);
+            INT32S interval = ReadWord(d);
+            if (interval < 0) return JPEG_ERR_READ;
+            if (len != 4) return JPEG_ERR_FORMAT;
+            d->restartInterval = (INT16U)interval;
+            err = JPEG_ERR_NONE;
+            break;
+        }
+        case M_SOS:
+            return ParseSos(d);
+        case M_EOI:
+            return JPEG_ERR_FORMAT;
+        case M_TEM:
+            err = JPEG_ERR_NONE;
+            break;
+        default:
+            // Other frame types are progressive, lossless or arithmetic coded
+            if (m > M_SOF1 && m <= 0xCF && m != M_DHT && m != M_JPG && m != M_DAC)
+                return JPEG_ERR_UNSUPPORTED;
+            if (m >= M_RST0 && m <= M_RST7)
+            {
+                err = JPEG_ERR_NONE;
+                break;
+            }
+            {
+                INT32S len = ReadWord(d);
+                if (len < 2) return len < 0 ? JPEG_ERR_READ : JPEG_ERR_FORMAT;
+                err = Skip(d, len - 2);
+            }
+            break;
+        }
+        if (JPEG_IS_ERROR(err)) return err;
+    }
+}
+
+
+/************************************************************************************
+
+   Sizes
+
+************************************************************************************/
+
+INT16U JpegScaledWidth(const JpegDecoder *d, INT8U scale)
+{
+    return (d->width + (1 << scale) - 1) >> scale;
+}
+
+INT16U JpegScaledHeight(const JpegDecoder *d, INT8U scale)
+{
+    return (d->height + (1 << scale) - 1) >> scale;
+}
+
+// The least reduction that makes the image fit maxWidth x maxHeight, or
+// JPEG_SCALE_1_8 if none does
+INT8U JpegFitScale(const JpegDecoder *d, INT16U maxWidth, INT16U maxHeight)
+{
+    INT8U scale;
+    for (scale = JPEG_SCALE_1; scale < JPEG_SCALE_1_8; scale++)
+    {
+        if (JpegScaledWidth(d, scale) <= maxWidth && JpegScaledHeight(d, scale) <= maxHeight) break;
+    }
+    return scale;
+}
+
+// Pixels the rows buffer of JpegDecode() must hold: one MCU row of the
+// image at the given scale, cropped to maxWidth
+INT32U JpegRowBufferPixels(const JpegDecoder *d, INT8U scale, INT16U maxWidth)
+{
+    INT16U w = JpegScaledWidth(d, scale);
+    if (w > maxWidth) w = maxWidth;
+    return (INT32U)w * d->vMax * (8 >> scale);
+}
+
+
+/************************************************************************************
+
+   Image data
+
+************************************************************************************/
+
+// n x n pixels from the low frequency coefficients of d->coef
+static void Idct(JpegDecoder *d, INT8U n, INT8U *out)
+{
+    const INT16S *t = n == 8 ? idct8 : (n == 4 ? idct4 : idct2);
+    INT32S *c = d->coef;
+    INT32S *w = d->work;
+
+    if (n == 1)
+    {
+        out[0] = Clamp(((c[0] + 4) >> 3) + 128);
+        return;
+    }
+
+    // Rows, keeping the result at the coefficients' scale
+    for (INT8U v = 0; v < n; v++)
+    {
+        INT32S *row = &c[v * 8];
+        BOOLEAN zero = 1;
+        for (INT8U u = 1; u < n; u++)
+        {
+            if (row[u] != 0) zero = 0;
+        }
+        for (INT8U x = 0; x < n; x++)
+        {
+            INT32S sum = row[0] * 4096;
+            if (!zero)
+            {
+                for (INT8U u = 1; u < n; u++) sum += t[x * n + u] * row[u];
+            }
+            w[v * 8 + x] = (sum + 2048) >> 12;
+        }
+    }
+
+    // Columns, then / 8 and the level shift
+    for (INT8U x = 0; x < n; x++)
+    {
+        for (INT8U y = 0; y < n; y++)
+        {
+            INT32S sum = 0;
+            for (INT8U v = 0; v < n; v++) sum += t[y * n + v] * w[v * 8 + x];
+            out[y * n + x] = Clamp(((sum + (1 << 14)) >> 15) + 128);
+        }
+    }
+}
+
+// Decode one block of component c into n x n samples, or just skip past
+// its coefficients if out is NULL
+static JpegErr DecodeBlock(JpegDecoder *d, JpegComponent *c, INT8U n, INT8U *out)
+{
+    const INT16U *q = d->quant[c->quant];
+    INT16S s = DecodeHuff(d, &d->dc[c->dcTable]);
+
+    if (s < 0 || s > 15) return JPEG_ERR_FORMAT;
+    c->dcPred += (INT16S)Extend(GetBits(d, (INT8U)s), (INT8U)s);
+
+    if (out != NULL)
+    {
+        memset(d->coef, 0, sizeof(d->coef));
+        d->coef[0] = (INT32S)c->dcPred * q[0];
+    }
+
+    for (INT8U k = 1; k < 64; )
+    {
+        INT16S rs = DecodeHuff(d, &d->ac[c->acTable]);
+        if (rs < 0) return JPEG_ERR_FORMAT;
+
+        INT8U r = rs >> 4, size = rs & 0x0F;
+        if (size == 0)
+        {
+            if (r != 15) break;     // end of block
+            k += 16;
+            continue;
+        }
+        k += r;
+        if (k > 63) return JPEG_ERR_FORMAT;
+
+        INT32S v = Extend(GetBits(d, size), size);
+        INT8U z = zigzag[k];
+        // Only the coefficients the reduced transform uses are kept
+        if (out != NULL && (z & 7) < n && (z >> 3) < n) d->coef[z] = v * q[k];
+        k++;
+    }
+
+    if (out != NULL) Idct(d, n, out);
+    return JPEG_ERR_NONE;
+}
+
+// Skip to the restart marker that ends an interval and start afresh
+static void Restart(JpegDecoder *d)
+{
+    d->bitBuf = 0;
+    d->bitCount = 0;
+    if (d->marker == 0)
+    {
+        INT16S m = NextMarker(d);
+        d->marker = m < 0 ? M_EOI : (INT8U)m;
+    }
+    // Anything but RSTn is left in place, so the rest decodes as zeros
+    if (d->marker >= M_RST0 && d->marker <= M_RST7) d->marker = 0;
+    for (INT8U i = 0; i < d->nComponents; i++) d->comp[i].dcPred = 0;
+}
+
+// Convert the w x h pixels at x0, y0 in the decoded MCU to RGB565 into
+// the rows buffer, a row at a time through RGB888. Chroma blocks are
+// nc x nc samples covering the whole MCU.
+static void ColorMcu(JpegDecoder *d, INT8U n, INT8U nc, INT16U *rows, INT16U stride,
+    INT16U x0, INT16U y0, INT16U w, INT16U h)
+{
+    INT8U chroma = d->hMax * d->vMax;   // index of the Cb samples
+    INT8U rgb[16 * 3];                  // a row of the widest MCU
+
+    for (INT16U py = y0; py < y0 + h; py++)
+    {
+        INT8U *p = rgb;
+        for (INT16U px = x0; px < x0 + w; px++)
+        {
+            INT16U by = py / n, bx = px / n;
+            INT32S y = d->samples[by * d->hMax + bx][(py - by * n) * n + (px - bx * n)];
+            INT32S r, g, b;
+
+            if (d->nComponents == 1)
+            {
+                r = g = b = y;
+            }
+            else
+            {
+                INT16U i = (py * nc / (d->vMax * n)) * nc + px * nc / (d->hMax * n);
+                INT32S cb = d->samples[chroma][i] - 128;
+                INT32S cr = d->samples[chroma + 1][i] - 128;
+                // ITU-R BT.601 full range, in 16.16 fixed point
+                r = y + ((91881 * cr + 32768) >> 16);
+                g = y - ((22554 * cb + 46802 * cr - 32768) >> 16);
+                b = y + ((116130 * cb + 32768) >> 16);
+            }
+            *p++ = Clamp(r);
+            *p++ = Clamp(g);
+            *p++ = Clamp(b);
+        }
+        PixelRgb888To565(rgb, &rows[(py - y0) * stride], w);
+    }
+}
+
+// JpegDecode
+// Decode an image opened by JpegOpen(), an MCU row at a time.
+// scale: JPEG_SCALE_xxx
+// rows: room for JpegRowBufferPixels(d, scale, maxWidth) pixels
+// left, top: scaled pixel of the image the output starts at
+// maxWidth, maxHeight: the image is cropped to this many scaled pixels
+//   from left, top; decoding stops at the last row needed
+// output: gets each MCU row once decoded, at x, y from left, top; the
+//   pixels are overwritten after
+// outCtx: passed to output
+// Returns: JPEG_ERR_NONE, or why decoding stopped
+JpegErr JpegDecode(JpegDecoder *d, INT8U scale, INT16U *rows, INT16U left, INT16U top,
+    INT16U maxWidth, INT16U maxHeight, JpegOutputFn output, void *outCtx)
+{
+    if (scale > JPEG_SCALE_1_8 || rows == NULL || d->nComponents == 0) return JPEG_ERR_ARG;
+
+    INT8U n = 8 >> scale;                       // pixels per block side
+    INT16U outW = JpegScaledWidth(d, scale);
+    INT16U outH = JpegScaledHeight(d, scale);
+    if (left > outW) left = outW;
+    if (top > outH) top = outH;
+    outW -= left;
+    outH -= top;
+    if (outW > maxWidth) outW = maxWidth;
+    if (outH > maxHeight) outH = maxHeight;
+
+    INT16U mcuW = d->hMax * n, mcuH = d->vMax * n;
+    INT16U mcusX = (d->width + d->hMax * 8 - 1) / (d->hMax * 8);
+    INT16U mcusY = (d->height + d->vMax * 8 - 1) / (d->vMax * 8);
+    INT16U restarts = d->restartInterval;
+
+    // Reduced 2x2 sampled images get their chroma at twice the luma block
+    // size, as much detail as there is, instead of replicating samples
+    INT8U nc = (d->hMax == 2 && d->vMax == 2 && n < 8) ? n * 2 : n;
+
+    // Rows above top and columns outside the crop are entropy decoded, as
+    // they must be to find the next block, but not transformed
+    for (INT16U my = 0; my < mcusY && my * mcuH < top + outH; my++)
+    {
+        INT16U y = my * mcuH;
+        INT16U y0 = y > top ? y : top;
+        INT16U y1 = y + mcuH < top + outH ? y + mcuH : top + outH;
+        BOOLEAN rowVisible = y0 < y1;
+
+        for (INT16U mx = 0; mx < mcusX; mx++)
+        {
+            INT16U x = mx * mcuW;
+            INT16U x0 = x > left ? x : left;
+            INT16U x1 = x + mcuW < left + outW ? x + mcuW : left + outW;
+            BOOLEAN visible = rowVisible && x0 < x1;
+
+            if (d->restartInterval != 0)
+            {
+                if (restarts == 0)
+                {
+                    Restart(d);
+                    restarts = d->restartInterval;
+                }
+                restarts--;
+            }
+
+            // Blocks in scan order: luma hMax x vMax, then Cb and Cr
+            INT8U block = 0;
+            for (INT8U i = 0; i < d->nComponents; i++)
+            {
+                JpegComponent *c = &d->comp[i];
+                for (INT8U b = 0; b < c->h * c->v; b++, block++)
+                {
+                    JpegErr err = DecodeBlock(d, c, i == 0 ? n : nc, visible ? d->samples[block] : NULL);
+                    if (JPEG_IS_ERROR(err)) return err;
+                }
+            }
+
+            if (visible) ColorMcu(d, n, nc, &rows[x0 - left], outW, x0 - x, y0 - y, x1 - x0, y1 - y0);
+        }
+        if (rowVisible) output(outCtx, 0, y0 - top, outW, y1 - y0, rows);
+    }
+    return JPEG_ERR_NONE;
+}
@@ -0,0 +1,114 @@
+/*
+    jpegDecode.h
+    Streaming baseline JPEG decoder for small screens.
+
+    The compressed image is pulled through a read function a few dozen
+    bytes at a time, so it can come straight from flash or a file on the
+    SD card. It is decoded one MCU row at a time into a caller supplied
+    buffer, which is handed to an output function as RGB565 rows ready to
+    be sent to the LCD. No part of the image is kept beyond that buffer.
+
+    The image can be reduced by 2, 4 or 8 while it is decoded: only the
+    low frequency coefficients of each block are transformed, into 4x4,
+    2x2 or 1x1 pixels, which is cheaper than decoding at full size.
+
+        JpegDecoder jpeg;               // about 3 KB
+        if (JpegOpen(&jpeg, ReadFn, ctx) == JPEG_ERR_NONE) {
+            INT8U scale = JpegFitScale(&jpeg, 64, 64);
+            JpegDecode(&jpeg, scale, rows, 0, 0, 64, 64, OutputFn, outCtx);
+        }
+
+    A part of the image can be decoded by giving where it starts, to crop
+    a picture that is still too large around its centre say. rows must
+    hold JpegRowBufferPixels() pixels. Supported: baseline and
+    extended sequential Huffman coded images, grayscale or YCbCr with
+    luma sampled 1x1, 2x1, 1x2 or 2x2 against chroma, restart markers.
+    Not supported: progressive, lossless or arithmetic coded images, and
+    12 bit samples.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __JPEGDECODE_H__
+#define __JPEGDECODE_H__
+
+#include "bsp.h"
+
+#define JPEG_IN_BUF_SIZE    64      // bytes read at a time
+
+// Error codes, negative as in PJDF
+#define JPEG_IS_ERROR(x)        (x < 0)
+typedef INT8S JpegErr;
+#define JPEG_ERR_NONE           0
+#define JPEG_ERR_READ           -1  // the data ended early
+#define JPEG_ERR_FORMAT         -2  // not a JPEG, or a corrupt one
+#define JPEG_ERR_UNSUPPORTED    -3  // a kind of JPEG this decoder does not handle
+#define JPEG_ERR_ARG            -4  // bad scale or buffer
+
+// Scale arguments: the image is divided by 1 << scale
+#define JPEG_SCALE_1            0
+#define JPEG_SCALE_1_2          1
+#define JPEG_SCALE_1_4          2
+#define JPEG_SCALE_1_8          3
+
+// Reads up to len bytes into buf. Returns the number read, 0 at the end.
+typedef INT32U (*JpegReadFn)(void *ctx, INT8U *buf, INT32U len);
+
+// Receives w x h RGB565 pixels, row after row, for the image rectangle
+// at x, y (in scaled pixels from the start of the part decoded)
+typedef void (*JpegOutputFn)(void *ctx, INT16U x, INT16U y, INT16U w, INT16U h,
+    const INT16U *pixels);
+
+typedef struct
+{
+    INT8U bits[17];         // number of codes of each length
+    INT8U vals[162];        // symbols by code; 162 is the most a baseline AC table has
+    INT32S maxCode[18];     // largest code of each length, -1 if none
+    INT16U valPtr[17];      // index in vals of the first code of each length
+    INT16U minCode[17];
+} JpegHuffTable;
+
+typedef struct
+{
+    INT8U id;
+    INT8U h, v;             // sampling factors
+    INT8U quant;            // quantization table
+    INT8U dcTable, acTable;
+    INT16S dcPred;
+} JpegComponent;
+
+typedef struct
+{
+    // Input
+    JpegReadFn read;
+    void *readCtx;
+    INT8U in[JPEG_IN_BUF_SIZE];
+    INT8U inPos, inLen;
+    INT32U bitBuf;          // entropy coded bits, the next one at bit 31
+    INT8S bitCount;
+    INT8U marker;           // marker met in the entropy coded data, 0 if none
+
+    // Image
+    INT16U width, height;
+    INT8U nComponents;
+    INT8U hMax, vMax;
+    INT16U restartInterval;
+    JpegComponent comp[3];
+    INT16U quant[4][64];    // in zigzag order
+    JpegHuffTable dc[2], ac[2];
+
+    // Work space of one MCU, at most 2 x 2 luma blocks and two chroma ones
+    INT32S coef[64];        // dequantized, in natural order
+    INT32S work[64];
+    INT8U samples[6][64];
+} JpegDecoder;
+
+JpegErr JpegOpen(JpegDecoder *d, JpegReadFn read, void *ctx);
+INT8U JpegFitScale(const JpegDecoder *d, INT16U maxWidth, INT16U maxHeight);
+INT16U JpegScaledWidth(const JpegDecoder *d, INT8U scale);
+INT16U JpegScaledHeight(const JpegDecoder *d, INT8U scale);
+INT32U JpegRowBufferPixels(const JpegDecoder *d, INT8U scale, INT16U maxWidth);
+JpegErr JpegDecode(JpegDecoder *d, INT8U scale, INT16U *rows, INT16U left, INT16U top,
+    INT16U maxWidth, INT16U maxHeight, JpegOutputFn output, void *outCtx);
+
+#endif /* __JPEGDECODE_H__ */
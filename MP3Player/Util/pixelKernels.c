@@ -0,0 +1,215 @@
+/*
+    pixelKernels.c
+    Pixel format conversion, blending and scaling loops, see pixelKernels.h.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "pixelKernels.h"
+
+// A pixel's fields spread over a word, green moved up clear of the others:
+// 00000GGG GGG00000 RRRRR000 000BBBBB, with room for each to grow 5 bits
+#define SPREAD_MASK     0x07E0F81FUL
+
+// Half of the last step of each spread field, for rounding a sum of four
+#define SPREAD_HALF_4   ((2UL << 21) | (2UL << 11) | 2UL)
+
+static INT32U Spread(INT16U p)
+{
+    return (p | ((INT32U)p << 16)) & SPREAD_MASK;
+}
+
+static INT16U Unspread(INT32U x)
+{
+    x &= SPREAD_MASK;
+    return (INT16U)(x | (x >> 16));
+}
+
+// Words at any alignment; the M4 does unaligned LDR and STR in hardware
+static INT32U Load32(const void *p)
+{
+    INT32U v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static void Store32(void *p, INT32U v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+static INT8U RoundChannel(INT8U c, INT8U bits)
+{
+    INT16U v = c + (1 << (7 - bits));
+    return (v > 255 ? 255 : v) >> (8 - bits);
+}
+
+
+/************************************************************************************
+
+   Reference versions
+
+************************************************************************************/
+
+void PixelRgb888To565Ref(const INT8U *rgb, INT16U *out, INT32U count)
+{
+    while (count--)
+    {
+        *out++ = (RoundChannel(rgb[0], 5) << 11) | (RoundChannel(rgb[1], 6) << 5) | RoundChannel(rgb[2], 5);
+        rgb += 3;
+    }
+}
+
+void PixelSwap565Ref(const INT16U *in, INT8U *out, INT32U count)
+{
+    while (count--)
+    {
+        *out++ = *in >> 8;
+        *out++ = *in++ & 0xFF;
+    }
+}
+
+static INT16U BlendRef(INT16U fg, INT16U bg, INT8U alpha)
+{
+    INT16U w = PIXEL_ALPHA(alpha);
+    INT16U r = (((fg >> 11) * w + (bg >> 11) * (PIXEL_ALPHA_MAX - w)) / PIXEL_ALPHA_MAX);
+    INT16U g = ((((fg >> 5) & 0x3F) * w + ((bg >> 5) & 0x3F) * (PIXEL_ALPHA_MAX - w)) / PIXEL_ALPHA_MAX);
+    INT16U b = (((fg & 0x1F) * w + (bg & 0x1F) * (PIXEL_ALPHA_MAX - w)) / PIXEL_ALPHA_MAX);
+    return (r << 11) | (g << 5) | b;
+}
+
+void PixelBlend565Ref(const INT16U *fg, const INT16U *bg, const INT8U *alpha, INT16U *out, INT32U count)
+{
+    while (count--) *out++ = BlendRef(*fg++, *bg++, *alpha++);
+}
+
+void PixelBlendColor565Ref(INT16U color, const INT16U *bg, const INT8U *alpha, INT16U *out, INT32U count)
+{
+    while (count--) *out++ = BlendRef(color, *bg++, *alpha++);
+}
+
+void PixelDownscale565Ref(const INT16U *in, INT16U inStride, INT16U *out, INT16U outWidth, INT16U outHeight)
+{
+    for (INT16U y = 0; y < outHeight; y++)
+    {
+        const INT16U *p = &in[(INT32U)y * 2 * inStride];
+        for (INT16U x = 0; x < outWidth; x++, p += 2)
+        {
+            INT16U box[4] = { p[0], p[1], p[inStride], p[inStride + 1] };
+            INT16U r = 2, g = 2, b = 2;
+            for (INT8U i = 0; i < 4; i++)
+            {
+                r += box[i] >> 11;
+                g += (box[i] >> 5) & 0x3F;
+                b += box[i] & 0x1F;
+            }
+            *out++ = ((r / 4) << 11) | ((g / 4) << 5) | (b / 4);
+        }
+    }
+}
+
+
+/************************************************************************************
+
+   Fast versions
+
+************************************************************************************/
+
+#if PIXEL_SIMD_EN
+
+void PixelRgb888To565(const INT8U *rgb, INT16U *out, INT32U count)
+{
+    // Four pixels are three words: r0 g0 b0 r1 | g1 b1 r2 g2 | b2 r3 g3 b3,
+    // lowest byte first. The rounding half of each channel in those places:
+    const INT32U half0 = 0x04040204, half1 = 0x02040402, half2 = 0x04020404;
+
+    for (; count >= 4; count -= 4, rgb += 12, out += 4)
+    {
+        INT32U w0 = __UQADD8(Load32(rgb), half0);
+        INT32U w1 = __UQADD8(Load32(rgb + 4), half1);
+        INT32U w2 = __UQADD8(Load32(rgb + 8), half2);
+
+        INT32U p0 = ((w0 & 0xF8) << 8) | ((w0 >> 5) & 0x07E0) | ((w0 >> 19) & 0x1F);
+        INT32U p1 = ((w0 >> 16) & 0xF800) | ((w1 & 0xFC) << 3) | ((w1 >> 11) & 0x1F);
+        INT32U p2 = ((w1 >> 8) & 0xF800) | ((w1 >> 21) & 0x07E0) | ((w2 >> 3) & 0x1F);
+        INT32U p3 = (w2 & 0xF800) | ((w2 >> 13) & 0x07E0) | (w2 >> 27);
+
+        Store32(out, p0 | (p1 << 16));
+        Store32(out + 2, p2 | (p3 << 16));
+    }
+    PixelRgb888To565Ref(rgb, out, count);
+}
+
+void PixelSwap565(const INT16U *in, INT8U *out, INT32U count)
+{
+    for (; count >= 2; count -= 2, in += 2, out += 4)
+    {
+        Store32(out, __REV16(Load32(in)));
+    }
+    PixelSwap565Ref(in, out, count);
+}
+
+#else
+
+void PixelRgb888To565(const INT8U *rgb, INT16U *out, INT32U count)
+{
+    PixelRgb888To565Ref(rgb, out, count);
+}
+
+void PixelSwap565(const INT16U *in, INT8U *out, INT32U count)
+{
+    PixelSwap565Ref(in, out, count);
+}
+
+#endif // PIXEL_SIMD_EN
+
+// fg * w + bg * (32 - w) for all three fields at once, as bg * 32 + (fg - bg) * w:
+// the true sum fits the word, so the wrap of (fg - bg) cancels out
+static INT16U BlendSpread(INT32U fgx, INT16U bg, INT8U alpha)
+{
+    INT32U bgx = Spread(bg);
+    return Unspread(((bgx << 5) + (fgx - bgx) * PIXEL_ALPHA(alpha)) >> 5);
+}
+
+void PixelBlend565(const INT16U *fg, const INT16U *bg, const INT8U *alpha, INT16U *out, INT32U count)
+{
+    while (count--)
+    {
+        INT8U a = *alpha++;
+        INT16U f = *fg++, b = *bg++;
+        if (a < 4) *out++ = b;
+        else if (a >= 252) *out++ = f;
+        else *out++ = BlendSpread(Spread(f), b, a);
+    }
+}
+
+void PixelBlendColor565(INT16U color, const INT16U *bg, const INT8U *alpha, INT16U *out, INT32U count)
+{
+    INT32U colorx = Spread(color);
+
+    while (count--)
+    {
+        INT8U a = *alpha++;
+        INT16U b = *bg++;
+        if (a < 4) *out++ = b;
+        else if (a >= 252) *out++ = color;
+        else *out++ = BlendSpread(colorx, b, a);
+    }
+}
+
+void PixelDownscale565(const INT16U *in, INT16U inStride, INT16U *out, INT16U outWidth, INT16U outHeight)
+{
+    for (INT16U y = 0; y < outHeight; y++)
+    {
+        const INT16U *p = &in[(INT32U)y * 2 * inStride];
+        for (INT16U x = 0; x < outWidth; x++, p += 2)
+        {
+            // A word of two pixels masked, and rotated then masked, spreads
+            // both: the sum of the two is the sum of their spread forms
+            INT32U top = Load32(p), bottom = Load32(p + inStride);
+            INT32U sum = (top & SPREAD_MASK) + (((top >> 16) | (top << 16)) & SPREAD_MASK) +
+                (bottom & SPREAD_MASK) + (((bottom >> 16) | (bottom << 16)) & SPREAD_MASK);
+            *out++ = Unspread((sum + SPREAD_HALF_4) >> 2);
+        }
+    }
+}
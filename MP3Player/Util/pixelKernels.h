@@ -0,0 +1,68 @@
+/*
+    pixelKernels.h
+    Pixel format conversion, blending and scaling loops for the LCD paths.
+
+    Each kernel has a plain C reference version, named ...Ref, that says
+    exactly what it computes one pixel at a time, and a fast version that
+    gives bit for bit the same result:
+      PixelRgb888To565  the Cortex-M4 DSP instructions: UQADD8 rounds four
+                        channels at once; words in, two pixels a store.
+                        The album art decoder's color conversion.
+      PixelSwap565      REV16 swaps the bytes of two pixels at once. The
+                        LCD driver's pixel blocks.
+      PixelBlend565,    the three fields of a pixel spread over a word
+      PixelBlendColor565,  (0x07E0F81F) so that one multiply or add works
+      PixelDownscale565    on all of them; cheaper on the M4 than unpacking
+                        channels into the 16 bit lanes of SMUAD or UADD16.
+                        The blends are for anti-aliased text and UI
+                        overlays, the downscale for album art too large
+                        at 1/8.
+    Off the M4 the first two are the reference versions. Tools/pixelTest.cpp
+    checks the fast versions against the reference on a PC, with the DSP
+    instructions emulated, and App/pixelBench.c times both on the board.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __PIXELKERNELS_H__
+#define __PIXELKERNELS_H__
+
+#include "bsp.h"
+
+// The DSP instructions come from the CMSIS intrinsics (core_cmSimd.h)
+#if defined(__CORTEX_M) && (__CORTEX_M == 0x04)
+#define PIXEL_SIMD_EN   1
+#else
+#define PIXEL_SIMD_EN   0
+#endif
+
+// Blending weights: alpha 0 to 255 is rounded to 0 to PIXEL_ALPHA_MAX
+#define PIXEL_ALPHA_MAX     32
+#define PIXEL_ALPHA(a)      (((a) + 4) >> 3)
+
+// rgb: count pixels of 3 bytes, red first. Channels are rounded, red to
+// (r + 4) / 8, green to (g + 2) / 4 and blue to (b + 4) / 8, at most 31, 63, 31.
+void PixelRgb888To565Ref(const INT8U *rgb, INT16U *out, INT32U count);
+void PixelRgb888To565(const INT8U *rgb, INT16U *out, INT32U count);
+
+// out: count pixels high byte first, as the panel takes them; any alignment
+void PixelSwap565Ref(const INT16U *in, INT8U *out, INT32U count);
+void PixelSwap565(const INT16U *in, INT8U *out, INT32U count);
+
+// out = fg over bg with alpha 0 (bg) to 255 (fg), each channel
+// (fg * w + bg * (32 - w)) / 32 rounded down, w = PIXEL_ALPHA(alpha).
+// out may be bg.
+void PixelBlend565Ref(const INT16U *fg, const INT16U *bg, const INT8U *alpha, INT16U *out, INT32U count);
+void PixelBlend565(const INT16U *fg, const INT16U *bg, const INT8U *alpha, INT16U *out, INT32U count);
+
+// As PixelBlend565() with one color for fg, as for anti-aliased text
+void PixelBlendColor565Ref(INT16U color, const INT16U *bg, const INT8U *alpha, INT16U *out, INT32U count);
+void PixelBlendColor565(INT16U color, const INT16U *bg, const INT8U *alpha, INT16U *out, INT32U count);
+
+// Halves an image: each out pixel is the rounded mean of a 2 x 2 box.
+// in: 2 * outWidth x 2 * outHeight pixels, rows inStride pixels apart
+// out: outWidth x outHeight pixels, rows outWidth apart
+void PixelDownscale565Ref(const INT16U *in, INT16U inStride, INT16U *out, INT16U outWidth, INT16U outHeight);
+void PixelDownscale565(const INT16U *in, INT16U inStride, INT16U *out, INT16U outWidth, INT16U outHeight);
+
+#endif /* __PIXELKERNELS_H__ */
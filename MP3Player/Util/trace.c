@@ -0,0 +1,204 @@
+/*
+    trace.c
+    Kernel event trace recorder, see trace.h.
+
+    Dump format (one item per line, all numbers hex except the clock rate):
+        TRACE BEGIN
+        H <core clock Hz>
+        L <records lost to ring buffer wrap>
+        T <prio> <task name>
+        E <event index> <event type> <event name>
+        R <timestamp> <type> <prio> <arg>
+        TRACE END
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#include "bsp.h"
+#include "trace.h"
+
+#if OS_TRACE_EN > 0u
+
+#define TRACE_BUF_MASK (TRACE_BUF_EVENTS - 1)
+
+#if (TRACE_BUF_EVENTS & TRACE_BUF_MASK) != 0
+#error "TRACE_BUF_EVENTS must be a power of 2"
+#endif
+
+static TraceRecord traceBuf[TRACE_BUF_EVENTS];
+static INT32U traceHead = 0;        // total records written since the last dump
+static BOOLEAN traceEnabled = OS_FALSE;
+
+
+// TraceInit
+// Starts the DWT cycle counter used for timestamps and enables recording.
+// Call before OSStart() so the first context switch is captured.
+void TraceInit(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    traceHead = 0;
+    traceEnabled = OS_TRUE;
+}
+
+// OS_TraceRecord
+// Called by the uCOS-II trace hooks to append one record to the ring buffer.
+// Safe to call from tasks and ISRs; the oldest records are overwritten.
+// type: one of OS_TRACE_TYPE_xxx
+// arg: type specific argument. For ISR records the exception number is
+//     read from IPSR and replaces arg.
+void OS_TraceRecord(INT8U type, INT16U arg)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    TraceRecord *pRec;
+
+    if (!traceEnabled) return;
+
+    if (type == OS_TRACE_TYPE_INT_ENTER || type == OS_TRACE_TYPE_INT_EXIT)
+    {
+        arg = (INT16U)(__get_IPSR() & 0x1FF);
+    }
+
+    OS_ENTER_CRITICAL();
+    pRec = &traceBuf[traceHead & TRACE_BUF_MASK];
+    traceHead++;
+    pRec->timestamp = DWT->CYCCNT;
+    pRec->type = type;
+    pRec->prio = OSPrioCur;
+    pRec->arg = arg;
+    OS_EXIT_CRITICAL();
+}
+
+// TraceUser
+// Records an application marker, e.g. to follow a touch through to audio output.
+// id: one of TRACE_USER_xxx
+// arg: marker specific argument
+void TraceUser(INT8U id, INT16U arg)
+{
+    OS_TraceRecord((INT8U)(OS_TRACE_TYPE_USER | (id & 0x3F)), arg);
+}
+
+// Writes the lowest 'digits' hex digits of value to p and returns the position after them
+static char *TraceHex(char *p, INT32U value, int digits)
+{
+    while (digits-- > 0)
+    {
+        INT32U nibble = (value >> (digits * 4)) & 0xF;
+        *p++ = (char)(nibble < 10 ? '0' + nibble : 'a' + nibble - 10);
+    }
+    return p;
+}
+
+// Prints a tag, a hex number and an optional name on one line
+static void TracePrintItem(char tag, INT32U value, int digits, char *pName)
+{
+    char line[16];
+    char *p = line;
+
+    *p++ = tag;
+    *p++ = ' ';
+    p = TraceHex(p, value, digits);
+    *p++ = ' ';
+    *p = 0;
+    PrintString(line);
+    if (pName != NULL) PrintString(pName);
+    PrintString("\n");
+}
+
+// TraceDump
+// Prints the task and event name tables followed by the buffered records,
+// oldest first, then restarts recording with an empty buffer.
+// Uses no stdio so it can run on the idle task stack.
+void TraceDump(void)
+{
+    OS_CPU_SR cpu_sr = 0u;
+    char line[32];
+    char *p;
+    INT32U head;
+    INT32U count;
+    INT32U i;
+
+    OS_ENTER_CRITICAL();
+    traceEnabled = OS_FALSE;
+    head = traceHead;
+    OS_EXIT_CRITICAL();
+
+    count = head < TRACE_BUF_EVENTS ? head : TRACE_BUF_EVENTS;
+
+    PrintString("\nTRACE BEGIN\n");
+    PrintString("H ");
+    Print_uint32(SystemCoreClock);
+    PrintString("\n");
+    TracePrintItem('L', head - count, 8, NULL);
+
+    for (i = 0; i <= OS_LOWEST_PRIO; i++)
+    {
+        OS_TCB *ptcb = OSTCBPrioTbl[i];
+        if (ptcb == (OS_TCB *)0 || ptcb == OS_TCB_RESERVED) continue;
+#if OS_TASK_NAME_EN > 0u
+        TracePrintItem('T', i, 2, (char *)ptcb->OSTCBTaskName);
+#else
+        TracePrintItem('T', i, 2, NULL);
+#endif
+    }
+
+    for (i = 0; i < OS_MAX_EVENTS; i++)
+    {
+        OS_EVENT *pevent = &OSEventTbl[i];
+        if (pevent->OSEventType == OS_EVENT_TYPE_UNUSED) continue;
+        p = line;
+        *p++ = 'E';
+        *p++ = ' ';
+        p = TraceHex(p, i, 4);
+        *p++ = ' ';
+        p = TraceHex(p, pevent->OSEventType, 2);
+        *p++ = ' ';
+        *p = 0;
+        PrintString(line);
+#if OS_EVENT_NAME_EN > 0u
+        PrintString((char *)pevent->OSEventName);
+#endif
+        PrintString("\n");
+    }
+
+    for (i = head - count; i != head; i++)
+    {
+        TraceRecord *pRec = &traceBuf[i & TRACE_BUF_MASK];
+        p = line;
+        *p++ = 'R';
+        *p++ = ' ';
+        p = TraceHex(p, pRec->timestamp, 8);
+        *p++ = ' ';
+        p = TraceHex(p, pRec->type, 2);
+        *p++ = ' ';
+        p = TraceHex(p, pRec->prio, 2);
+        *p++ = ' ';
+        p = TraceHex(p, pRec->arg, 4);
+        *p++ = '\n';
+        *p = 0;
+        PrintString(line);
+    }
+
+    PrintString("TRACE END\n");
+
+    OS_ENTER_CRITICAL();
+    traceHead = 0;
+    traceEnabled = OS_TRUE;
+    OS_EXIT_CRITICAL();
+}
+
+// TracePollUart
+// Non-blocking check for the dump request character on the UART.
+// Called from the idle task hook so dumping never delays the application tasks.
+void TracePollUart(void)
+{
+    if (USART_GetFlagStatus(COMM, USART_FLAG_RXNE) == RESET) return;
+    if ((char)USART_ReceiveData(COMM) == TRACE_DUMP_KEY)
+    {
+        TraceDump();
+    }
+}
+
+#endif // OS_TRACE_EN
@@ -0,0 +1,61 @@
+/*
+    trace.h
+    Kernel event trace recorder.
+
+    Context switches, ISR entry/exit and semaphore/mailbox/queue post and pend
+    are written by the uCOS-II hooks (see OS_TRACE_EN in os_cfg.h) as 8 byte
+    timestamped records into a RAM ring buffer. The buffer is dumped as hex text
+    over the UART on demand and converted to Chrome trace_event JSON on the host
+    by Tools/traceDecode.cpp.
+
+    Developed for University of Washington embedded systems programming certificate
+*/
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include <os_cpu.h>
+#include <os_cfg.h>
+#include <ucos_ii.h>
+
+// Number of records kept in the ring buffer, must be a power of 2.
+// Each record is 8 bytes.
+#define TRACE_BUF_EVENTS        1024
+
+// Sending this character on the UART dumps the trace buffer
+#define TRACE_DUMP_KEY          't'
+
+// Application marker ids for TraceUser(). Keep in sync with Tools/traceDecode.cpp
+#define TRACE_USER_TOUCH_PRESS      0x00    // arg: command
+#define TRACE_USER_MP3_COMMAND      0x01    // arg: command
+#define TRACE_USER_MP3_FIRST_DATA   0x02    // arg: song index
+#define TRACE_USER_DISPLAY_BEGIN    0x03    // arg: display state
+#define TRACE_USER_DISPLAY_END      0x04    // arg: display state
+#define TRACE_USER_GESTURE          0x05    // arg: GestureType
+
+// One trace record as stored in the ring buffer
+typedef struct _TraceRecord
+{
+    INT32U timestamp;   // DWT cycle counter
+    INT8U type;         // OS_TRACE_TYPE_xxx from ucos_ii.h
+    INT8U prio;         // priority of the running task when recorded
+    INT16U arg;         // type specific argument
+} TraceRecord;
+
+#if OS_TRACE_EN > 0u
+
+void TraceInit(void);
+void TraceUser(INT8U id, INT16U arg);
+void TraceDump(void);
+void TracePollUart(void);
+
+#else
+
+#define TraceInit()
+#define TraceUser(id, arg)
+#define TraceDump()
+#define TracePollUart()
+
+#endif
+
+#endif /* __TRACE_H__ */